@@ -0,0 +1,45 @@
+#include <cstddef>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t count = std::size_t{1} << 22;
+}  // namespace
+
+int main() {
+  using poids::bench::doNotOptimize;
+  using poids::bench::measure;
+  using poids::bench::report;
+
+  poids::ArrayOf<si::Density> density(count, poids::uninitialized);
+  poids::ArrayOf<si::Length> depth(count, poids::uninitialized);
+  for (std::size_t i = 0; i < count; ++i) {
+    density[i] = (1000.0 + static_cast<double>(i % 7)) * kilogram / meter3;
+    depth[i] = static_cast<double>(i % 100) * meter;
+  }
+  const si::Acceleration g = 9.81 * meter / square(second);
+  const si::Pressure surface = 101325.0 * pascal;
+  poids::ArrayOf<si::Pressure> pressure(count, poids::uninitialized);
+
+  report("p = rho * g * h + p0, one temporary per operator",
+         measure([&] {
+           poids::QuantityArray weight = density * g;
+           poids::QuantityArray hydrostatic = weight * depth;
+           pressure = hydrostatic + surface;
+           doNotOptimize(pressure.data()[count - 1]);
+         }),
+         count);
+
+  report("p = rho * g * h + p0, fused",
+         measure([&] {
+           pressure = density * g * depth + surface;
+           doNotOptimize(pressure.data()[count - 1]);
+         }),
+         count);
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/breakpoint_table.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  constexpr std::size_t breakpoints = 4096;
+  constexpr std::size_t count = 1 << 16;
+  constexpr std::size_t repeats = 8;
+
+  /** Irregular breakpoints of a calibration curve, denser at low temperatures */
+  double breakpointKelvins(std::size_t i) {
+    const double x = static_cast<double>(i) / static_cast<double>(breakpoints - 1);
+    return 250.0 + 500.0 * x * x + 0.01 * static_cast<double>(i);
+  }
+
+  double benchmarkLowerBound(const std::vector<si::Temperature>& keys, const std::vector<si::Voltage>& values,
+                             const poids::ArrayOf<si::Temperature>& t, poids::ArrayOf<si::Voltage>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          const si::Temperature x = t[i];
+          const auto upper = std::lower_bound(keys.begin() + 1, keys.end() - 1, x);
+          const auto index = static_cast<std::size_t>(upper - keys.begin()) - 1;
+          const double fraction = std::clamp(((x - keys[index]) / (keys[index + 1] - keys[index])).base(), 0.0, 1.0);
+          result[i] = values[index] + fraction * (values[index + 1] - values[index]);
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  template <typename Table>
+  double benchmarkLookup(const Table& table, const poids::ArrayOf<si::Temperature>& t,
+                         poids::ArrayOf<si::Voltage>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          result[i] = table(si::Temperature{t[i]});
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  template <typename Table>
+  double benchmarkInterpolateEach(const Table& table, const poids::ArrayOf<si::Temperature>& t,
+                                  poids::ArrayOf<si::Voltage>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        table.interpolateEach(result, t);
+        clobberMemory();
+      }
+    });
+  }
+
+  template <typename Table>
+  double benchmarkInterpolateSorted(const Table& table, const poids::ArrayOf<si::Temperature>& t,
+                                    poids::ArrayOf<si::Voltage>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        table.interpolateSorted(result, t);
+        clobberMemory();
+      }
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  std::vector<si::Temperature> keys;
+  std::vector<si::Voltage> values;
+  poids::ArrayOf<si::Temperature> keyArray(breakpoints, poids::uninitialized);
+  poids::ArrayOf<si::Voltage> valueArray(breakpoints, poids::uninitialized);
+  for (std::size_t i = 0; i < breakpoints; ++i) {
+    keys.push_back(breakpointKelvins(i) * kelvin);
+    values.push_back(std::sqrt(breakpointKelvins(i)) * milli(volt));
+    keyArray[i] = keys.back();
+    valueArray[i] = values.back();
+  }
+  const auto table = poids::makeBreakpointTable(keyArray, valueArray);
+
+  poids::ArrayOf<si::Temperature> unsorted(count, poids::uninitialized);
+  poids::ArrayOf<si::Temperature> sorted(count, poids::uninitialized);
+  for (std::size_t i = 0; i < count; ++i) {
+    unsorted[i] = (250.0 + 800.0 * static_cast<double>((i * 40503) % count) / count) * kelvin;
+    sorted[i] = (250.0 + 800.0 * static_cast<double>(i) / count) * kelvin;
+  }
+  poids::ArrayOf<si::Voltage> result(count);
+
+  report("Calibration, std::lower_bound unsorted", benchmarkLowerBound(keys, values, unsorted, result), count * repeats);
+  report("Calibration, table lookups unsorted", benchmarkLookup(table, unsorted, result), count * repeats);
+  report("Calibration, interpolateEach unsorted", benchmarkInterpolateEach(table, unsorted, result), count * repeats);
+  report("Calibration, std::lower_bound sorted", benchmarkLowerBound(keys, values, sorted, result), count * repeats);
+  report("Calibration, interpolateSorted", benchmarkInterpolateSorted(table, sorted, result), count * repeats);
+
+  return 0;
+}
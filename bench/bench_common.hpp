@@ -0,0 +1,54 @@
+#ifndef POIDS_BENCH_BENCH_COMMON_HPP
+#define POIDS_BENCH_BENCH_COMMON_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+
+namespace poids::bench {
+  /** Prevents the compiler from optimizing away the computation of value */
+  template <typename T>
+  void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+#endif
+  }
+
+  /** Forces all pending writes to memory, so repeated work over the same data is not elided */
+  inline void clobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+  }
+
+  /** Runs f repetitions times, returning the fastest run in seconds */
+  template <typename F>
+  double measure(F&& f, int repetitions = 5) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repetitions; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      f();
+      const auto stop = std::chrono::steady_clock::now();
+      best = std::min(best, std::chrono::duration<double>(stop - start).count());
+    }
+    return best;
+  }
+
+  /** Prints the time per element of a benchmark */
+  inline void report(const char* name, double seconds, std::size_t elements) {
+    std::printf("%-52s %10.3f ms %8.3f ns/element\n",
+                name,
+                seconds * 1e3,
+                seconds * 1e9 / static_cast<double>(elements));
+  }
+}  // namespace poids::bench
+
+#endif
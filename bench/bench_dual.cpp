@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poids/scalar_support/dual.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t count = std::size_t{1} << 16;
+  constexpr std::size_t repeats = 16;
+  constexpr std::size_t parameters = 4;
+
+  /** Darcy-Weisbach pressure drop, with a Blasius friction factor */
+  template <typename Scalar>
+  si::PressureOf<Scalar> pressureDrop(si::LengthOf<Scalar> length,
+                                      si::LengthOf<Scalar> diameter,
+                                      si::VelocityOf<Scalar> velocity,
+                                      si::DensityOf<Scalar> density) {
+    const si::KinematicViscosity viscosity = 1.0e-6 * meter * meter / second;
+    const auto reynolds = velocity * diameter / viscosity;
+    const auto friction = 0.316 * poids::pow<-1, 4>(reynolds);
+    return friction * length / diameter * density * velocity * velocity / 2.0;
+  }
+
+  struct Pipe {
+    si::Length length;
+    si::Length diameter;
+    si::Velocity velocity;
+    si::Density density;
+  };
+
+  std::vector<Pipe> makePipes() {
+    std::vector<Pipe> pipes(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      pipes[i] = Pipe{(10.0 + static_cast<double>(i % 89)) * meter,
+                      (0.05 + 0.001 * static_cast<double>(i % 31)) * meter,
+                      (0.5 + 0.01 * static_cast<double>(i % 53)) * meter / second,
+                      1000.0 * kilogram / poids::pow<3, 1>(meter)};
+    }
+    return pipes;
+  }
+
+  /** The gradient of every pipe's pressure drop by central differences */
+  double benchmarkFiniteDifferences(const std::vector<Pipe>& pipes, std::vector<double>& jacobian) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          const Pipe& p = pipes[i];
+          double* row = &jacobian[i * parameters];
+          const double h = 1.0e-6;
+          row[0] = (pressureDrop<double>(p.length * (1.0 + h), p.diameter, p.velocity, p.density) -
+                    pressureDrop<double>(p.length * (1.0 - h), p.diameter, p.velocity, p.density))
+                       .as(pascal) /
+                   (2.0 * h * p.length.as(meter));
+          row[1] = (pressureDrop<double>(p.length, p.diameter * (1.0 + h), p.velocity, p.density) -
+                    pressureDrop<double>(p.length, p.diameter * (1.0 - h), p.velocity, p.density))
+                       .as(pascal) /
+                   (2.0 * h * p.diameter.as(meter));
+          row[2] = (pressureDrop<double>(p.length, p.diameter, p.velocity * (1.0 + h), p.density) -
+                    pressureDrop<double>(p.length, p.diameter, p.velocity * (1.0 - h), p.density))
+                       .as(pascal) /
+                   (2.0 * h * p.velocity.as(meter / second));
+          row[3] = (pressureDrop<double>(p.length, p.diameter, p.velocity, p.density * (1.0 + h)) -
+                    pressureDrop<double>(p.length, p.diameter, p.velocity, p.density * (1.0 - h)))
+                       .as(pascal) /
+                   (2.0 * h * p.density.as(kilogram / poids::pow<3, 1>(meter)));
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  /** The gradient of every pipe's pressure drop with one evaluation in dual numbers */
+  double benchmarkDual(const std::vector<Pipe>& pipes, std::vector<double>& jacobian) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+    using Dual = poids::Dual<double, parameters>;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          const Pipe& p = pipes[i];
+          const auto drop = pressureDrop<Dual>(poids::makeVariable<parameters>(p.length, 0),
+                                               poids::makeVariable<parameters>(p.diameter, 1),
+                                               poids::makeVariable<parameters>(p.velocity, 2),
+                                               poids::makeVariable<parameters>(p.density, 3));
+          drop.base().derivatives().store(&jacobian[i * parameters]);
+        }
+        clobberMemory();
+      }
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  const std::vector<Pipe> pipes = makePipes();
+  std::vector<double> jacobian(count * parameters);
+
+  report("Pressure drop gradient, central differences", benchmarkFiniteDifferences(pipes, jacobian), count * repeats);
+  report("Pressure drop gradient, Dual<double, 4>", benchmarkDual(pipes, jacobian), count * repeats);
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/fft.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  constexpr std::size_t length = 1024;
+  constexpr std::size_t channels = 2048;
+
+  /** A textbook radix-2 transform on interleaved std::complex, computing its
+   * twiddles as it goes
+   */
+  void textbookFft(std::vector<std::complex<double>>& x) {
+    const std::size_t n = x.size();
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+      std::size_t bit = n >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) {
+        std::swap(x[i], x[j]);
+      }
+    }
+    for (std::size_t h = 1; h < n; h *= 2) {
+      const std::complex<double> step = std::polar(1.0, -3.1415926535897932384626433832795 / static_cast<double>(h));
+      for (std::size_t start = 0; start < n; start += 2 * h) {
+        std::complex<double> w = 1.0;
+        for (std::size_t j = 0; j < h; ++j) {
+          const std::complex<double> t = w * x[start + j + h];
+          x[start + j + h] = x[start + j] - t;
+          x[start + j] += t;
+          w *= step;
+        }
+      }
+    }
+  }
+
+  std::vector<poids::ArrayOf<si::Acceleration>> makeChannels() {
+    std::vector<poids::ArrayOf<si::Acceleration>> result;
+    for (std::size_t c = 0; c < channels; ++c) {
+      poids::ArrayOf<si::Acceleration> signal(length, poids::uninitialized);
+      for (std::size_t i = 0; i < length; ++i) {
+        signal[i] = std::sin(0.01 * static_cast<double>(c + 1) * static_cast<double>(i)) * meter / (second * second);
+      }
+      result.push_back(std::move(signal));
+    }
+    return result;
+  }
+
+  const si::Time dt = 1.0 * milli(second);
+
+  double benchmarkTextbook(const std::vector<poids::ArrayOf<si::Acceleration>>& signals) {
+    using poids::bench::doNotOptimize;
+    using poids::bench::measure;
+
+    std::vector<std::complex<double>> x(length);
+    return measure([&] {
+      for (const auto& signal : signals) {
+        for (std::size_t i = 0; i < length; ++i) {
+          x[i] = signal.data()[i];
+        }
+        textbookFft(x);
+        doNotOptimize(x[1]);
+      }
+    });
+  }
+
+  double benchmarkComplexPlan(const std::vector<poids::ArrayOf<si::Acceleration>>& signals) {
+    using poids::bench::doNotOptimize;
+    using poids::bench::measure;
+
+    const poids::FftPlan<double> plan(length);
+    poids::ComplexArrayOf<si::Acceleration> x(length);
+    return measure([&] {
+      for (const auto& signal : signals) {
+        x.real().assign(signal.data(), meter / (second * second));
+        const auto spectrum = poids::fourierTransform(plan, x, dt);
+        doNotOptimize(spectrum.real().data()[1]);
+      }
+    });
+  }
+
+  double benchmarkRealPlan(const std::vector<poids::ArrayOf<si::Acceleration>>& signals) {
+    using poids::bench::doNotOptimize;
+    using poids::bench::measure;
+
+    const poids::RealFftPlan<double> plan(length);
+    return measure([&] {
+      for (const auto& signal : signals) {
+        const auto spectrum = poids::fourierTransform(plan, signal, dt);
+        doNotOptimize(spectrum.real().data()[1]);
+      }
+    });
+  }
+
+  double benchmarkWelch(const std::vector<poids::ArrayOf<si::Acceleration>>& signals) {
+    using poids::bench::doNotOptimize;
+    using poids::bench::measure;
+
+    const poids::RealFftPlan<double> plan(256);
+    return measure([&] {
+      for (const auto& signal : signals) {
+        const auto spectrum = poids::welch(plan, signal, dt, 128);
+        doNotOptimize(spectrum.density.data()[1]);
+      }
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  const std::vector<poids::ArrayOf<si::Acceleration>> signals = makeChannels();
+
+  report("1024-point spectrum, textbook std::complex FFT", benchmarkTextbook(signals), channels);
+  report("1024-point spectrum, FftPlan", benchmarkComplexPlan(signals), channels);
+  report("1024-point spectrum, RealFftPlan", benchmarkRealPlan(signals), channels);
+  report("1024-sample Welch PSD, 256-point segments", benchmarkWelch(signals), channels);
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <cstddef>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/scalar_support/fixed_point.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t count = std::size_t{1} << 20;
+  constexpr std::size_t repeats = 32;
+
+  /** One step of a proportional-integral controller for every element:
+   * command = gain * error + integral, with the integral accumulating gain * error
+   */
+  template <typename Scalar>
+  double benchmarkControlLoop() {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    poids::ArrayOf<si::CurrentOf<Scalar>> error(count, poids::uninitialized);
+    poids::ArrayOf<si::VoltageOf<Scalar>> integral(count, poids::uninitialized);
+    poids::ArrayOf<si::VoltageOf<Scalar>> command(count, poids::uninitialized);
+    for (std::size_t i = 0; i < count; ++i) {
+      error[i] = ampere * Scalar{static_cast<double>(i % 97) * 0.01 - 0.5};
+      integral[i] = volt * Scalar{0.0};
+    }
+    const si::ResistanceOf<Scalar> gain = ohm * Scalar{0.75};
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        integral += gain * error;
+        command = gain * error + integral;
+        clobberMemory();
+      }
+    });
+  }
+
+  template <typename Scalar>
+  double benchmarkProduct() {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    poids::ArrayOf<si::CurrentOf<Scalar>> current(count, poids::uninitialized);
+    poids::ArrayOf<si::VoltageOf<Scalar>> voltage(count, poids::uninitialized);
+    poids::ArrayOf<si::PowerOf<Scalar>> power(count, poids::uninitialized);
+    for (std::size_t i = 0; i < count; ++i) {
+      current[i] = ampere * Scalar{static_cast<double>(i % 17) - 8.0};
+      voltage[i] = volt * Scalar{23.0};
+    }
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        power = current * voltage;
+        clobberMemory();
+      }
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  report("Current * Voltage, double", benchmarkProduct<double>(), count * repeats);
+  report("Current * Voltage, Fixed32<16>", benchmarkProduct<poids::Fixed32<16>>(), count * repeats);
+  report("Current * Voltage, Fixed32<16, Wrap>", benchmarkProduct<poids::Fixed32<16, poids::Wrap>>(), count * repeats);
+
+  report("PI update, double", benchmarkControlLoop<double>(), count * repeats);
+  report("PI update, Fixed32<16>", benchmarkControlLoop<poids::Fixed32<16>>(), count * repeats);
+  report("PI update, Fixed32<16, Wrap>", benchmarkControlLoop<poids::Fixed32<16, poids::Wrap>>(), count * repeats);
+
+  return 0;
+}
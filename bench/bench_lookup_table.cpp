@@ -0,0 +1,93 @@
+#include <cmath>
+#include <cstddef>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/lookup_table.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  constexpr std::size_t count = 4096;
+  constexpr std::size_t repeats = 64;
+
+  /** A vapour pressure correlation of the kind that is worth tabulating */
+  si::Pressure vapourPressure(si::Temperature temperature, si::Pressure ambient) {
+    const double t = temperature.as(kelvin);
+    const double saturation = std::exp(23.196 - 3816.44 / (t - 46.13));
+    return si::Pressure{saturation * pascal} * std::pow(ambient.as(kilo(pascal)) / 101.325, 0.02);
+  }
+
+  const poids::UniformAxis<si::Temperature> temperatures{273.0 * kelvin, 373.0 * kelvin, 101};
+  const poids::UniformAxis<si::Pressure> pressures{50.0 * kilo(pascal), 150.0 * kilo(pascal), 41};
+
+  double benchmarkDirect(const poids::ArrayOf<si::Temperature>& t, const poids::ArrayOf<si::Pressure>& p,
+                         poids::ArrayOf<si::Pressure>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          result[i] = vapourPressure(si::Temperature{t[i]}, si::Pressure{p[i]});
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  template <typename Table>
+  double benchmarkLookup(const Table& table, const poids::ArrayOf<si::Temperature>& t,
+                         const poids::ArrayOf<si::Pressure>& p, poids::ArrayOf<si::Pressure>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          result[i] = table(si::Temperature{t[i]}, si::Pressure{p[i]});
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  template <typename Table, typename Interpolation>
+  double benchmarkInterpolateEach(const Table& table, Interpolation interpolation,
+                                  const poids::ArrayOf<si::Temperature>& t, const poids::ArrayOf<si::Pressure>& p,
+                                  poids::ArrayOf<si::Pressure>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        table.interpolateEach(interpolation, result, t, p);
+        clobberMemory();
+      }
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  const auto table = poids::makeLookupTable(vapourPressure, temperatures, pressures);
+  poids::ArrayOf<si::Temperature> t(count, poids::uninitialized);
+  poids::ArrayOf<si::Pressure> p(count, poids::uninitialized);
+  for (std::size_t i = 0; i < count; ++i) {
+    t[i] = (273.0 + 0.0237 * static_cast<double>(i)) * kelvin;
+    p[i] = (50.0 + static_cast<double>((i * 37) % 100)) * kilo(pascal);
+  }
+  poids::ArrayOf<si::Pressure> result(count);
+
+  report("Vapour pressure, direct", benchmarkDirect(t, p, result), count * repeats);
+  report("Vapour pressure, table lookups", benchmarkLookup(table, t, p, result), count * repeats);
+  report("Vapour pressure, interpolateEach linear",
+         benchmarkInterpolateEach(table, poids::linearInterpolation, t, p, result), count * repeats);
+  report("Vapour pressure, interpolateEach cubic",
+         benchmarkInterpolateEach(table, poids::cubicInterpolation, t, p, result), count * repeats);
+
+  return 0;
+}
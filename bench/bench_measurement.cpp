@@ -0,0 +1,68 @@
+#include <cstddef>
+#include <random>
+
+#include "bench_common.hpp"
+#include "poids/scalar_support/measurement.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t results = 256;
+  constexpr std::size_t samples = 1000;
+
+  /** The power dissipated in a calibration resistor */
+  template <typename Scalar>
+  si::PowerOf<Scalar> dissipated(si::VoltageOf<Scalar> voltage, si::ResistanceOf<Scalar> resistance) {
+    return voltage * voltage / resistance;
+  }
+
+  /** The uncertainty of each result from the spread of Monte Carlo samples */
+  double benchmarkMonteCarlo() {
+    using poids::bench::doNotOptimize;
+    using poids::bench::measure;
+
+    std::mt19937_64 generator{42};
+    std::normal_distribution<double> voltageNoise{12.0, 0.05};
+    std::normal_distribution<double> resistanceNoise{100.0, 1.0};
+
+    return measure([&] {
+      for (std::size_t r = 0; r < results; ++r) {
+        double sum = 0.0;
+        double sumOfSquares = 0.0;
+        for (std::size_t s = 0; s < samples; ++s) {
+          const double power = dissipated<double>(voltageNoise(generator) * volt, resistanceNoise(generator) * ohm).as(watt);
+          sum += power;
+          sumOfSquares += power * power;
+        }
+        const double mean = sum / samples;
+        const double variance = sumOfSquares / samples - mean * mean;
+        doNotOptimize(variance);
+      }
+    });
+  }
+
+  /** The uncertainty of each result from one linear propagation */
+  double benchmarkPropagation() {
+    using poids::bench::doNotOptimize;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < results; ++r) {
+        const auto voltage = poids::makeMeasurement(si::Voltage{12.0 * volt}, si::Voltage{0.05 * volt});
+        const auto resistance = poids::makeMeasurement(si::Resistance{100.0 * ohm}, si::Resistance{1.0 * ohm});
+        const double uncertainty = dissipated(voltage, resistance).uncertainty().as(watt);
+        doNotOptimize(uncertainty);
+      }
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  report("Power uncertainty, Monte Carlo with 1000 samples", benchmarkMonteCarlo(), results);
+  report("Power uncertainty, Measurement<double>", benchmarkPropagation(), results);
+
+  return 0;
+}
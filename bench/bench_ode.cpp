@@ -0,0 +1,130 @@
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/ode.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t count = 4096;
+  constexpr std::size_t steps = 256;
+  constexpr double omegaSquared = 4.0;
+  constexpr double damping = 0.1;
+
+  /** A damped oscillator, generic in the scalar of its state */
+  struct Oscillator {
+    template <typename TimeQuantity, typename State>
+    auto operator()(const TimeQuantity&, const State& y) const {
+      const auto& [x, v] = y;
+      return std::make_tuple(v, -(omegaSquared * hertz * hertz) * x - (damping * hertz) * v);
+    }
+  };
+
+  struct RawState {
+    double x;
+    double v;
+  };
+
+  double acceleration(double x, double v) { return -omegaSquared * x - damping * v; }
+
+  /** One fourth-order Runge-Kutta step written out by hand on raw doubles */
+  RawState rawStep(double x, double v, double dt) {
+    const double k1x = v;
+    const double k1v = acceleration(x, v);
+    const double k2x = v + 0.5 * dt * k1v;
+    const double k2v = acceleration(x + 0.5 * dt * k1x, v + 0.5 * dt * k1v);
+    const double k3x = v + 0.5 * dt * k2v;
+    const double k3v = acceleration(x + 0.5 * dt * k2x, v + 0.5 * dt * k2v);
+    const double k4x = v + dt * k3v;
+    const double k4v = acceleration(x + dt * k3x, v + dt * k3v);
+    return RawState{x + (dt / 6.0) * (k1x + 2.0 * (k2x + k3x) + k4x), v + (dt / 6.0) * (k1v + 2.0 * (k2v + k3v) + k4v)};
+  }
+
+  /** Hand-written steps, one system at a time */
+  double benchmarkHandWrittenStructs() {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    std::vector<RawState> states(count, RawState{1.0, 0.0});
+
+    return measure([&] {
+      for (std::size_t s = 0; s < steps; ++s) {
+        for (RawState& y : states) {
+          y = rawStep(y.x, y.v, 1e-3);
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  /** Hand-written steps on a structure of arrays */
+  double benchmarkHandWrittenArrays() {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    std::vector<double> position(count, 1.0);
+    std::vector<double> velocity(count, 0.0);
+
+    return measure([&] {
+      for (std::size_t s = 0; s < steps; ++s) {
+        for (std::size_t i = 0; i < count; ++i) {
+          const RawState next = rawStep(position[i], velocity[i], 1e-3);
+          position[i] = next.x;
+          velocity[i] = next.v;
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  /** rungeKutta4Step on a tuple of quantities, one system at a time */
+  double benchmarkTupleState() {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+    using State = std::tuple<si::Length, si::Velocity>;
+
+    std::vector<State> states(count, State{1.0 * meter, 0.0 * meter / second});
+    const si::Time dt = 1e-3 * second;
+
+    return measure([&] {
+      for (std::size_t s = 0; s < steps; ++s) {
+        for (State& y : states) {
+          y = poids::rungeKutta4Step(Oscillator{}, si::Time{}, y, dt);
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  /** rungeKutta4StepEach on a structure of arrays, a NativeBatch of systems at a time */
+  double benchmarkStructureOfArrays() {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    poids::ArrayOf<si::Length> position(count, 1.0 * meter);
+    poids::ArrayOf<si::Velocity> velocity(count, 0.0 * meter / second);
+    const si::Time dt = 1e-3 * second;
+
+    return measure([&] {
+      for (std::size_t s = 0; s < steps; ++s) {
+        poids::rungeKutta4StepEach(Oscillator{}, si::Time{}, std::tie(position, velocity), dt);
+        clobberMemory();
+      }
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  report("RK4 step, hand-written doubles, one system at a time", benchmarkHandWrittenStructs(), count * steps);
+  report("RK4 step, tuple of quantities, one system at a time", benchmarkTupleState(), count * steps);
+  report("RK4 step, hand-written doubles, structure of arrays", benchmarkHandWrittenArrays(), count * steps);
+  report("RK4 step, rungeKutta4StepEach, structure of arrays", benchmarkStructureOfArrays(), count * steps);
+
+  return 0;
+}
@@ -0,0 +1,77 @@
+#include <cstddef>
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include "bench_common.hpp"
+#include "poids/algorithm/reduce.hpp"
+#include "poids/parallel/algorithm.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t count = std::size_t{1} << 24;
+  constexpr std::size_t repeats = 8;
+}  // namespace
+
+int main() {
+  using poids::bench::clobberMemory;
+  using poids::bench::doNotOptimize;
+  using poids::bench::measure;
+  using poids::bench::report;
+
+  poids::ArrayOf<si::Current> current(count, poids::uninitialized);
+  poids::ArrayOf<si::Voltage> voltage(count, poids::uninitialized);
+  poids::ArrayOf<si::Power> power(count, poids::uninitialized);
+  for (std::size_t i = 0; i < count; ++i) {
+    current[i] = (static_cast<double>(i % 17) - 8.0) * ampere;
+    voltage[i] = 230.0 * volt;
+  }
+
+  report("serial poids::dot(Current, Voltage)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::dot(current, voltage));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+  for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+    poids::parallel::ThreadPool pool(threads - 1);
+
+    const std::string reduceName = "parallel::reduce(Current * Voltage), " + std::to_string(threads) + " threads";
+    report(reduceName.c_str(),
+           measure([&] {
+             for (std::size_t r = 0; r < repeats; ++r) {
+               doNotOptimize(poids::parallel::reduce(pool, current * voltage));
+               clobberMemory();
+             }
+           }),
+           count * repeats);
+
+    const std::string deterministicName = "  deterministicReduction, " + std::to_string(threads) + " threads";
+    report(deterministicName.c_str(),
+           measure([&] {
+             for (std::size_t r = 0; r < repeats; ++r) {
+               doNotOptimize(poids::parallel::reduce(pool, current * voltage, poids::parallel::deterministicReduction));
+               clobberMemory();
+             }
+           }),
+           count * repeats);
+
+    const std::string transformName = "parallel::transform(Current, Voltage), " + std::to_string(threads) + " threads";
+    report(transformName.c_str(),
+           measure([&] {
+             for (std::size_t r = 0; r < repeats; ++r) {
+               poids::parallel::transform(pool, current, power, [](si::Current i) { return i * (230.0 * volt); });
+               clobberMemory();
+             }
+           }),
+           count * repeats);
+  }
+
+  return 0;
+}
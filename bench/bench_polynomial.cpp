@@ -0,0 +1,112 @@
+#include <cstddef>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/polynomial.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t count = 1 << 16;
+  constexpr std::size_t repeats = 32;
+
+  using SpecificHeatCapacity = poids::Quantity<double, poids::UnitOf_t<decltype(joule / (kilogram * kelvin))>>;
+
+  /** A seventh-degree fit of a specific heat capacity, in kelvin */
+  constexpr double coefficients[] = {1.1e3, -0.42, 1.1e-3, -8.0e-7, 2.1e-10, 3.0e-14, -1.2e-17, 1.0e-21};
+
+  const auto perKelvin = joule / (kilogram * kelvin);
+  const poids::Polynomial<SpecificHeatCapacity, si::Temperature, 7> fit{
+      coefficients[0] * perKelvin,
+      coefficients[1] * perKelvin / kelvin,
+      coefficients[2] * perKelvin / poids::pow<2, 1>(kelvin),
+      coefficients[3] * perKelvin / poids::pow<3, 1>(kelvin),
+      coefficients[4] * perKelvin / poids::pow<4, 1>(kelvin),
+      coefficients[5] * perKelvin / poids::pow<5, 1>(kelvin),
+      coefficients[6] * perKelvin / poids::pow<6, 1>(kelvin),
+      coefficients[7] * perKelvin / poids::pow<7, 1>(kelvin)};
+
+  double benchmarkRaw(const poids::ArrayOf<si::Temperature>& t, poids::ArrayOf<SpecificHeatCapacity>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    const double* x = t.data();
+    double* out = result.data();
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          double value = coefficients[7];
+          for (std::size_t k = 7; k-- > 0;) {
+            value = value * x[i] + coefficients[k];
+          }
+          out[i] = value;
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  double benchmarkScalar(const poids::ArrayOf<si::Temperature>& t, poids::ArrayOf<SpecificHeatCapacity>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          result[i] = fit(si::Temperature{t[i]});
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  template <typename Scheme>
+  double benchmarkEach(Scheme scheme, const poids::ArrayOf<si::Temperature>& t,
+                       poids::ArrayOf<SpecificHeatCapacity>& result) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        fit.evaluateEach(scheme, result, t);
+        clobberMemory();
+      }
+    });
+  }
+
+  /** Feeds each result back into the next evaluation, so only latency matters */
+  template <typename Scheme>
+  double benchmarkChain(Scheme scheme) {
+    using poids::bench::doNotOptimize;
+    using poids::bench::measure;
+
+    return measure([&] {
+      si::Temperature t = 300.0 * kelvin;
+      for (std::size_t i = 0; i < count; ++i) {
+        const SpecificHeatCapacity cp = fit.evaluate(scheme, t);
+        t = 300.0 * kelvin + cp * (1.0e-3 * kilogram * kelvin * kelvin / joule);
+      }
+      doNotOptimize(t);
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  poids::ArrayOf<si::Temperature> t(count, poids::uninitialized);
+  for (std::size_t i = 0; i < count; ++i) {
+    t[i] = (300.0 + 700.0 * static_cast<double>(i) / count) * kelvin;
+  }
+  poids::ArrayOf<SpecificHeatCapacity> result(count);
+
+  report("Degree 7 polynomial, raw double Horner", benchmarkRaw(t, result), count * repeats);
+  report("Degree 7 polynomial, scalar calls", benchmarkScalar(t, result), count * repeats);
+  report("Degree 7 polynomial, evaluateEach horner", benchmarkEach(poids::horner, t, result), count * repeats);
+  report("Degree 7 polynomial, evaluateEach estrin", benchmarkEach(poids::estrin, t, result), count * repeats);
+  report("Degree 7 polynomial, dependent chain horner", benchmarkChain(poids::horner), count);
+  report("Degree 7 polynomial, dependent chain estrin", benchmarkChain(poids::estrin), count);
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <cmath>
+#include <cstddef>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+int main() {
+  using poids::bench::clobberMemory;
+  using poids::bench::doNotOptimize;
+  using poids::bench::measure;
+  using poids::bench::report;
+
+  const std::size_t count = std::size_t{1} << 12;
+  const std::size_t repeats = 1024;
+
+  poids::ArrayOf<si::Area> area(count, poids::uninitialized);
+  for (std::size_t i = 0; i < count; ++i) {
+    area[i] = (1.0 + static_cast<double>(i)) * meter2;
+  }
+  poids::ArrayOf<si::Length> length(count, poids::uninitialized);
+  poids::ArrayOf<si::Volume> volume(count, poids::uninitialized);
+
+  report("std::pow(x, 0.5) on raw doubles",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             for (std::size_t i = 0; i < count; ++i) {
+               length.data()[i] = std::pow(area.data()[i], 0.5);
+             }
+             clobberMemory();
+           }
+           doNotOptimize(length.data()[count - 1]);
+         }),
+         count * repeats);
+
+  report("poids::sqrt(Area)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             for (std::size_t i = 0; i < count; ++i) {
+               length[i] = poids::sqrt(si::Area{area[i]});
+             }
+             clobberMemory();
+           }
+           doNotOptimize(length.data()[count - 1]);
+         }),
+         count * repeats);
+
+  report("std::pow(x, 3.0) on raw doubles",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             for (std::size_t i = 0; i < count; ++i) {
+               volume.data()[i] = std::pow(area.data()[i], 3.0);
+             }
+             clobberMemory();
+           }
+           doNotOptimize(volume.data()[count - 1]);
+         }),
+         count * repeats);
+
+  report("poids::pow<3, 2>(Area)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             for (std::size_t i = 0; i < count; ++i) {
+               volume[i] = poids::pow<3, 2>(si::Area{area[i]});
+             }
+             clobberMemory();
+           }
+           doNotOptimize(volume.data()[count - 1]);
+         }),
+         count * repeats);
+  return 0;
+}
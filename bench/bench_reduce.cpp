@@ -0,0 +1,146 @@
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poids/algorithm/reduce.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t count = std::size_t{1} << 12;
+  constexpr std::size_t repeats = 4096;
+}  // namespace
+
+int main() {
+  using poids::bench::clobberMemory;
+  using poids::bench::doNotOptimize;
+  using poids::bench::measure;
+  using poids::bench::report;
+
+  std::vector<double> rawPower(count);
+  std::vector<double> rawCurrent(count);
+  std::vector<double> rawVoltage(count, 230.0);
+  poids::ArrayOf<si::Power> power(count, poids::uninitialized);
+  poids::ArrayOf<si::Current> current(count, poids::uninitialized);
+  poids::ArrayOf<si::Voltage> voltage(count, poids::uninitialized);
+  poids::ArrayOf<si::PowerOf<float>> floatPower(count, poids::uninitialized);
+  for (std::size_t i = 0; i < count; ++i) {
+    rawPower[i] = 1.0 + static_cast<double>(i % 1000) * 1e-3;
+    rawCurrent[i] = static_cast<double>(i % 17) - 8.0;
+    power[i] = rawPower[i] * watt;
+    current[i] = rawCurrent[i] * ampere;
+    voltage[i] = 230.0 * volt;
+    floatPower[i] = static_cast<float>(rawPower[i]) * si::float_units::watt;
+  }
+
+  report("raw double loop sum",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             double total = 0.0;
+             for (std::size_t i = 0; i < count; ++i) {
+               total += rawPower[i];
+             }
+             doNotOptimize(total);
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("std::accumulate over ArrayOf<Power>",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(std::accumulate(power.begin(), power.end(), 0.0 * watt));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("poids::sum, fastSummation",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::sum(power, poids::fastSummation));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("poids::sum, pairwiseSummation",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::sum(power, poids::pairwiseSummation));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("poids::sum, kahanSummation",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::sum(power, poids::kahanSummation));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("poids::sum(ArrayOf<PowerOf<float>>)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::sum(floatPower));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("poids::sumAs<double>(ArrayOf<PowerOf<float>>)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::sumAs<double>(floatPower));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("raw double loop dot",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             double total = 0.0;
+             for (std::size_t i = 0; i < count; ++i) {
+               total += rawCurrent[i] * rawVoltage[i];
+             }
+             doNotOptimize(total);
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("poids::dot(Current, Voltage)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::dot(current, voltage));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("poids::rms(Current)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::rms(current));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  report("poids::max(Current)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             doNotOptimize(poids::max(current));
+             clobberMemory();
+           }
+         }),
+         count * repeats);
+
+  return 0;
+}
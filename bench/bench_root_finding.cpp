@@ -0,0 +1,121 @@
+#include <cstddef>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/root_finding.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  constexpr std::size_t count = 4096;
+  constexpr std::size_t repeats = 16;
+
+  /** The difference between the pressure at depth in a stiffening fluid and target */
+  struct PressureError {
+    template <typename Length, typename Pressure>
+    auto operator()(const Length& depth, const Pressure& target) const {
+      const auto density = 1000.0 * kilogram / (meter * meter * meter);
+      const auto gravity = 9.81 * meter / (second * second);
+      const auto stiffening = 2.0 * kilogram / (meter * meter * meter * second * second);
+      return density * gravity * depth + stiffening * depth * depth - target;
+    }
+  };
+
+  struct PressureSlope {
+    template <typename Length, typename Pressure>
+    auto operator()(const Length& depth, const Pressure&) const {
+      const auto density = 1000.0 * kilogram / (meter * meter * meter);
+      const auto gravity = 9.81 * meter / (second * second);
+      const auto stiffening = 2.0 * kilogram / (meter * meter * meter * second * second);
+      return density * gravity + 2.0 * stiffening * depth;
+    }
+  };
+
+  poids::ArrayOf<si::Pressure> makeTargets() {
+    poids::ArrayOf<si::Pressure> targets(count, poids::uninitialized);
+    for (std::size_t i = 0; i < count; ++i) {
+      targets[i] = (10.0 + static_cast<double>(i % 997)) * kilo(pascal);
+    }
+    return targets;
+  }
+
+  const si::Length tolerance = 1e-9 * meter;
+
+  double benchmarkBrent(const poids::ArrayOf<si::Pressure>& targets, poids::ArrayOf<si::Length>& depths) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          const si::Pressure target = targets[i];
+          depths[i] = poids::brent([&](si::Length depth) { return PressureError{}(depth, target); },
+                                   si::Length{0.0 * meter}, si::Length{200.0 * meter}, tolerance)
+                          .root;
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  double benchmarkNewton(const poids::ArrayOf<si::Pressure>& targets, poids::ArrayOf<si::Length>& depths) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+          const si::Pressure target = targets[i];
+          depths[i] = poids::newton([&](si::Length depth) { return PressureError{}(depth, target); },
+                                    [&](si::Length depth) { return PressureSlope{}(depth, target); },
+                                    si::Length{10.0 * meter}, tolerance)
+                          .root;
+        }
+        clobberMemory();
+      }
+    });
+  }
+
+  double benchmarkBisectEach(const poids::ArrayOf<si::Pressure>& targets, poids::ArrayOf<si::Length>& depths) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    const poids::ArrayOf<si::Length> lower(count, 0.0 * meter);
+    const poids::ArrayOf<si::Length> upper(count, 200.0 * meter);
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        poids::bisectEach(PressureError{}, lower, upper, tolerance, depths, targets);
+        clobberMemory();
+      }
+    });
+  }
+
+  double benchmarkNewtonEach(const poids::ArrayOf<si::Pressure>& targets, poids::ArrayOf<si::Length>& depths) {
+    using poids::bench::clobberMemory;
+    using poids::bench::measure;
+
+    const poids::ArrayOf<si::Length> guesses(count, 10.0 * meter);
+    return measure([&] {
+      for (std::size_t r = 0; r < repeats; ++r) {
+        poids::newtonEach(PressureError{}, PressureSlope{}, guesses, tolerance, depths, targets);
+        clobberMemory();
+      }
+    });
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::report;
+
+  const poids::ArrayOf<si::Pressure> targets = makeTargets();
+  poids::ArrayOf<si::Length> depths(count);
+
+  report("Depth at pressure, brent", benchmarkBrent(targets, depths), count * repeats);
+  report("Depth at pressure, newton", benchmarkNewton(targets, depths), count * repeats);
+  report("Depth at pressure, bisectEach", benchmarkBisectEach(targets, depths), count * repeats);
+  report("Depth at pressure, newtonEach", benchmarkNewtonEach(targets, depths), count * repeats);
+
+  return 0;
+}
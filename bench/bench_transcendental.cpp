@@ -0,0 +1,102 @@
+#include <cmath>
+#include <cstddef>
+
+#include "bench_common.hpp"
+#include "poids/math/transcendental.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+int main() {
+  using poids::bench::clobberMemory;
+  using poids::bench::doNotOptimize;
+  using poids::bench::measure;
+  using poids::bench::report;
+
+  const std::size_t count = std::size_t{1} << 12;
+  const std::size_t repeats = 256;
+
+  poids::ArrayOf<si::Angle> angle(count, poids::uninitialized);
+  for (std::size_t i = 0; i < count; ++i) {
+    angle[i] = (0.37 * static_cast<double>(i) - 700.0) * radian;
+  }
+  poids::ArrayOf<si::Unitless> out(count, poids::uninitialized);
+
+  report("std::sin over raw doubles",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             for (std::size_t i = 0; i < count; ++i) {
+               out.data()[i] = std::sin(angle.data()[i]);
+             }
+             clobberMemory();
+           }
+           doNotOptimize(out.data()[count - 1]);
+         }),
+         count * repeats);
+
+  report("poids::sin(ArrayOf<Angle>)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             out = poids::sin(angle);
+             clobberMemory();
+           }
+           doNotOptimize(out.data()[count - 1]);
+         }),
+         count * repeats);
+
+  report("poids::sincos(ArrayOf<Angle>)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             auto [sinAngle, cosAngle] = poids::sincos(angle);
+             doNotOptimize(sinAngle.data()[count - 1]);
+             doNotOptimize(cosAngle.data()[count - 1]);
+           }
+         }),
+         count * repeats);
+
+  report("std::exp over raw doubles",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             for (std::size_t i = 0; i < count; ++i) {
+               out.data()[i] = std::exp(0.5 * angle.data()[i]);
+             }
+             clobberMemory();
+           }
+           doNotOptimize(out.data()[count - 1]);
+         }),
+         count * repeats);
+
+  report("poids::exp(ArrayOf<Unitless> * scale)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             out = poids::exp(angle * 0.5);
+             clobberMemory();
+           }
+           doNotOptimize(out.data()[count - 1]);
+         }),
+         count * repeats);
+
+  report("std::log over raw doubles",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             for (std::size_t i = 0; i < count; ++i) {
+               out.data()[i] = std::log(angle.data()[i] + 701.0);
+             }
+             clobberMemory();
+           }
+           doNotOptimize(out.data()[count - 1]);
+         }),
+         count * repeats);
+
+  const si::Angle offset = 701.0 * radian;
+  report("poids::log(ArrayOf<Unitless> + offset)",
+         measure([&] {
+           for (std::size_t r = 0; r < repeats; ++r) {
+             out = poids::log(angle + offset);
+             clobberMemory();
+           }
+           doNotOptimize(out.data()[count - 1]);
+         }),
+         count * repeats);
+  return 0;
+}
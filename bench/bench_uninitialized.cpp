@@ -0,0 +1,60 @@
+#include <cstddef>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/uninitialized.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t count = std::size_t{1} << 24;
+
+  template <typename Container>
+  void fill(Container& values) {
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<double>(i) * joule;
+    }
+  }
+}  // namespace
+
+int main() {
+  using poids::bench::doNotOptimize;
+  using poids::bench::measure;
+  using poids::bench::report;
+
+  report("std::vector<Energy>(n) + fill",
+         measure([] {
+           std::vector<si::Energy> values(count);
+           fill(values);
+           doNotOptimize(values.back());
+         }),
+         count);
+
+  report("std::vector<Energy, DefaultInitAllocator>(n) + fill",
+         measure([] {
+           std::vector<si::Energy, poids::DefaultInitAllocator<si::Energy>> values(count);
+           fill(values);
+           doNotOptimize(values.back());
+         }),
+         count);
+
+  report("ArrayOf<Energy>(n) + fill",
+         measure([] {
+           poids::ArrayOf<si::Energy> values(count);
+           fill(values);
+           doNotOptimize(values.data()[count - 1]);
+         }),
+         count);
+
+  report("ArrayOf<Energy>(n, uninitialized) + fill",
+         measure([] {
+           poids::ArrayOf<si::Energy> values(count, poids::uninitialized);
+           fill(values);
+           doNotOptimize(values.data()[count - 1]);
+         }),
+         count);
+
+  return 0;
+}
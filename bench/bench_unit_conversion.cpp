@@ -0,0 +1,54 @@
+#include <cstddef>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  /** Converts count forces repeatedly, so small counts measure cache-resident data */
+  void run(std::size_t count, std::size_t repeats) {
+    using poids::bench::clobberMemory;
+    using poids::bench::doNotOptimize;
+    using poids::bench::measure;
+    using poids::bench::report;
+
+    poids::ArrayOf<si::Force> force(count, poids::uninitialized);
+    for (std::size_t i = 0; i < count; ++i) {
+      force[i] = static_cast<double>(i) * newton;
+    }
+    const auto kilonewton = kilo(newton);
+    std::vector<double> out(count);
+
+    report(count < 65536 ? "Quantity::as(kN) per element, in cache" : "Quantity::as(kN) per element, in memory",
+           measure([&] {
+             for (std::size_t r = 0; r < repeats; ++r) {
+               for (std::size_t i = 0; i < count; ++i) {
+                 out[i] = force[i].as(kilonewton);
+               }
+               clobberMemory();
+             }
+             doNotOptimize(out.back());
+           }),
+           count * repeats);
+
+    report(count < 65536 ? "QuantityArray::as(kN, out), in cache" : "QuantityArray::as(kN, out), in memory",
+           measure([&] {
+             for (std::size_t r = 0; r < repeats; ++r) {
+               force.as(kilonewton, out.data());
+               clobberMemory();
+             }
+             doNotOptimize(out.back());
+           }),
+           count * repeats);
+  }
+}  // namespace
+
+int main() {
+  run(std::size_t{1} << 12, 1024);
+  run(std::size_t{1} << 22, 1);
+  return 0;
+}
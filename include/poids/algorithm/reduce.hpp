@@ -0,0 +1,347 @@
+#ifndef POIDS_ALGORITHM_REDUCE_HPP
+#define POIDS_ALGORITHM_REDUCE_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "poids/core/array_expression.hpp"
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/scalar_support/batch_expression.hpp"
+
+namespace poids {
+  /** Sums with several independent accumulators, which breaks the serial dependency
+   * chain so the loop is vectorized and pipelined. Rounding error grows linearly
+   * with the number of elements, as with a naive loop.
+   */
+  struct FastSummation {
+    explicit FastSummation() = default;
+  };
+
+  /** Sums blocks with FastSummation and combines them pairwise. Rounding error grows
+   * with the logarithm of the number of elements, at nearly the same speed.
+   */
+  struct PairwiseSummation {
+    explicit PairwiseSummation() = default;
+  };
+
+  /** Sums with Kahan compensation in each accumulator. The rounding error is
+   * independent of the number of elements, at a few times the cost of FastSummation.
+   * \warning Compensation is optimized away by value-unsafe flags like -ffast-math.
+   */
+  struct KahanSummation {
+    explicit KahanSummation() = default;
+  };
+
+  inline constexpr FastSummation fastSummation{};
+  inline constexpr PairwiseSummation pairwiseSummation{};
+  inline constexpr KahanSummation kahanSummation{};
+
+  namespace detail {
+    /** The number of independent accumulators in reductions */
+    inline constexpr std::size_t ReductionLanes = 4;
+    /** The number of elements summed directly at the leaves of pairwise summation */
+    inline constexpr std::size_t PairwiseBlock = 256;
+
+    using ReductionLaneIndices = std::make_index_sequence<ReductionLanes>;
+
+    // Floating point reductions use explicit Batches rather than relying on the
+    // auto-vectorizer, which at -O3 tends to vectorize the wrong loop of a reduction.
+    // The lanes are indexed with constants in fold expressions so that the compiler
+    // keeps them in registers instead of in memory.
+
+    template <typename Node, std::size_t... K>
+    NodeScalar_t<Node> sumLanes(const Node& node, std::size_t first, std::size_t last, std::index_sequence<K...>) {
+      using Scalar = NodeScalar_t<Node>;
+      constexpr std::size_t Lanes = sizeof...(K);
+      Scalar lanes[Lanes] = {};
+      std::size_t i = first;
+      for (; i + Lanes <= last; i += Lanes) {
+        ((lanes[K] += node(i + K)), ...);
+      }
+      Scalar tail{};
+      for (; i < last; ++i) {
+        tail += node(i);
+      }
+      return (lanes[K] + ...) + tail;
+    }
+
+    template <typename Node, std::size_t... K>
+    NodeScalar_t<Node> sumBatches(const Node& node, std::size_t first, std::size_t last, std::index_sequence<K...>) {
+      using Scalar = NodeScalar_t<Node>;
+      using Lane = NativeBatch<Scalar>;
+      constexpr std::size_t Width = Lane::lanes;
+      constexpr std::size_t Step = Width * sizeof...(K);
+      Lane lanes[sizeof...(K)] = {};
+      std::size_t i = first;
+      for (; i + Step <= last; i += Step) {
+        ((lanes[K] += loadBatch<Scalar, Width>(node, i + K * Width)), ...);
+      }
+      Scalar tail{};
+      for (; i < last; ++i) {
+        tail += node(i);
+      }
+      return (lanes[K] + ...).sum() + tail;
+    }
+
+    template <typename Scalar>
+    void kahanAdd(Scalar& total, Scalar& compensation, const Scalar& value) {
+      const Scalar corrected = value - compensation;
+      const Scalar next = total + corrected;
+      compensation = (next - total) - corrected;
+      total = next;
+    }
+
+    template <typename Node, std::size_t... K>
+    NodeScalar_t<Node> kahanLanes(const Node& node, std::size_t first, std::size_t last, std::index_sequence<K...>) {
+      using Scalar = NodeScalar_t<Node>;
+      constexpr std::size_t Lanes = sizeof...(K);
+      Scalar lanes[Lanes] = {};
+      Scalar compensation[Lanes] = {};
+      std::size_t i = first;
+      for (; i + Lanes <= last; i += Lanes) {
+        (kahanAdd(lanes[K], compensation[K], node(i + K)), ...);
+      }
+      Scalar total{};
+      Scalar totalCompensation{};
+      for (; i < last; ++i) {
+        kahanAdd(total, totalCompensation, node(i));
+      }
+      for (std::size_t k = 0; k < Lanes; ++k) {
+        kahanAdd(total, totalCompensation, lanes[k]);
+        kahanAdd(total, totalCompensation, -compensation[k]);
+      }
+      return total;
+    }
+
+    template <typename Node, std::size_t... K>
+    NodeScalar_t<Node> kahanBatches(const Node& node, std::size_t first, std::size_t last, std::index_sequence<K...>) {
+      using Scalar = NodeScalar_t<Node>;
+      using Lane = NativeBatch<Scalar>;
+      constexpr std::size_t Width = Lane::lanes;
+      constexpr std::size_t Step = Width * sizeof...(K);
+      Lane lanes[sizeof...(K)] = {};
+      Lane compensation[sizeof...(K)] = {};
+      std::size_t i = first;
+      for (; i + Step <= last; i += Step) {
+        (kahanAdd(lanes[K], compensation[K], loadBatch<Scalar, Width>(node, i + K * Width)), ...);
+      }
+      Scalar total{};
+      Scalar totalCompensation{};
+      for (; i < last; ++i) {
+        kahanAdd(total, totalCompensation, node(i));
+      }
+      for (std::size_t k = 0; k < sizeof...(K); ++k) {
+        for (std::size_t j = 0; j < Width; ++j) {
+          kahanAdd(total, totalCompensation, lanes[k][j]);
+          kahanAdd(total, totalCompensation, -compensation[k][j]);
+        }
+      }
+      return total;
+    }
+
+    template <bool Smallest, typename Scalar>
+    Scalar pickExtremum(const Scalar& a, const Scalar& b) {
+      if constexpr (Smallest) {
+        return a < b ? a : b;
+      } else {
+        return a > b ? a : b;
+      }
+    }
+
+    template <bool Smallest, typename Node, std::size_t... K>
+    NodeScalar_t<Node> extremumLanes(const Node& node, std::index_sequence<K...>) {
+      using Scalar = NodeScalar_t<Node>;
+      constexpr std::size_t Lanes = sizeof...(K);
+      const std::size_t count = node.size();
+      assert(count > 0);
+      const Scalar first = node(0);
+      Scalar lanes[Lanes] = {((void)K, first)...};
+      std::size_t i = 0;
+      for (; i + Lanes <= count; i += Lanes) {
+        ((lanes[K] = pickExtremum<Smallest>(node(i + K), lanes[K])), ...);
+      }
+      Scalar result = first;
+      for (; i < count; ++i) {
+        result = pickExtremum<Smallest>(node(i), result);
+      }
+      for (std::size_t k = 0; k < Lanes; ++k) {
+        result = pickExtremum<Smallest>(lanes[k], result);
+      }
+      return result;
+    }
+
+    template <bool Smallest, typename Node, std::size_t... K>
+    NodeScalar_t<Node> extremumBatches(const Node& node, std::index_sequence<K...>) {
+      using Scalar = NodeScalar_t<Node>;
+      using Lane = NativeBatch<Scalar>;
+      constexpr std::size_t Width = Lane::lanes;
+      constexpr std::size_t Step = Width * sizeof...(K);
+      const std::size_t count = node.size();
+      assert(count > 0);
+      const Scalar first = node(0);
+      Lane lanes[sizeof...(K)] = {((void)K, Lane{first})...};
+      std::size_t i = 0;
+      for (; i + Step <= count; i += Step) {
+        if constexpr (Smallest) {
+          ((lanes[K] = min(loadBatch<Scalar, Width>(node, i + K * Width), lanes[K])), ...);
+        } else {
+          ((lanes[K] = max(loadBatch<Scalar, Width>(node, i + K * Width), lanes[K])), ...);
+        }
+      }
+      Scalar result = first;
+      for (; i < count; ++i) {
+        result = pickExtremum<Smallest>(node(i), result);
+      }
+      for (std::size_t k = 0; k < sizeof...(K); ++k) {
+        result = pickExtremum<Smallest>(Smallest ? lanes[k].min() : lanes[k].max(), result);
+      }
+      return result;
+    }
+
+    template <typename Node>
+    NodeScalar_t<Node> sumRange(const Node& node, std::size_t first, std::size_t last, FastSummation) {
+      if constexpr (IsBatchLoadable_v<Node>) {
+        return sumBatches(node, first, last, ReductionLaneIndices{});
+      } else {
+        return sumLanes(node, first, last, ReductionLaneIndices{});
+      }
+    }
+
+    template <typename Node>
+    NodeScalar_t<Node> sumRange(const Node& node, std::size_t first, std::size_t last, PairwiseSummation) {
+      if (last - first <= PairwiseBlock) {
+        return sumRange(node, first, last, fastSummation);
+      }
+      const std::size_t middle = first + (last - first) / 2;
+      return sumRange(node, first, middle, pairwiseSummation) + sumRange(node, middle, last, pairwiseSummation);
+    }
+
+    template <typename Node>
+    NodeScalar_t<Node> sumRange(const Node& node, std::size_t first, std::size_t last, KahanSummation) {
+      if constexpr (IsBatchLoadable_v<Node>) {
+        return kahanBatches(node, first, last, ReductionLaneIndices{});
+      } else {
+        return kahanLanes(node, first, last, ReductionLaneIndices{});
+      }
+    }
+
+    template <bool Smallest, typename Node>
+    NodeScalar_t<Node> extremum(const Node& node) {
+      if constexpr (IsBatchLoadable_v<Node>) {
+        return extremumBatches<Smallest>(node, ReductionLaneIndices{});
+      } else {
+        return extremumLanes<Smallest>(node, ReductionLaneIndices{});
+      }
+    }
+
+    template <typename Range>
+    using ReductionResult_t = Quantity<NodeScalar_t<std::decay_t<decltype(nodeOf(std::declval<const Range&>()))>>,
+                                       typename ArrayOperandOf<Range>::Unit>;
+  }  // namespace detail
+
+  /** Adds together every element of a QuantityArray, QuantitySpan or ArrayExpression.
+   * Expressions are reduced in a single pass, without materializing them.
+   */
+  template <typename Range,
+            typename Summation = FastSummation,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  detail::ReductionResult_t<Range> sum(const Range& range, Summation summation = Summation{}) {
+    const auto& node = detail::nodeOf(range);
+    return detail::ReductionResult_t<Range>::makeFromBaseUnitValue(
+        detail::sumRange(node, 0, node.size(), summation));
+  }
+
+  /** Calculates the arithmetic mean of a non-empty range */
+  template <typename Range,
+            typename Summation = FastSummation,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  detail::ReductionResult_t<Range> mean(const Range& range, Summation summation = Summation{}) {
+    assert(range.size() > 0);
+    return sum(range, summation) / static_cast<ScalarOf_t<detail::ReductionResult_t<Range>>>(range.size());
+  }
+
+  /** Calculates the dot product of two ranges of the same size. The unit of the
+   * result is the product of their units, e.g. Current and Voltage yield Power.
+   */
+  template <typename Lhs,
+            typename Rhs,
+            typename Summation = FastSummation,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Lhs> && detail::IsArrayOperand_v<Rhs>>>
+  auto dot(const Lhs& lhs, const Rhs& rhs, Summation summation = Summation{}) {
+    return sum(lhs * rhs, summation);
+  }
+
+  /** Calculates the euclidean norm of a range, in the units of its elements */
+  template <typename Range,
+            typename Summation = FastSummation,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  detail::ReductionResult_t<Range> norm(const Range& range, Summation summation = Summation{}) {
+    using std::sqrt;
+    return detail::ReductionResult_t<Range>::makeFromBaseUnitValue(sqrt(dot(range, range, summation).base()));
+  }
+
+  /** Calculates the root mean square of a non-empty range, in the units of its elements */
+  template <typename Range,
+            typename Summation = FastSummation,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  detail::ReductionResult_t<Range> rms(const Range& range, Summation summation = Summation{}) {
+    assert(range.size() > 0);
+    using std::sqrt;
+    using Scalar = ScalarOf_t<detail::ReductionResult_t<Range>>;
+    return detail::ReductionResult_t<Range>::makeFromBaseUnitValue(
+        sqrt(dot(range, range, summation).base() / static_cast<Scalar>(range.size())));
+  }
+
+  /** Adds together every element of a range in an Accumulator scalar, e.g. a float
+   * array in double. Elements are converted as they are read, so the range keeps its
+   * narrow storage.
+   */
+  template <typename Accumulator,
+            typename Range,
+            typename Summation = FastSummation,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  auto sumAs(const Range& range, Summation summation = Summation{}) {
+    return sum(scalarCast<Accumulator>(range), summation);
+  }
+
+  /** Calculates the arithmetic mean of a non-empty range in an Accumulator scalar */
+  template <typename Accumulator,
+            typename Range,
+            typename Summation = FastSummation,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  auto meanAs(const Range& range, Summation summation = Summation{}) {
+    assert(range.size() > 0);
+    return sumAs<Accumulator>(range, summation) / static_cast<Accumulator>(range.size());
+  }
+
+  /** Calculates the dot product of two ranges in an Accumulator scalar */
+  template <typename Accumulator,
+            typename Lhs,
+            typename Rhs,
+            typename Summation = FastSummation,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Lhs> && detail::IsArrayOperand_v<Rhs>>>
+  auto dotAs(const Lhs& lhs, const Rhs& rhs, Summation summation = Summation{}) {
+    return sum(scalarCast<Accumulator>(lhs) * scalarCast<Accumulator>(rhs), summation);
+  }
+
+  /** Finds the smallest element of a non-empty range */
+  template <typename Range,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  detail::ReductionResult_t<Range> min(const Range& range) {
+    return detail::ReductionResult_t<Range>::makeFromBaseUnitValue(detail::extremum<true>(detail::nodeOf(range)));
+  }
+
+  /** Finds the largest element of a non-empty range */
+  template <typename Range,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  detail::ReductionResult_t<Range> max(const Range& range) {
+    return detail::ReductionResult_t<Range>::makeFromBaseUnitValue(detail::extremum<false>(detail::nodeOf(range)));
+  }
+}  // namespace poids
+
+#endif
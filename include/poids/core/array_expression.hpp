@@ -0,0 +1,394 @@
+#ifndef POIDS_CORE_ARRAY_EXPRESSION_HPP
+#define POIDS_CORE_ARRAY_EXPRESSION_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "quantity.hpp"
+#include "traits.hpp"
+
+namespace poids {
+  template <typename ScalarType,
+            typename UnitType>
+  class QuantityArray;
+  template <typename ScalarType,
+            typename UnitType>
+  class QuantitySpan;
+  template <typename Node,
+            typename UnitType>
+  class ArrayExpression;
+
+  namespace detail {
+    /** Reads the elements of contiguous memory owned by someone else */
+    template <typename ScalarType>
+    struct ContiguousTerminal {
+      const ScalarType* data;
+      std::size_t count;
+
+      std::size_t size() const { return count; }
+      ScalarType operator()(std::size_t i) const { return data[i]; }
+    };
+
+    /** Reads the elements of strided memory owned by someone else */
+    template <typename ScalarType>
+    struct StridedTerminal {
+      const ScalarType* data;
+      std::size_t count;
+      std::ptrdiff_t stride;
+
+      std::size_t size() const { return count; }
+      ScalarType operator()(std::size_t i) const { return data[static_cast<std::ptrdiff_t>(i) * stride]; }
+    };
+
+    /** Owns a temporary array so that an expression over it cannot dangle */
+    template <typename ScalarType, typename UnitType>
+    struct OwningTerminal {
+      QuantityArray<ScalarType, UnitType> array;
+
+      std::size_t size() const { return array.size(); }
+      ScalarType operator()(std::size_t i) const { return array.data()[i]; }
+    };
+
+    /** Repeats a single value for every element */
+    template <typename ScalarType>
+    struct BroadcastTerminal {
+      ScalarType value;
+
+      ScalarType operator()(std::size_t) const { return value; }
+    };
+
+    template <typename Op, typename Operand>
+    struct UnaryNode {
+      Operand operand;
+      std::size_t count;
+
+      std::size_t size() const { return count; }
+      auto operator()(std::size_t i) const { return Op{}(operand(i)); }
+    };
+
+    /** Converts an element to ScalarType */
+    template <typename ScalarType>
+    struct ScalarCast {
+      template <typename T>
+      ScalarType operator()(const T& value) const { return static_cast<ScalarType>(value); }
+    };
+
+    template <typename Op, typename Lhs, typename Rhs>
+    struct BinaryNode {
+      Lhs lhs;
+      Rhs rhs;
+      std::size_t count;
+
+      std::size_t size() const { return count; }
+      auto operator()(std::size_t i) const { return Op{}(lhs(i), rhs(i)); }
+    };
+
+    /** Describes how a type takes part in array expressions */
+    template <typename T>
+    struct ArrayOperand : public std::false_type { };
+
+    template <typename ScalarType, typename UnitType>
+    struct ArrayOperand<QuantityArray<ScalarType, UnitType>> : public std::true_type {
+      using Unit = UnitType;
+
+      static auto node(const QuantityArray<ScalarType, UnitType>& array) {
+        return ContiguousTerminal<ScalarType>{array.data(), array.size()};
+      }
+      static auto node(QuantityArray<ScalarType, UnitType>&& array) {
+        return OwningTerminal<ScalarType, UnitType>{std::move(array)};
+      }
+    };
+
+    template <typename ScalarType, typename UnitType>
+    struct ArrayOperand<QuantitySpan<ScalarType, UnitType>> : public std::true_type {
+      using Unit = UnitType;
+
+      static auto node(const QuantitySpan<ScalarType, UnitType>& span) {
+        return StridedTerminal<std::remove_const_t<ScalarType>>{span.data(), span.size(), span.stride()};
+      }
+    };
+
+    template <typename Node, typename UnitType>
+    struct ArrayOperand<ArrayExpression<Node, UnitType>> : public std::true_type {
+      using Unit = UnitType;
+
+      static const Node& node(const ArrayExpression<Node, UnitType>& expression) { return expression.node(); }
+      static Node node(ArrayExpression<Node, UnitType>&& expression) { return std::move(expression).node(); }
+    };
+
+    template <typename T>
+    using ArrayOperandOf = ArrayOperand<std::remove_cv_t<std::remove_reference_t<T>>>;
+
+    template <typename T>
+    inline constexpr bool IsArrayOperand_v = ArrayOperandOf<T>::value;
+
+    template <typename T>
+    inline constexpr bool IsPlainScalar_v = !IsQuantity_v<T> && !IsQuantityContainer_v<T>;
+
+    template <typename T>
+    decltype(auto) nodeOf(T&& operand) {
+      return ArrayOperandOf<T>::node(std::forward<T>(operand));
+    }
+
+    template <typename Node>
+    using ElementScalar_t = std::decay_t<decltype(std::declval<const Node&>()(std::size_t{}))>;
+
+    /** The type a broadcast scalar is stored as. It is converted once to the precision
+     * of the result when scalar::PromotionPolicy narrows it.
+     */
+    template <typename ElementScalar, typename ScalarType>
+    using BroadcastScalar_t = PromotedScalar_t<ElementScalar, ScalarType, ScalarType>;
+
+    template <typename Op, typename UnitType, typename Lhs, typename Rhs>
+    auto makeBinary(Lhs&& lhs, Rhs&& rhs) {
+      assert(lhs.size() == rhs.size());
+      const std::size_t count = lhs.size();
+      using Node = BinaryNode<Promoted<Op>, std::decay_t<decltype(nodeOf(std::forward<Lhs>(lhs)))>, std::decay_t<decltype(nodeOf(std::forward<Rhs>(rhs)))>>;
+      return ArrayExpression<Node, UnitType>{Node{nodeOf(std::forward<Lhs>(lhs)), nodeOf(std::forward<Rhs>(rhs)), count}};
+    }
+
+    template <typename Op, typename UnitType, typename Lhs, typename ScalarTypeRHS>
+    auto makeBroadcastRight(Lhs&& lhs, const ScalarTypeRHS& rhs) {
+      const std::size_t count = lhs.size();
+      using LhsNode = std::decay_t<decltype(nodeOf(std::forward<Lhs>(lhs)))>;
+      using Stored = BroadcastScalar_t<ElementScalar_t<LhsNode>, ScalarTypeRHS>;
+      using Node = BinaryNode<Promoted<Op>, LhsNode, BroadcastTerminal<Stored>>;
+      return ArrayExpression<Node, UnitType>{Node{nodeOf(std::forward<Lhs>(lhs)), BroadcastTerminal<Stored>{static_cast<Stored>(rhs)}, count}};
+    }
+
+    template <typename Op, typename UnitType, typename ScalarTypeLHS, typename Rhs>
+    auto makeBroadcastLeft(const ScalarTypeLHS& lhs, Rhs&& rhs) {
+      const std::size_t count = rhs.size();
+      using RhsNode = std::decay_t<decltype(nodeOf(std::forward<Rhs>(rhs)))>;
+      using Stored = BroadcastScalar_t<ElementScalar_t<RhsNode>, ScalarTypeLHS>;
+      using Node = BinaryNode<Promoted<Op>, BroadcastTerminal<Stored>, RhsNode>;
+      return ArrayExpression<Node, UnitType>{Node{BroadcastTerminal<Stored>{static_cast<Stored>(lhs)}, nodeOf(std::forward<Rhs>(rhs)), count}};
+    }
+  }  // namespace detail
+
+  /** A lazily evaluated elementwise expression over arrays of quantities.
+   *
+   * Arithmetic on QuantityArray, QuantitySpan and other expressions builds an
+   * ArrayExpression instead of a temporary array. The unit of the result is checked
+   * at compile-time as the expression is built, and the whole expression is
+   * evaluated in a single fused loop when it is assigned to a QuantityArray.
+   *
+   * \warning An expression refers to the arrays and spans it was built from (except
+   * temporary arrays, which it takes ownership of), so they must outlive it.
+   *
+   * \tparam Node The expression tree, evaluated one element at a time
+   * \tparam UnitType The unit type of every element of the result
+   */
+  template <typename Node,
+            typename UnitType>
+  class ArrayExpression {
+    static_assert(IsValidUnit_v<UnitType>, "The given UnitType is not a valid unit");
+
+   public:
+    /** The scalar type of each element of the result */
+    using Scalar = std::decay_t<decltype(std::declval<const Node&>()(std::size_t{}))>;
+    /** The unit type of each element of the result */
+    using Unit = UnitType;
+
+    using value_type = Quantity<Scalar, Unit>;
+    using size_type = std::size_t;
+
+    explicit ArrayExpression(Node node) :
+        node_(std::move(node)) { }
+
+    /** Returns the number of elements in the result */
+    size_type size() const { return node_.size(); }
+
+    /** Evaluates a single element of the result */
+    value_type operator[](size_type i) const {
+      assert(i < size());
+      return value_type::makeFromBaseUnitValue(node_(i));
+    }
+
+    /** Evaluates the whole expression into a new array */
+    QuantityArray<Scalar, Unit> evaluate() const {
+      return QuantityArray<Scalar, Unit>(*this);
+    }
+
+    /** Evaluates the whole expression into size() raw Scalars in base units at out */
+    template <typename ScalarTypeOut>
+    void evaluateInto(ScalarTypeOut* out) const {
+      const Node& node = node_;
+      const size_type count = size();
+      for (size_type i = 0; i < count; ++i) {
+        out[i] = node(i);
+      }
+    }
+
+    /** Accesses the expression tree */
+    const Node& node() const& { return node_; }
+    Node node() && { return std::move(node_); }
+
+   private:
+    Node node_;
+  };
+
+  template <typename Node, typename UnitType>
+  struct ScalarOf<ArrayExpression<Node, UnitType>> {
+    using type = typename ArrayExpression<Node, UnitType>::Scalar;
+  };
+
+  template <typename Node, typename UnitType>
+  struct UnitOf<ArrayExpression<Node, UnitType>> {
+    using type = UnitType;
+  };
+
+  template <typename Node, typename UnitType>
+  struct IsQuantityContainer<ArrayExpression<Node, UnitType>> : public std::true_type { };
+
+  template <typename Operand,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Operand>>>
+  auto operator-(Operand&& operand) {
+    using Node = detail::UnaryNode<std::negate<>, std::decay_t<decltype(detail::nodeOf(std::forward<Operand>(operand)))>>;
+    const std::size_t count = operand.size();
+    return ArrayExpression<Node, typename detail::ArrayOperandOf<Operand>::Unit>{
+        Node{detail::nodeOf(std::forward<Operand>(operand)), count}};
+  }
+
+  /** Converts every element of an array operand to ScalarType as it is evaluated, e.g.
+   * to store a double expression in a float array, or to sum floats in double
+   * without a converted copy of the array.
+   */
+  template <typename ScalarType, typename Operand,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Operand>>>
+  auto scalarCast(Operand&& operand) {
+    using Node = detail::UnaryNode<detail::ScalarCast<ScalarType>, std::decay_t<decltype(detail::nodeOf(std::forward<Operand>(operand)))>>;
+    const std::size_t count = operand.size();
+    return ArrayExpression<Node, typename detail::ArrayOperandOf<Operand>::Unit>{
+        Node{detail::nodeOf(std::forward<Operand>(operand)), count}};
+  }
+
+  template <typename Lhs, typename Rhs,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Lhs> && detail::IsArrayOperand_v<Rhs>>>
+  auto operator+(Lhs&& lhs, Rhs&& rhs) {
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit;
+    static_assert(std::is_same_v<Unit, typename detail::ArrayOperandOf<Rhs>::Unit>,
+                  "Only arrays of quantities with the same units can be added");
+    return detail::makeBinary<std::plus<>, Unit>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+  }
+
+  template <typename Lhs, typename Rhs,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Lhs> && detail::IsArrayOperand_v<Rhs>>>
+  auto operator-(Lhs&& lhs, Rhs&& rhs) {
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit;
+    static_assert(std::is_same_v<Unit, typename detail::ArrayOperandOf<Rhs>::Unit>,
+                  "Only arrays of quantities with the same units can be subtracted");
+    return detail::makeBinary<std::minus<>, Unit>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+  }
+
+  // A single quantity of any kind, such as an element accessed through ReferenceQuantity,
+  // is broadcast over every element
+
+  template <typename Lhs, typename QuantityRHS,
+            std::enable_if_t<detail::IsArrayOperand_v<Lhs> && IsQuantity_v<QuantityRHS>, int> = 0>
+  auto operator+(Lhs&& lhs, const QuantityRHS& rhs) {
+    using UnitTypeRHS = UnitOf_t<QuantityRHS>;
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit;
+    static_assert(std::is_same_v<Unit, UnitTypeRHS>, "Only quantities with the same units can be added");
+    return detail::makeBroadcastRight<std::plus<>, Unit>(std::forward<Lhs>(lhs), rhs.base());
+  }
+
+  template <typename QuantityLHS, typename Rhs,
+            std::enable_if_t<IsQuantity_v<QuantityLHS> && detail::IsArrayOperand_v<Rhs>, int> = 0>
+  auto operator+(const QuantityLHS& lhs, Rhs&& rhs) {
+    using UnitTypeLHS = UnitOf_t<QuantityLHS>;
+    using Unit = typename detail::ArrayOperandOf<Rhs>::Unit;
+    static_assert(std::is_same_v<Unit, UnitTypeLHS>, "Only quantities with the same units can be added");
+    return detail::makeBroadcastLeft<std::plus<>, Unit>(lhs.base(), std::forward<Rhs>(rhs));
+  }
+
+  template <typename Lhs, typename QuantityRHS,
+            std::enable_if_t<detail::IsArrayOperand_v<Lhs> && IsQuantity_v<QuantityRHS>, int> = 0>
+  auto operator-(Lhs&& lhs, const QuantityRHS& rhs) {
+    using UnitTypeRHS = UnitOf_t<QuantityRHS>;
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit;
+    static_assert(std::is_same_v<Unit, UnitTypeRHS>, "Only quantities with the same units can be subtracted");
+    return detail::makeBroadcastRight<std::minus<>, Unit>(std::forward<Lhs>(lhs), rhs.base());
+  }
+
+  template <typename QuantityLHS, typename Rhs,
+            std::enable_if_t<IsQuantity_v<QuantityLHS> && detail::IsArrayOperand_v<Rhs>, int> = 0>
+  auto operator-(const QuantityLHS& lhs, Rhs&& rhs) {
+    using UnitTypeLHS = UnitOf_t<QuantityLHS>;
+    using Unit = typename detail::ArrayOperandOf<Rhs>::Unit;
+    static_assert(std::is_same_v<Unit, UnitTypeLHS>, "Only quantities with the same units can be subtracted");
+    return detail::makeBroadcastLeft<std::minus<>, Unit>(lhs.base(), std::forward<Rhs>(rhs));
+  }
+
+  template <typename Lhs, typename Rhs,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Lhs> && detail::IsArrayOperand_v<Rhs>>>
+  auto operator*(Lhs&& lhs, Rhs&& rhs) {
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit::template multiply_t<typename detail::ArrayOperandOf<Rhs>::Unit>;
+    return detail::makeBinary<std::multiplies<>, Unit>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+  }
+
+  template <typename Lhs, typename Rhs,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Lhs> && detail::IsArrayOperand_v<Rhs>>>
+  auto operator/(Lhs&& lhs, Rhs&& rhs) {
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit::template divide_t<typename detail::ArrayOperandOf<Rhs>::Unit>;
+    return detail::makeBinary<std::divides<>, Unit>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+  }
+
+  template <typename Lhs, typename QuantityRHS,
+            std::enable_if_t<detail::IsArrayOperand_v<Lhs> && IsQuantity_v<QuantityRHS>, int> = 0>
+  auto operator*(Lhs&& lhs, const QuantityRHS& rhs) {
+    using UnitTypeRHS = UnitOf_t<QuantityRHS>;
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit::template multiply_t<UnitTypeRHS>;
+    return detail::makeBroadcastRight<std::multiplies<>, Unit>(std::forward<Lhs>(lhs), rhs.base());
+  }
+
+  template <typename QuantityLHS, typename Rhs,
+            std::enable_if_t<IsQuantity_v<QuantityLHS> && detail::IsArrayOperand_v<Rhs>, int> = 0>
+  auto operator*(const QuantityLHS& lhs, Rhs&& rhs) {
+    using UnitTypeLHS = UnitOf_t<QuantityLHS>;
+    using Unit = typename UnitTypeLHS::template multiply_t<typename detail::ArrayOperandOf<Rhs>::Unit>;
+    return detail::makeBroadcastLeft<std::multiplies<>, Unit>(lhs.base(), std::forward<Rhs>(rhs));
+  }
+
+  template <typename Lhs, typename QuantityRHS,
+            std::enable_if_t<detail::IsArrayOperand_v<Lhs> && IsQuantity_v<QuantityRHS>, int> = 0>
+  auto operator/(Lhs&& lhs, const QuantityRHS& rhs) {
+    using UnitTypeRHS = UnitOf_t<QuantityRHS>;
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit::template divide_t<UnitTypeRHS>;
+    return detail::makeBroadcastRight<std::divides<>, Unit>(std::forward<Lhs>(lhs), rhs.base());
+  }
+
+  template <typename QuantityLHS, typename Rhs,
+            std::enable_if_t<IsQuantity_v<QuantityLHS> && detail::IsArrayOperand_v<Rhs>, int> = 0>
+  auto operator/(const QuantityLHS& lhs, Rhs&& rhs) {
+    using UnitTypeLHS = UnitOf_t<QuantityLHS>;
+    using Unit = typename UnitTypeLHS::template divide_t<typename detail::ArrayOperandOf<Rhs>::Unit>;
+    return detail::makeBroadcastLeft<std::divides<>, Unit>(lhs.base(), std::forward<Rhs>(rhs));
+  }
+
+  template <typename Lhs, typename ScalarTypeRHS,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Lhs> && detail::IsPlainScalar_v<ScalarTypeRHS>>>
+  auto operator*(Lhs&& lhs, const ScalarTypeRHS& rhs) {
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit;
+    return detail::makeBroadcastRight<std::multiplies<>, Unit>(std::forward<Lhs>(lhs), rhs);
+  }
+
+  template <typename ScalarTypeLHS, typename Rhs,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Rhs> && detail::IsPlainScalar_v<ScalarTypeLHS>>>
+  auto operator*(const ScalarTypeLHS& lhs, Rhs&& rhs) {
+    using Unit = typename detail::ArrayOperandOf<Rhs>::Unit;
+    return detail::makeBroadcastLeft<std::multiplies<>, Unit>(lhs, std::forward<Rhs>(rhs));
+  }
+
+  template <typename Lhs, typename ScalarTypeRHS,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Lhs> && detail::IsPlainScalar_v<ScalarTypeRHS>>>
+  auto operator/(Lhs&& lhs, const ScalarTypeRHS& rhs) {
+    using Unit = typename detail::ArrayOperandOf<Lhs>::Unit;
+    return detail::makeBroadcastRight<std::divides<>, Unit>(std::forward<Lhs>(lhs), rhs);
+  }
+}  // namespace poids
+
+#endif
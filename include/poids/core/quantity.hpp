@@ -3,10 +3,12 @@
 
 #include <cmath>
 #include <functional>
+#include <numeric>
 
 #include "quantity_base.hpp"
 #include "scalar_support.hpp"
 #include "traits.hpp"
+#include "uninitialized.hpp"
 
 namespace poids {
   /** A quantity with a value and units.
@@ -53,7 +55,15 @@ namespace poids {
     /** The base type of this Quantity */
     using BaseType = Quantity<Scalar, Unit, true>;
 
-    Quantity() = default;
+    /** Constructs a zero-valued Quantity */
+    constexpr Quantity() :
+        value_{} { }
+
+    /** Constructs a Quantity with a default-initialized value, which is
+     * indeterminate for arithmetic Scalars.
+     * \warning The value must be assigned before it is read.
+     */
+    explicit Quantity(Uninitialized) { }
 
     constexpr explicit Quantity(const Scalar& baseValue) :
         value_(baseValue) {
@@ -115,7 +125,7 @@ namespace poids {
     }
 
    private:
-    Scalar value_{}; /**< The Scalar value of this quantity in base units. */
+    Scalar value_; /**< The Scalar value of this quantity in base units. */
 
     constexpr Quantity(const Scalar& baseValue, InternalTag) :
         value_{baseValue} { }
@@ -127,8 +137,9 @@ namespace poids {
     template <typename ScalarTypeRHS>
     auto doScalarMultiply(const ScalarTypeRHS& rhs) const {
       using Result = Quantity<detail::MultiplyResult_t<Scalar, ScalarTypeRHS>, Unit, false>;
+      using ResultScalar = typename Result::Scalar;
       return Result{typename Result::InternalTag{},
-                    value_ * rhs};
+                    detail::promoteOperand<ResultScalar>(value_) * detail::promoteOperand<ResultScalar>(rhs)};
     }
 
     constexpr friend auto operator-(const Type& rhs) {
@@ -146,7 +157,9 @@ namespace poids {
       using Result = Quantity<detail::AddResult_t<Scalar, ScalarTypeRHS>,
                               Unit,
                               IsBase && IsBaseRHS>;
-      return Result::makeFromBaseUnitValue(lhs.data() + rhs.data());
+      using ResultScalar = typename Result::Scalar;
+      return Result::makeFromBaseUnitValue(detail::promoteOperand<ResultScalar>(lhs.data()) +
+                                           detail::promoteOperand<ResultScalar>(rhs.data()));
     }
 
     template <typename ScalarTypeRHS, bool IsBaseRHS>
@@ -154,7 +167,9 @@ namespace poids {
       using Result = Quantity<detail::SubtractResult_t<Scalar, ScalarTypeRHS>,
                               Unit,
                               IsBase && IsBaseRHS>;
-      return Result::makeFromBaseUnitValue(lhs.data() - rhs.data());
+      using ResultScalar = typename Result::Scalar;
+      return Result::makeFromBaseUnitValue(detail::promoteOperand<ResultScalar>(lhs.data()) -
+                                           detail::promoteOperand<ResultScalar>(rhs.data()));
     }
 
     template <typename ScalarTypeRHS, typename UnitTypeRHS, bool IsBaseRHS>
@@ -163,20 +178,22 @@ namespace poids {
                               typename Unit::template multiply_t<UnitTypeRHS>,
                               IsBase && IsBaseRHS>;
 
-      return Result::makeFromBaseUnitValue(lhs.base() * rhs.base());
+      using ResultScalar = typename Result::Scalar;
+      return Result::makeFromBaseUnitValue(detail::promoteOperand<ResultScalar>(lhs.base()) *
+                                           detail::promoteOperand<ResultScalar>(rhs.base()));
     }
 
-    template <typename ScalarTypeRHS>
+    template <typename ScalarTypeRHS,
+              typename = std::enable_if_t<!IsQuantity_v<ScalarTypeRHS> && !IsQuantityContainer_v<ScalarTypeRHS>>>
     constexpr friend auto operator*(const Type& lhs, const ScalarTypeRHS& rhs)
-        -> std::enable_if_t<!IsQuantity_v<ScalarTypeRHS>,
-                            decltype(std::declval<Type>().doScalarMultiply(std::declval<ScalarTypeRHS>()))> {
+        -> decltype(std::declval<Type>().doScalarMultiply(std::declval<ScalarTypeRHS>())) {
       return lhs.doScalarMultiply(rhs);
     }
 
-    template <typename ScalarTypeLHS>
+    template <typename ScalarTypeLHS,
+              typename = std::enable_if_t<!IsQuantity_v<ScalarTypeLHS> && !IsQuantityContainer_v<ScalarTypeLHS>>>
     constexpr friend auto operator*(const ScalarTypeLHS& lhs, const Type& rhs)
-        -> std::enable_if_t<!IsQuantity_v<ScalarTypeLHS>,
-                            decltype(std::declval<Type>().doScalarMultiply(std::declval<ScalarTypeLHS>()))> {
+        -> decltype(std::declval<Type>().doScalarMultiply(std::declval<ScalarTypeLHS>())) {
       return rhs.doScalarMultiply(lhs);
     }
 
@@ -186,7 +203,9 @@ namespace poids {
                               typename Unit::template divide_t<UnitTypeRHS>,
                               IsBase && IsBaseRHS>;
 
-      return Result::makeFromBaseUnitValue(lhs.data() / rhs.data());
+      using ResultScalar = typename Result::Scalar;
+      return Result::makeFromBaseUnitValue(detail::promoteOperand<ResultScalar>(lhs.data()) /
+                                           detail::promoteOperand<ResultScalar>(rhs.data()));
     }
 
     constexpr friend auto operator/(const Type& lhs, const Scalar& rhs) {
@@ -242,34 +261,36 @@ namespace poids {
       return oldValue;
     }
 
+    // Comparisons return whatever the Scalar comparison returns, e.g. a lane mask for SIMD batches
+
     template <bool OtherBase>
-    friend bool operator==(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
+    friend auto operator==(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
       return lhs.data() == rhs.data();
     }
 
     template <bool OtherBase>
-    friend bool operator!=(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
+    friend auto operator!=(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
       return !(lhs == rhs);
     }
 
     template <bool OtherBase>
-    friend bool operator<(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
+    friend auto operator<(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
       return lhs.data() < rhs.data();
     }
 
     template <bool OtherBase>
-    friend bool operator>(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
+    friend auto operator>(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
       return rhs < lhs;
     }
 
     template <bool OtherBase>
-    friend bool operator<=(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
-      return lhs == rhs || lhs < rhs;
+    friend auto operator<=(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
+      return lhs.data() <= rhs.data();
     }
 
     template <bool OtherBase>
-    friend bool operator>=(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
-      return lhs == rhs || rhs < lhs;
+    friend auto operator>=(const Type& lhs, const Quantity<Scalar, Unit, OtherBase>& rhs) {
+      return rhs <= lhs;
     }
 
     template <typename, typename, bool>
@@ -304,6 +325,18 @@ namespace poids {
   template <typename ScalarType, typename UnitType>
   Quantity(BaseQuantity<ScalarType, UnitType>) -> Quantity<ScalarType, UnitType>;
 
+  /** Indicates if QuantityType has exactly the same layout as its Scalar, so a
+   * contiguous sequence of quantities may be viewed as a sequence of Scalars
+   */
+  template <typename QuantityType>
+  struct IsLayoutCompatible
+      : public std::bool_constant<sizeof(QuantityType) == sizeof(ScalarOf_t<QuantityType>) &&
+                                  alignof(QuantityType) == alignof(ScalarOf_t<QuantityType>) &&
+                                  std::is_standard_layout_v<QuantityType>> { };
+
+  template <typename QuantityType>
+  inline constexpr bool IsLayoutCompatible_v = IsLayoutCompatible<QuantityType>::value;
+
   template <typename ScalarType, typename UnitType>
   constexpr BaseQuantity<ScalarType, UnitType> makeBase(const ScalarType& scalar) {
     return BaseQuantity<ScalarType, UnitType>{scalar,
@@ -315,13 +348,70 @@ namespace poids {
     return makeBase<ScalarOf_t<QuantityType>, UnitOf_t<QuantityType>>(scalar);
   }
 
+  namespace detail {
+    /** Raises x to the power N with a chain of multiplications found by squaring */
+    template <unsigned N, typename ScalarType>
+    constexpr ScalarType powUnsigned(const ScalarType& x) {
+      using Traits = scalar::PowerTraits<ScalarType>;
+      if constexpr (N == 0) {
+        return Traits::one(x);
+      } else if constexpr (N == 1) {
+        return x;
+      } else if constexpr (N % 2 == 0) {
+        const ScalarType half = powUnsigned<N / 2>(x);
+        return Traits::multiply(half, half);
+      } else {
+        return Traits::multiply(powUnsigned<N - 1>(x), x);
+      }
+    }
+
+    /** Takes the D-th root of x for D up to 3 */
+    template <unsigned D, typename ScalarType>
+    constexpr ScalarType rootScalar(const ScalarType& x) {
+      using Traits = scalar::PowerTraits<ScalarType>;
+      if constexpr (D == 1) {
+        return x;
+      } else if constexpr (D == 2) {
+        return Traits::squareRoot(x);
+      } else {
+        static_assert(D == 3, "Only square and cube roots have dedicated implementations");
+        return Traits::cubeRoot(x);
+      }
+    }
+
+    /** Raises x to the power N/D, selecting the cheapest evaluation at compile time:
+     * multiplications for integer exponents, sqrt or cbrt for halves and thirds, a
+     * single reciprocal for negative exponents and the generic pow otherwise.
+     */
+    template <int N, unsigned D, typename ScalarType>
+    constexpr ScalarType powScalar(const ScalarType& x) {
+      static_assert(D > 0, "The denominator of an exponent must be positive");
+      using Traits = scalar::PowerTraits<ScalarType>;
+      constexpr unsigned Magnitude = N < 0 ? static_cast<unsigned>(-N) : static_cast<unsigned>(N);
+      constexpr unsigned Divisor = std::gcd(Magnitude, D);
+      constexpr unsigned Numerator = Magnitude / Divisor;
+      constexpr unsigned Denominator = D / Divisor;
+
+      if constexpr (Denominator > 3) {
+        return Traits::power(x, static_cast<double>(N) / D);
+      } else {
+        const ScalarType result = powUnsigned<Numerator>(rootScalar<Denominator>(x));
+        if constexpr (N < 0) {
+          return Traits::reciprocal(result);
+        } else {
+          return result;
+        }
+      }
+    }
+  }  // namespace detail
+
+  /** Raises a quantity to the rational power N/D, with exponents resolved at compile time */
   template <int N, unsigned D, typename ScalarType, typename UnitType, bool IsBase>
   constexpr auto pow(const Quantity<ScalarType, UnitType, IsBase>& x) {
     using Result = Quantity<ScalarType,
                             PowerOf_t<UnitType, N, D>,
                             IsBase>;
-    using std::pow;
-    return Result::makeFromBaseUnitValue(pow(x.value_, static_cast<double>(N) / D));
+    return Result::makeFromBaseUnitValue(detail::powScalar<N, D>(x.value_));
   }
 
   template <typename ScalarType, typename UnitType, bool IsBase>
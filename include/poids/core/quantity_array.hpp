@@ -0,0 +1,309 @@
+#ifndef POIDS_CORE_QUANTITY_ARRAY_HPP
+#define POIDS_CORE_QUANTITY_ARRAY_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "array_expression.hpp"
+#include "quantity.hpp"
+#include "quantity_iterator.hpp"
+#include "reference.hpp"
+#include "traits.hpp"
+#include "uninitialized.hpp"
+#include "unit_conversion.hpp"
+
+namespace poids {
+  template <typename ScalarType,
+            typename UnitType>
+  class QuantityArray;
+
+  /** A contiguous, owning array of quantities which all share one unit.
+   *
+   * Values are stored as raw Scalars in base units, so whole-array operations run
+   * as simple loops over contiguous memory which the compiler can vectorize. Units
+   * are still enforced at compile-time: elements are accessed through
+   * ReferenceQuantity, and whole-array arithmetic builds an ArrayExpression of the
+   * correct resulting unit which is evaluated in a single loop on assignment.
+   *
+   * \tparam ScalarType The type of the scalar of each element
+   * \tparam UnitType The unit type shared by every element
+   */
+  template <typename ScalarType,
+            typename UnitType>
+  class QuantityArray {
+    static_assert(!std::is_reference_v<ScalarType>, "QuantityArray requires a non-reference ScalarType");
+    static_assert(!std::is_const_v<ScalarType>, "QuantityArray requires a non-const ScalarType");
+    static_assert(IsValidUnit_v<UnitType>, "The given UnitType is not a valid unit");
+
+   public:
+    /** Raw values in base units, as taken by makeFromBaseUnitValues and returned by as */
+    using Storage = std::vector<ScalarType>;
+    /** Raw values in base units held exactly as the array holds them, so that
+     * makeFromBaseUnitValues takes them over without copying. Its elements are only
+     * zeroed when explicitly requested.
+     */
+    using Buffer = std::vector<ScalarType, DefaultInitAllocator<ScalarType>>;
+    /** The scalar type of each element */
+    using Scalar = ScalarType;
+    /** The unit type of each element */
+    using Unit = UnitType;
+    /** Identity of this QuantityArray */
+    using Type = QuantityArray<Scalar, Unit>;
+
+    using value_type = Quantity<Scalar, Unit>;
+    using reference = ReferenceQuantity<Scalar, Unit>;
+    using const_reference = value_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = detail::QuantityIterator<Scalar, Unit>;
+    using const_iterator = detail::QuantityIterator<const Scalar, Unit>;
+
+    QuantityArray() = default;
+
+    /** Constructs an array of count zero-valued elements */
+    explicit QuantityArray(size_type count) :
+        values_(count, Scalar{}) { }
+
+    /** Constructs an array of count elements without zeroing them.
+     * \warning Every element must be assigned before it is read.
+     */
+    QuantityArray(size_type count, Uninitialized) :
+        values_(count) { }
+
+    /** Constructs an array of count copies of value */
+    template <bool IsBase>
+    QuantityArray(size_type count, const Quantity<Scalar, Unit, IsBase>& value) :
+        values_(count, value.base()) { }
+
+    QuantityArray(std::initializer_list<value_type> values) {
+      values_.reserve(values.size());
+      for (const auto& value : values) {
+        values_.push_back(value.base());
+      }
+    }
+
+    /** Constructs an array from a range of quantities */
+    template <typename InputIt,
+              typename = std::enable_if_t<IsQuantity_v<typename std::iterator_traits<InputIt>::value_type>>>
+    QuantityArray(InputIt first, InputIt last) {
+      for (; first != last; ++first) {
+        values_.push_back(value_type{*first}.base());
+      }
+    }
+
+    /** Constructs an array by evaluating an expression over other arrays in a single loop */
+    template <typename Node>
+    /*implicit*/ QuantityArray(const ArrayExpression<Node, Unit>& expression) :
+        values_(expression.size()) {
+      expression.evaluateInto(data());
+    }
+
+    /** Constructs a QuantityArray by copying the given values in base units.
+     * Large inputs should be filled into a Buffer instead, which is moved in.
+     */
+    static Type makeFromBaseUnitValues(const Storage& values) {
+      Type result;
+      result.values_.assign(values.begin(), values.end());
+      return result;
+    }
+
+    /** Constructs a QuantityArray taking ownership of the given values in base units */
+    static Type makeFromBaseUnitValues(Buffer&& values) {
+      Type result;
+      result.values_ = std::move(values);
+      return result;
+    }
+
+    static Type makeFromBaseUnitValues(std::initializer_list<Scalar> values) {
+      Type result;
+      result.values_.assign(values.begin(), values.end());
+      return result;
+    }
+
+    /** Constructs an array from count raw values expressed in the given unit.
+     * The unit is applied with a single multiplication per element.
+     */
+    template <typename ScalarTypeOther>
+    static Type from(const Scalar* values, size_type count, const BaseQuantity<ScalarTypeOther, Unit>& unit) {
+      Type result(count, uninitialized);
+      detail::scaleInto(values, count, 1, static_cast<detail::ConversionFactor_t<Scalar, ScalarTypeOther>>(unit.value()),
+                        result.data());
+      return result;
+    }
+
+    /** Evaluates an expression over other arrays into this array in a single loop.
+     * The expression may refer to this array.
+     */
+    template <typename Node>
+    Type& operator=(const ArrayExpression<Node, Unit>& expression) {
+      if (size() == expression.size()) {
+        expression.evaluateInto(data());
+      } else {
+        Buffer values(expression.size());
+        expression.evaluateInto(values.data());
+        values_.swap(values);
+      }
+      return *this;
+    }
+
+    /** Accesses an element in-place */
+    reference operator[](size_type i) {
+      assert(i < size());
+      return reference::makeReference(values_[i]);
+    }
+
+    /** Accesses the value of an element */
+    const_reference operator[](size_type i) const {
+      assert(i < size());
+      return const_reference::makeFromBaseUnitValue(values_[i]);
+    }
+
+    /** Gets every value in the desired units.
+     * The reciprocal of the unit is computed once, so each element costs a single
+     * multiplication instead of a division. The result may differ from
+     * Quantity::as in the last bit. The returned vector is zeroed before it is
+     * written, which the overload writing to a caller's buffer avoids.
+     */
+    template <typename ScalarTypeOther>
+    Storage as(const BaseQuantity<ScalarTypeOther, Unit>& desired) const {
+      Storage result(size());
+      as(desired, result.data());
+      return result;
+    }
+
+    /** Writes every value in the desired units to out, which must hold size() Scalars */
+    template <typename ScalarTypeOther>
+    void as(const BaseQuantity<ScalarTypeOther, Unit>& desired, Scalar* out) const {
+      using Factor = detail::ConversionFactor_t<Scalar, ScalarTypeOther>;
+      detail::scaleInto(data(), size(), 1, static_cast<Factor>(ScalarTypeOther{1} / desired.value()), out);
+    }
+
+    /** Returns the number of elements in the array */
+    size_type size() const { return values_.size(); }
+    /** Indicates if the array has no elements */
+    bool empty() const { return values_.empty(); }
+
+    /** Resizes the array, filling any new elements with zero */
+    void resize(size_type count) { values_.resize(count, Scalar{}); }
+    /** Resizes the array, leaving any new elements unzeroed
+     * \warning Every new element must be assigned before it is read.
+     */
+    void resize(size_type count, Uninitialized) { values_.resize(count); }
+    /** Resizes the array, filling any new elements with value */
+    template <bool IsBase>
+    void resize(size_type count, const Quantity<Scalar, Unit, IsBase>& value) { values_.resize(count, value.base()); }
+    void reserve(size_type count) { values_.reserve(count); }
+    void clear() { values_.clear(); }
+
+    template <bool IsBase>
+    void push_back(const Quantity<Scalar, Unit, IsBase>& value) { values_.push_back(value.base()); }
+
+    /** Sets every element to value */
+    template <bool IsBase>
+    void fill(const Quantity<Scalar, Unit, IsBase>& value) {
+      Scalar* out = data();
+      const Scalar fillValue = value.base();
+      for (size_type i = 0; i < size(); ++i) {
+        out[i] = fillValue;
+      }
+    }
+
+    /** Returns a raw pointer to the underlying scalar values in base units.
+     * \warning Modifying the values through this pointer circumvents the guarantees
+     * provided by the library. Use only with great caution.
+     */
+    Scalar* data() { return values_.data(); }
+    const Scalar* data() const { return values_.data(); }
+
+    iterator begin() { return iterator{data()}; }
+    iterator end() { return iterator{data(), 1, static_cast<difference_type>(size())}; }
+    const_iterator begin() const { return const_iterator{data()}; }
+    const_iterator end() const { return const_iterator{data(), 1, static_cast<difference_type>(size())}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    template <typename Expression,
+              typename = std::enable_if_t<detail::IsArrayOperand_v<Expression>>>
+    Type& operator+=(const Expression& rhs) {
+      static_assert(std::is_same_v<Unit, UnitOf_t<Expression>>,
+                    "Only arrays of quantities with the same units can be added");
+      assert(size() == rhs.size());
+      const auto& in = detail::nodeOf(rhs);
+      Scalar* out = data();
+      for (size_type i = 0; i < size(); ++i) {
+        out[i] += in(i);
+      }
+      return *this;
+    }
+
+    template <typename Expression,
+              typename = std::enable_if_t<detail::IsArrayOperand_v<Expression>>>
+    Type& operator-=(const Expression& rhs) {
+      static_assert(std::is_same_v<Unit, UnitOf_t<Expression>>,
+                    "Only arrays of quantities with the same units can be subtracted");
+      assert(size() == rhs.size());
+      const auto& in = detail::nodeOf(rhs);
+      Scalar* out = data();
+      for (size_type i = 0; i < size(); ++i) {
+        out[i] -= in(i);
+      }
+      return *this;
+    }
+
+    template <typename ScalarTypeRHS>
+    auto operator*=(const ScalarTypeRHS& rhs)
+        -> std::enable_if_t<!IsQuantity_v<ScalarTypeRHS> && !IsQuantityContainer_v<ScalarTypeRHS>, Type&> {
+      Scalar* out = data();
+      for (size_type i = 0; i < size(); ++i) {
+        out[i] *= rhs;
+      }
+      return *this;
+    }
+
+    template <typename ScalarTypeRHS>
+    auto operator/=(const ScalarTypeRHS& rhs)
+        -> std::enable_if_t<!IsQuantity_v<ScalarTypeRHS> && !IsQuantityContainer_v<ScalarTypeRHS>, Type&> {
+      Scalar* out = data();
+      for (size_type i = 0; i < size(); ++i) {
+        out[i] /= rhs;
+      }
+      return *this;
+    }
+
+   private:
+    Buffer values_; /**< The values in base units */
+
+    friend Type operator+(const Type& rhs) {
+      return rhs;
+    }
+
+    template <typename, typename>
+    friend class QuantityArray;
+  };
+
+  template <typename Node, typename UnitType>
+  QuantityArray(const ArrayExpression<Node, UnitType>&) -> QuantityArray<typename ArrayExpression<Node, UnitType>::Scalar, UnitType>;
+
+  template <typename ScalarType, typename UnitType>
+  struct ScalarOf<QuantityArray<ScalarType, UnitType>> {
+    using type = ScalarType;
+  };
+
+  template <typename ScalarType, typename UnitType>
+  struct UnitOf<QuantityArray<ScalarType, UnitType>> {
+    using type = UnitType;
+  };
+
+  template <typename ScalarType, typename UnitType>
+  struct IsQuantityContainer<QuantityArray<ScalarType, UnitType>> : public std::true_type { };
+
+  /** An array of quantities with the same Scalar and Unit as QuantityType */
+  template <typename QuantityType>
+  using ArrayOf = QuantityArray<ScalarOf_t<QuantityType>, UnitOf_t<QuantityType>>;
+}  // namespace poids
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef POIDS_CORE_QUANTITY_ITERATOR_HPP
+#define POIDS_CORE_QUANTITY_ITERATOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "quantity.hpp"
+#include "reference.hpp"
+
+namespace poids {
+  namespace detail {
+    /** Random access iterator over raw Scalars which yields quantities.
+     *
+     * Dereferencing yields a ReferenceQuantity when ScalarType is mutable, and a
+     * Quantity by value when ScalarType is const. Consecutive elements are stride
+     * Scalars apart. The iterator holds the first Scalar and an element index, so
+     * that the end of a strided range never forms a pointer beyond its buffer.
+     */
+    template <typename ScalarType, typename UnitType>
+    class QuantityIterator {
+      using ValueScalar = std::remove_const_t<ScalarType>;
+
+     public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = Quantity<ValueScalar, UnitType>;
+      using difference_type = std::ptrdiff_t;
+      using reference = std::conditional_t<std::is_const_v<ScalarType>,
+                                           value_type,
+                                           ReferenceQuantity<ValueScalar, UnitType>>;
+      using pointer = void;
+
+      QuantityIterator() = default;
+      explicit QuantityIterator(ScalarType* first, difference_type stride = 1, difference_type index = 0) :
+          first_(first), index_(index), stride_(stride) { }
+
+      /** Allows conversion from a mutable iterator to a const iterator */
+      template <typename ScalarTypeOther,
+                typename = std::enable_if_t<std::is_same_v<const ScalarTypeOther, ScalarType>>>
+      /*implicit*/ QuantityIterator(const QuantityIterator<ScalarTypeOther, UnitType>& other) :
+          first_(other.first_), index_(other.index_), stride_(other.stride_) { }
+
+      reference operator*() const {
+        if constexpr (std::is_const_v<ScalarType>) {
+          return value_type::makeFromBaseUnitValue(*base());
+        } else {
+          return reference::makeReference(*base());
+        }
+      }
+      reference operator[](difference_type n) const { return *(*this + n); }
+
+      QuantityIterator& operator++() {
+        ++index_;
+        return *this;
+      }
+      QuantityIterator operator++(int) {
+        QuantityIterator old = *this;
+        ++index_;
+        return old;
+      }
+      QuantityIterator& operator--() {
+        --index_;
+        return *this;
+      }
+      QuantityIterator operator--(int) {
+        QuantityIterator old = *this;
+        --index_;
+        return old;
+      }
+      QuantityIterator& operator+=(difference_type n) {
+        index_ += n;
+        return *this;
+      }
+      QuantityIterator& operator-=(difference_type n) {
+        index_ -= n;
+        return *this;
+      }
+
+      /** Accesses the underlying Scalar this iterator points to, which must be an element */
+      ScalarType* base() const { return first_ + index_ * stride_; }
+      /** The distance between consecutive elements, in Scalars */
+      difference_type stride() const { return stride_; }
+
+     private:
+      ScalarType* first_ = nullptr;
+      difference_type index_ = 0;
+      difference_type stride_ = 1;
+
+      // Iterators are only compared within one range, so their indices suffice
+
+      friend QuantityIterator operator+(QuantityIterator it, difference_type n) { return it += n; }
+      friend QuantityIterator operator+(difference_type n, QuantityIterator it) { return it += n; }
+      friend QuantityIterator operator-(QuantityIterator it, difference_type n) { return it -= n; }
+      friend difference_type operator-(const QuantityIterator& lhs, const QuantityIterator& rhs) {
+        return lhs.index_ - rhs.index_;
+      }
+
+      friend bool operator==(const QuantityIterator& lhs, const QuantityIterator& rhs) { return lhs.index_ == rhs.index_; }
+      friend bool operator!=(const QuantityIterator& lhs, const QuantityIterator& rhs) { return lhs.index_ != rhs.index_; }
+      friend bool operator<(const QuantityIterator& lhs, const QuantityIterator& rhs) { return lhs.index_ < rhs.index_; }
+      friend bool operator>(const QuantityIterator& lhs, const QuantityIterator& rhs) { return lhs.index_ > rhs.index_; }
+      friend bool operator<=(const QuantityIterator& lhs, const QuantityIterator& rhs) { return lhs.index_ <= rhs.index_; }
+      friend bool operator>=(const QuantityIterator& lhs, const QuantityIterator& rhs) { return lhs.index_ >= rhs.index_; }
+
+      template <typename, typename>
+      friend class QuantityIterator;
+    };
+  }  // namespace detail
+}  // namespace poids
+
+#endif
@@ -0,0 +1,196 @@
+#ifndef POIDS_CORE_QUANTITY_SPAN_HPP
+#define POIDS_CORE_QUANTITY_SPAN_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "quantity.hpp"
+#include "quantity_array.hpp"
+#include "quantity_iterator.hpp"
+#include "reference.hpp"
+#include "traits.hpp"
+#include "unit_conversion.hpp"
+
+namespace poids {
+  /** A non-owning view of quantities stored as raw Scalars in base units.
+   *
+   * A QuantitySpan tags existing memory with a unit without copying it. Elements are
+   * stride Scalars apart, which allows viewing e.g. a single component of
+   * interleaved data. If ScalarType is const, the elements are read-only.
+   *
+   * \tparam ScalarType The type of the scalar of each element, optionally const
+   * \tparam UnitType The unit type shared by every element
+   */
+  template <typename ScalarType,
+            typename UnitType>
+  class QuantitySpan {
+    static_assert(!std::is_reference_v<ScalarType>, "QuantitySpan requires a non-reference ScalarType");
+    static_assert(IsValidUnit_v<UnitType>, "The given UnitType is not a valid unit");
+
+    using ValueScalar = std::remove_const_t<ScalarType>;
+
+   public:
+    /** The scalar type of each element, without const */
+    using Scalar = ValueScalar;
+    /** The unit type of each element */
+    using Unit = UnitType;
+    /** Identity of this QuantitySpan */
+    using Type = QuantitySpan<ScalarType, Unit>;
+
+    using element_type = ScalarType;
+    using value_type = Quantity<Scalar, Unit>;
+    using reference = std::conditional_t<std::is_const_v<ScalarType>,
+                                         value_type,
+                                         ReferenceQuantity<Scalar, Unit>>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = detail::QuantityIterator<ScalarType, Unit>;
+
+    QuantitySpan() = default;
+
+    /** Views all the elements of a QuantityArray */
+    /*implicit*/ QuantitySpan(QuantityArray<Scalar, Unit>& array) :
+        data_(array.data()), size_(array.size()) { }
+
+    /** Views all the elements of a QuantityArray as read-only */
+    template <typename ScalarTypeOther = ScalarType,
+              typename = std::enable_if_t<std::is_const_v<ScalarTypeOther>>>
+    /*implicit*/ QuantitySpan(const QuantityArray<Scalar, Unit>& array) :
+        data_(array.data()), size_(array.size()) { }
+
+    /** Allows conversion from a mutable span to a read-only span */
+    template <typename ScalarTypeOther,
+              typename = std::enable_if_t<std::is_same_v<const ScalarTypeOther, ScalarType>>>
+    /*implicit*/ QuantitySpan(const QuantitySpan<ScalarTypeOther, Unit>& other) :
+        data_(other.data()), size_(other.size()), stride_(other.stride()) { }
+
+    /** Views count quantities starting at first without copying them. */
+    template <typename QuantityType,
+              typename = std::enable_if_t<IsQuantity_v<std::remove_const_t<QuantityType>> &&
+                                          std::is_same_v<UnitOf_t<std::remove_const_t<QuantityType>>, Unit>>>
+    QuantitySpan(QuantityType* first, size_type count) :
+        data_(count == 0 ? nullptr : &first->data()), size_(count) {
+      static_assert(IsLayoutCompatible_v<std::remove_const_t<QuantityType>>,
+                    "Quantities can only be viewed in-place if they are layout-compatible with their Scalar");
+      static_assert(std::is_same_v<std::remove_const_t<QuantityType>, Quantity<Scalar, Unit, IsBaseUnit_v<std::remove_const_t<QuantityType>>>>,
+                    "The viewed quantities must have the same Scalar as the QuantitySpan");
+      static_assert(std::is_const_v<ScalarType> || !std::is_const_v<QuantityType>,
+                    "A mutable QuantitySpan cannot view const quantities");
+    }
+
+    /** Views count Scalars starting at data, interpreting them as values in base units.
+     * \param stride The distance between consecutive elements, in Scalars
+     */
+    static Type makeFromBaseUnitValues(ScalarType* data, size_type count, difference_type stride = 1) {
+      assert(stride > 0);
+      Type result;
+      result.data_ = data;
+      result.size_ = count;
+      result.stride_ = stride;
+      return result;
+    }
+
+    /** Accesses an element in-place */
+    reference operator[](size_type i) const {
+      assert(i < size());
+      if constexpr (std::is_const_v<ScalarType>) {
+        return value_type::makeFromBaseUnitValue(data_[i * stride_]);
+      } else {
+        return reference::makeReference(data_[i * stride_]);
+      }
+    }
+
+    /** Writes every value in the desired units contiguously to out, which must hold
+     * size() Scalars. The reciprocal of the unit is computed once, so each element
+     * costs a single multiplication instead of a division.
+     */
+    template <typename ScalarTypeOther>
+    void as(const BaseQuantity<ScalarTypeOther, Unit>& desired, Scalar* out) const {
+      using Factor = detail::ConversionFactor_t<Scalar, ScalarTypeOther>;
+      detail::scaleInto(data_, size_, stride_, static_cast<Factor>(ScalarTypeOther{1} / desired.value()), out);
+    }
+
+    /** Sets every element from size() contiguous raw values expressed in the given unit */
+    template <typename ScalarTypeOther,
+              typename ScalarTypeSelf = ScalarType,
+              typename = std::enable_if_t<!std::is_const_v<ScalarTypeSelf>>>
+    void assign(const Scalar* values, const BaseQuantity<ScalarTypeOther, Unit>& unit) const {
+      using Factor = detail::ConversionFactor_t<Scalar, ScalarTypeOther>;
+      const Factor factor = static_cast<Factor>(unit.value());
+      for (size_type i = 0; i < size_; ++i) {
+        data_[i * stride_] = values[i] * factor;
+      }
+    }
+
+    /** Returns the number of elements in the span */
+    size_type size() const { return size_; }
+    /** Indicates if the span has no elements */
+    bool empty() const { return size_ == 0; }
+    /** The distance between consecutive elements, in Scalars */
+    difference_type stride() const { return stride_; }
+    /** Indicates if the elements are adjacent in memory */
+    bool isContiguous() const { return stride_ == 1; }
+
+    /** Returns a raw pointer to the underlying scalar values in base units, which are
+     * stride() Scalars apart.
+     * \warning Modifying the values through this pointer circumvents the guarantees
+     * provided by the library. Use only with great caution.
+     */
+    ScalarType* data() const { return data_; }
+
+    /** Returns a span over count elements beginning at offset */
+    Type subspan(size_type offset, size_type count) const {
+      assert(offset + count <= size());
+      return makeFromBaseUnitValues(count == 0 ? data_ : data_ + offset * stride_, count, stride_);
+    }
+
+    iterator begin() const { return iterator{data_, stride_}; }
+    iterator end() const { return iterator{data_, stride_, static_cast<difference_type>(size_)}; }
+
+   private:
+    ScalarType* data_ = nullptr;
+    size_type size_ = 0;
+    difference_type stride_ = 1;
+  };
+
+  template <typename ScalarType, typename UnitType>
+  struct ScalarOf<QuantitySpan<ScalarType, UnitType>> {
+    using type = std::remove_const_t<ScalarType>;
+  };
+
+  template <typename ScalarType, typename UnitType>
+  struct UnitOf<QuantitySpan<ScalarType, UnitType>> {
+    using type = UnitType;
+  };
+
+  template <typename ScalarType, typename UnitType>
+  struct IsQuantityContainer<QuantitySpan<ScalarType, UnitType>> : public std::true_type { };
+
+  template <typename ScalarType, typename UnitType>
+  QuantitySpan(QuantityArray<ScalarType, UnitType>&) -> QuantitySpan<ScalarType, UnitType>;
+  template <typename ScalarType, typename UnitType>
+  QuantitySpan(const QuantityArray<ScalarType, UnitType>&) -> QuantitySpan<const ScalarType, UnitType>;
+
+  /** A mutable span of quantities with the same Scalar and Unit as QuantityType */
+  template <typename QuantityType>
+  using SpanOf = QuantitySpan<ScalarOf_t<QuantityType>, UnitOf_t<QuantityType>>;
+  /** A read-only span of quantities with the same Scalar and Unit as QuantityType */
+  template <typename QuantityType>
+  using ConstSpanOf = QuantitySpan<const ScalarOf_t<QuantityType>, UnitOf_t<QuantityType>>;
+
+  /** Views a vector of quantities as a span, without copying it */
+  template <typename ScalarType, typename UnitType, bool IsBase>
+  QuantitySpan<ScalarType, UnitType> makeSpan(std::vector<Quantity<ScalarType, UnitType, IsBase>>& quantities) {
+    return {quantities.data(), quantities.size()};
+  }
+
+  /** Views a vector of quantities as a read-only span, without copying it */
+  template <typename ScalarType, typename UnitType, bool IsBase>
+  QuantitySpan<const ScalarType, UnitType> makeSpan(const std::vector<Quantity<ScalarType, UnitType, IsBase>>& quantities) {
+    return {quantities.data(), quantities.size()};
+  }
+}  // namespace poids
+
+#endif
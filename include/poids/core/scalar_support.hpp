@@ -1,6 +1,15 @@
 #ifndef POIDS_CORE_SCALAR_SUPPORT_HPP
 #define POIDS_CORE_SCALAR_SUPPORT_HPP
 
+#include <cmath>
+
+/** The default scalar promotion policy of poids::scalar::PromotionPolicy. Define it
+ * identically in every translation unit, e.g. as ::poids::scalar::KeepNarrow.
+ */
+#ifndef POIDS_SCALAR_PROMOTION
+#define POIDS_SCALAR_PROMOTION ::poids::scalar::Promote
+#endif
+
 namespace poids::scalar {
   /** CRTP mixin to allow different scalars to add custom functionality to
    * Quantities.
@@ -11,6 +20,63 @@ namespace poids::scalar {
   template <typename Derived,
             typename ScalarType>
   class ScalarMixin { };
+
+  /** The elementary operations poids::pow is built from, using the arithmetic
+   * operators and the <cmath> functions found by argument-dependent lookup.
+   */
+  template <typename ScalarType>
+  struct DefaultPowerTraits {
+    static constexpr ScalarType one(const ScalarType&) { return ScalarType{1}; }
+    static constexpr ScalarType multiply(const ScalarType& a, const ScalarType& b) { return a * b; }
+    static constexpr ScalarType reciprocal(const ScalarType& x) { return ScalarType{1} / x; }
+
+    static ScalarType squareRoot(const ScalarType& x) {
+      using std::sqrt;
+      return static_cast<ScalarType>(sqrt(x));
+    }
+
+    static ScalarType cubeRoot(const ScalarType& x) {
+      using std::cbrt;
+      return static_cast<ScalarType>(cbrt(x));
+    }
+
+    static ScalarType power(const ScalarType& x, double exponent) {
+      using std::pow;
+      return static_cast<ScalarType>(pow(x, exponent));
+    }
+  };
+
+  /** Customizes how poids::pow raises a scalar to a compile-time exponent, e.g. for
+   * scalars whose multiplication is not elementwise or which have no cbrt.
+   *
+   * \tparam ScalarType the concrete scalar being raised
+   */
+  template <typename ScalarType>
+  struct PowerTraits : public DefaultPowerTraits<ScalarType> { };
+
+  /** Arithmetic between floating-point scalars of different precision yields the
+   * wider one, as for the built-in types, e.g. float * double is double.
+   */
+  struct Promote { };
+
+  /** Arithmetic between floating-point scalars of different precision yields and is
+   * computed in the narrower one, e.g. float * double is float.
+   */
+  struct KeepNarrow { };
+
+  /** Arithmetic between floating-point scalars of different precision does not compile */
+  struct RejectMixed { };
+
+  /** Chooses how quantities combine floating-point scalars of different precision,
+   * one of Promote, KeepNarrow and RejectMixed. Scalars of the same type and
+   * non-floating-point scalars are unaffected.
+   *
+   * Defaults to POIDS_SCALAR_PROMOTION, and may be specialized for a pair of scalars.
+   */
+  template <typename ScalarTypeLHS, typename ScalarTypeRHS>
+  struct PromotionPolicy {
+    using type = POIDS_SCALAR_PROMOTION;
+  };
 }  // namespace poids::scalar
 
 #endif
\ No newline at end of file
@@ -0,0 +1,375 @@
+#ifndef POIDS_CORE_SCALED_QUANTITY_HPP
+#define POIDS_CORE_SCALED_QUANTITY_HPP
+
+#include <cstdint>
+#include <numeric>
+#include <ratio>
+#include <type_traits>
+
+#include "quantity.hpp"
+#include "traits.hpp"
+
+namespace poids {
+  template <typename ScalarType, typename UnitType, typename ScaleType>
+  class ScaledQuantity;
+
+  namespace detail {
+    template <typename T>
+    struct IsRatio : public std::false_type { };
+
+    template <std::intmax_t N, std::intmax_t D>
+    struct IsRatio<std::ratio<N, D>> : public std::true_type { };
+
+    /** The largest scale of which both scales are whole multiples. As for
+     * std::chrono durations, both convert to it with an integer factor.
+     */
+    template <typename ScaleA, typename ScaleB>
+    using CommonScale_t = std::ratio<std::gcd(ScaleA::num, ScaleB::num), std::lcm(ScaleA::den, ScaleB::den)>;
+
+    template <typename ScaleA, typename ScaleB>
+    using MultiplyScale_t = typename std::ratio_multiply<ScaleA, ScaleB>::type;
+
+    template <typename ScaleA, typename ScaleB>
+    using DivideScale_t = typename std::ratio_divide<ScaleA, ScaleB>::type;
+
+    /** Whether a value counted in From converts to To without rounding. As for
+     * std::chrono durations, this holds for floating point Scalars and for
+     * integral factors, and only such conversions are implicit.
+     */
+    template <typename From, typename To, typename ScalarType>
+    inline constexpr bool IsExactRescale_v = std::is_floating_point_v<ScalarType> || DivideScale_t<From, To>::den == 1;
+
+    /** Converts a value counted in From to one counted in To. The factor is folded
+     * into a single constant at compile time, and the conversion is a no-op
+     * between equal scales. Integral Scalars are scaled with integer arithmetic,
+     * truncating toward zero, and a fractional factor divides before it multiplies
+     * so that the intermediate does not overflow unless the result does.
+     */
+    template <typename From, typename To, typename ScalarType>
+    constexpr ScalarType rescale(const ScalarType& value) {
+      using Factor = DivideScale_t<From, To>;
+      if constexpr (Factor::num == 1 && Factor::den == 1) {
+        return value;
+      } else if constexpr (std::is_integral_v<ScalarType>) {
+        if constexpr (Factor::den == 1) {
+          return value * static_cast<ScalarType>(Factor::num);
+        } else if constexpr (Factor::num == 1) {
+          return value / static_cast<ScalarType>(Factor::den);
+        } else {
+          const auto quotient = static_cast<std::intmax_t>(value) / Factor::den;
+          const auto remainder = static_cast<std::intmax_t>(value) % Factor::den;
+          return static_cast<ScalarType>(quotient * Factor::num + remainder * Factor::num / Factor::den);
+        }
+      } else {
+        using FactorType = std::conditional_t<std::is_floating_point_v<ScalarType>, ScalarType, double>;
+        constexpr FactorType factor = static_cast<FactorType>(static_cast<long double>(Factor::num) /
+                                                              static_cast<long double>(Factor::den));
+        return value * factor;
+      }
+    }
+  }  // namespace detail
+
+  /** A quantity stored as a multiple of Scale times the base unit, e.g. a length
+   * counted in millimetres with Scale = std::milli.
+   *
+   * The scale is part of the type, so values read from or written to a device in
+   * its native units need no conversion, and a contiguous sequence of
+   * ScaledQuantity has the layout of its Scalars. Converting to another scale, or
+   * to a Quantity in base units, costs one multiplication by a compile-time
+   * constant. Multiplication and division combine the scales at compile time
+   * without touching the values, while addition, subtraction and comparisons
+   * between different scales convert both sides to their common scale.
+   *
+   * \tparam ScalarType The type of the scalar of the quantity
+   * \tparam UnitType The unit type of the quantity
+   * \tparam ScaleType A std::ratio with the size of one stored unit in base units
+   */
+  template <typename ScalarType, typename UnitType, typename ScaleType>
+  class ScaledQuantity {
+    static_assert(!std::is_reference_v<ScalarType>, "ScaledQuantity requires a non-reference ScalarType");
+    static_assert(IsValidUnit_v<UnitType>, "The given UnitType is not a valid unit");
+    static_assert(detail::IsRatio<ScaleType>::value && ScaleType::num > 0,
+                  "The Scale of a ScaledQuantity must be a positive std::ratio");
+    static_assert(std::is_same_v<ScaleType, typename ScaleType::type>,
+                  "The Scale of a ScaledQuantity must be a std::ratio in lowest terms, such as std::milli");
+
+   public:
+    /** The scalar type of this ScaledQuantity */
+    using Scalar = ScalarType;
+    /** The unit type of this ScaledQuantity */
+    using Unit = UnitType;
+    /** The size of one stored unit, in base units */
+    using Scale = ScaleType;
+    /** Identity of this ScaledQuantity */
+    using Type = ScaledQuantity<Scalar, Unit, Scale>;
+    /** The Quantity with the same Scalar and Unit, stored in base units */
+    using QuantityType = Quantity<Scalar, Unit>;
+
+    /** Constructs a zero-valued ScaledQuantity */
+    constexpr ScaledQuantity() :
+        value_{} { }
+
+    /** Converts from another scale with a single multiplication. The conversion is
+     * implicit only if it cannot round, see detail::IsExactRescale_v.
+     */
+    template <typename ScaleTypeOther,
+              std::enable_if_t<detail::IsExactRescale_v<ScaleTypeOther, ScaleType, ScalarType>, int> = 0>
+    constexpr /*implicit*/ ScaledQuantity(const ScaledQuantity<Scalar, Unit, ScaleTypeOther>& other) :
+        value_(detail::rescale<ScaleTypeOther, Scale>(other.value())) { }
+
+    /** Converts from another scale with a single multiplication, truncating toward zero */
+    template <typename ScaleTypeOther,
+              std::enable_if_t<!detail::IsExactRescale_v<ScaleTypeOther, ScaleType, ScalarType>, int> = 0>
+    constexpr explicit ScaledQuantity(const ScaledQuantity<Scalar, Unit, ScaleTypeOther>& other) :
+        value_(detail::rescale<ScaleTypeOther, Scale>(other.value())) { }
+
+    /** Converts from a Quantity in base units with a single multiplication */
+    template <bool IsBase,
+              typename ScaleTypeSelf = ScaleType,
+              std::enable_if_t<detail::IsExactRescale_v<std::ratio<1>, ScaleTypeSelf, ScalarType>, int> = 0>
+    constexpr /*implicit*/ ScaledQuantity(const Quantity<Scalar, Unit, IsBase>& quantity) :
+        value_(detail::rescale<std::ratio<1>, Scale>(quantity.base())) { }
+
+    /** Converts from a Quantity in base units with a single multiplication, truncating toward zero */
+    template <bool IsBase,
+              typename ScaleTypeSelf = ScaleType,
+              std::enable_if_t<!detail::IsExactRescale_v<std::ratio<1>, ScaleTypeSelf, ScalarType>, int> = 0>
+    constexpr explicit ScaledQuantity(const Quantity<Scalar, Unit, IsBase>& quantity) :
+        value_(detail::rescale<std::ratio<1>, Scale>(quantity.base())) { }
+
+    /** Converts to a Quantity in base units with a single multiplication */
+    template <typename ScaleTypeSelf = ScaleType,
+              std::enable_if_t<detail::IsExactRescale_v<ScaleTypeSelf, std::ratio<1>, ScalarType>, int> = 0>
+    constexpr /*implicit*/ operator QuantityType() const {
+      return QuantityType::makeFromBaseUnitValue(base());
+    }
+
+    /** Converts to a Quantity in base units with a single multiplication, truncating toward zero */
+    template <typename ScaleTypeSelf = ScaleType,
+              std::enable_if_t<!detail::IsExactRescale_v<ScaleTypeSelf, std::ratio<1>, ScalarType>, int> = 0>
+    constexpr explicit operator QuantityType() const {
+      return QuantityType::makeFromBaseUnitValue(base());
+    }
+
+    /** Constructs a ScaledQuantity from a value counted in Scale, e.g. a raw device reading */
+    static constexpr Type makeFromScaledValue(const Scalar& value) {
+      Type result;
+      result.value_ = value;
+      return result;
+    }
+
+    /** Gets the stored value, counted in Scale */
+    constexpr const Scalar& value() const { return value_; }
+
+    /** Gets the value in base units */
+    constexpr Scalar base() const { return detail::rescale<Scale, std::ratio<1>>(value_); }
+
+    /** Gets the value in the desired units */
+    template <typename ScalarTypeOther>
+    constexpr Scalar as(const BaseQuantity<ScalarTypeOther, Unit>& desired) const {
+      return base() / desired.value();
+    }
+
+    /** Returns a reference to the stored value, counted in Scale.
+     * \warning Modifying the value returned from this function can circumvent the guarantees
+     * provided by the library. Use only with great caution.
+     */
+    constexpr Scalar& data() { return value_; }
+    constexpr const Scalar& data() const { return value_; }
+
+   private:
+    Scalar value_; /**< The value counted in Scale */
+
+    template <typename ScaleTypeOther>
+    using CommonWith = ScaledQuantity<Scalar, Unit, detail::CommonScale_t<Scale, ScaleTypeOther>>;
+
+    constexpr friend Type operator-(const Type& rhs) { return makeFromScaledValue(-rhs.value_); }
+
+    constexpr friend Type operator+(const Type& lhs, const Type& rhs) {
+      return makeFromScaledValue(lhs.value_ + rhs.value_);
+    }
+
+    constexpr friend Type operator-(const Type& lhs, const Type& rhs) {
+      return makeFromScaledValue(lhs.value_ - rhs.value_);
+    }
+
+    template <typename ScaleTypeRHS>
+    constexpr friend auto operator+(const Type& lhs, const ScaledQuantity<Scalar, Unit, ScaleTypeRHS>& rhs) {
+      using Result = CommonWith<ScaleTypeRHS>;
+      return Result::makeFromScaledValue(Result{lhs}.value() + Result{rhs}.value());
+    }
+
+    template <typename ScaleTypeRHS>
+    constexpr friend auto operator-(const Type& lhs, const ScaledQuantity<Scalar, Unit, ScaleTypeRHS>& rhs) {
+      using Result = CommonWith<ScaleTypeRHS>;
+      return Result::makeFromScaledValue(Result{lhs}.value() - Result{rhs}.value());
+    }
+
+    template <bool IsBaseRHS>
+    constexpr friend auto operator+(const Type& lhs, const Quantity<Scalar, Unit, IsBaseRHS>& rhs) {
+      return lhs + ScaledQuantity<Scalar, Unit, std::ratio<1>>{rhs};
+    }
+
+    template <bool IsBaseLHS>
+    constexpr friend auto operator+(const Quantity<Scalar, Unit, IsBaseLHS>& lhs, const Type& rhs) {
+      return ScaledQuantity<Scalar, Unit, std::ratio<1>>{lhs} + rhs;
+    }
+
+    template <bool IsBaseRHS>
+    constexpr friend auto operator-(const Type& lhs, const Quantity<Scalar, Unit, IsBaseRHS>& rhs) {
+      return lhs - ScaledQuantity<Scalar, Unit, std::ratio<1>>{rhs};
+    }
+
+    template <bool IsBaseLHS>
+    constexpr friend auto operator-(const Quantity<Scalar, Unit, IsBaseLHS>& lhs, const Type& rhs) {
+      return ScaledQuantity<Scalar, Unit, std::ratio<1>>{lhs} - rhs;
+    }
+
+    constexpr friend Type operator*(const Type& lhs, const Scalar& rhs) { return makeFromScaledValue(lhs.value_ * rhs); }
+
+    constexpr friend Type operator*(const Scalar& lhs, const Type& rhs) { return makeFromScaledValue(lhs * rhs.value_); }
+
+    constexpr friend Type operator/(const Type& lhs, const Scalar& rhs) { return makeFromScaledValue(lhs.value_ / rhs); }
+
+    template <typename UnitTypeRHS, typename ScaleTypeRHS>
+    constexpr friend auto operator*(const Type& lhs, const ScaledQuantity<Scalar, UnitTypeRHS, ScaleTypeRHS>& rhs) {
+      using Result = ScaledQuantity<Scalar,
+                                    typename Unit::template multiply_t<UnitTypeRHS>,
+                                    detail::MultiplyScale_t<Scale, ScaleTypeRHS>>;
+      return Result::makeFromScaledValue(lhs.value_ * rhs.value());
+    }
+
+    template <typename UnitTypeRHS, typename ScaleTypeRHS>
+    constexpr friend auto operator/(const Type& lhs, const ScaledQuantity<Scalar, UnitTypeRHS, ScaleTypeRHS>& rhs) {
+      using Result = ScaledQuantity<Scalar,
+                                    typename Unit::template divide_t<UnitTypeRHS>,
+                                    detail::DivideScale_t<Scale, ScaleTypeRHS>>;
+      return Result::makeFromScaledValue(lhs.value_ / rhs.value());
+    }
+
+    template <typename UnitTypeRHS, bool IsBaseRHS>
+    constexpr friend auto operator*(const Type& lhs, const Quantity<Scalar, UnitTypeRHS, IsBaseRHS>& rhs) {
+      using Result = ScaledQuantity<Scalar, typename Unit::template multiply_t<UnitTypeRHS>, Scale>;
+      return Result::makeFromScaledValue(lhs.value_ * rhs.base());
+    }
+
+    template <typename UnitTypeLHS, bool IsBaseLHS>
+    constexpr friend auto operator*(const Quantity<Scalar, UnitTypeLHS, IsBaseLHS>& lhs, const Type& rhs) {
+      using Result = ScaledQuantity<Scalar, typename UnitTypeLHS::template multiply_t<Unit>, Scale>;
+      return Result::makeFromScaledValue(lhs.base() * rhs.value_);
+    }
+
+    template <typename UnitTypeRHS, bool IsBaseRHS>
+    constexpr friend auto operator/(const Type& lhs, const Quantity<Scalar, UnitTypeRHS, IsBaseRHS>& rhs) {
+      using Result = ScaledQuantity<Scalar, typename Unit::template divide_t<UnitTypeRHS>, Scale>;
+      return Result::makeFromScaledValue(lhs.value_ / rhs.base());
+    }
+
+    template <typename UnitTypeLHS, bool IsBaseLHS>
+    constexpr friend auto operator/(const Quantity<Scalar, UnitTypeLHS, IsBaseLHS>& lhs, const Type& rhs) {
+      using Result = ScaledQuantity<Scalar,
+                                    typename UnitTypeLHS::template divide_t<Unit>,
+                                    detail::DivideScale_t<std::ratio<1>, Scale>>;
+      return Result::makeFromScaledValue(lhs.base() / rhs.value_);
+    }
+
+    friend Type& operator+=(Type& lhs, const Type& rhs) {
+      lhs.value_ += rhs.value_;
+      return lhs;
+    }
+
+    friend Type& operator-=(Type& lhs, const Type& rhs) {
+      lhs.value_ -= rhs.value_;
+      return lhs;
+    }
+
+    // Comparisons between different scales compare in the common scale. For
+    // integral Scalars both conversions are exact, while floating point values
+    // are each rounded once by the conversion
+
+    template <typename ScaleTypeRHS>
+    constexpr friend auto operator==(const Type& lhs, const ScaledQuantity<Scalar, Unit, ScaleTypeRHS>& rhs) {
+      using Common = CommonWith<ScaleTypeRHS>;
+      return Common{lhs}.value() == Common{rhs}.value();
+    }
+
+    template <typename ScaleTypeRHS>
+    constexpr friend auto operator!=(const Type& lhs, const ScaledQuantity<Scalar, Unit, ScaleTypeRHS>& rhs) {
+      return !(lhs == rhs);
+    }
+
+    template <typename ScaleTypeRHS>
+    constexpr friend auto operator<(const Type& lhs, const ScaledQuantity<Scalar, Unit, ScaleTypeRHS>& rhs) {
+      using Common = CommonWith<ScaleTypeRHS>;
+      return Common{lhs}.value() < Common{rhs}.value();
+    }
+
+    template <typename ScaleTypeRHS>
+    constexpr friend auto operator>(const Type& lhs, const ScaledQuantity<Scalar, Unit, ScaleTypeRHS>& rhs) {
+      return rhs < lhs;
+    }
+
+    template <typename ScaleTypeRHS>
+    constexpr friend auto operator<=(const Type& lhs, const ScaledQuantity<Scalar, Unit, ScaleTypeRHS>& rhs) {
+      using Common = CommonWith<ScaleTypeRHS>;
+      return Common{lhs}.value() <= Common{rhs}.value();
+    }
+
+    template <typename ScaleTypeRHS>
+    constexpr friend auto operator>=(const Type& lhs, const ScaledQuantity<Scalar, Unit, ScaleTypeRHS>& rhs) {
+      return rhs <= lhs;
+    }
+
+    template <bool IsBaseRHS>
+    constexpr friend auto operator==(const Type& lhs, const Quantity<Scalar, Unit, IsBaseRHS>& rhs) {
+      return lhs == ScaledQuantity<Scalar, Unit, std::ratio<1>>{rhs};
+    }
+
+    template <bool IsBaseRHS>
+    constexpr friend auto operator!=(const Type& lhs, const Quantity<Scalar, Unit, IsBaseRHS>& rhs) {
+      return lhs != ScaledQuantity<Scalar, Unit, std::ratio<1>>{rhs};
+    }
+
+    template <bool IsBaseRHS>
+    constexpr friend auto operator<(const Type& lhs, const Quantity<Scalar, Unit, IsBaseRHS>& rhs) {
+      return lhs < ScaledQuantity<Scalar, Unit, std::ratio<1>>{rhs};
+    }
+
+    template <bool IsBaseRHS>
+    constexpr friend auto operator>(const Type& lhs, const Quantity<Scalar, Unit, IsBaseRHS>& rhs) {
+      return lhs > ScaledQuantity<Scalar, Unit, std::ratio<1>>{rhs};
+    }
+
+    template <bool IsBaseRHS>
+    constexpr friend auto operator<=(const Type& lhs, const Quantity<Scalar, Unit, IsBaseRHS>& rhs) {
+      return lhs <= ScaledQuantity<Scalar, Unit, std::ratio<1>>{rhs};
+    }
+
+    template <bool IsBaseRHS>
+    constexpr friend auto operator>=(const Type& lhs, const Quantity<Scalar, Unit, IsBaseRHS>& rhs) {
+      return lhs >= ScaledQuantity<Scalar, Unit, std::ratio<1>>{rhs};
+    }
+  };
+
+  template <typename ScalarType, typename UnitType, typename ScaleType>
+  struct IsUnitless<ScaledQuantity<ScalarType, UnitType, ScaleType>> : public IsUnitless<UnitType> { };
+
+  template <typename ScalarType, typename UnitType, typename ScaleType>
+  struct ScalarOf<ScaledQuantity<ScalarType, UnitType, ScaleType>> {
+    using type = ScalarType;
+  };
+
+  template <typename ScalarType, typename UnitType, typename ScaleType>
+  struct UnitOf<ScaledQuantity<ScalarType, UnitType, ScaleType>> {
+    using type = UnitType;
+  };
+
+  template <typename ScalarType, typename UnitType, typename ScaleType>
+  struct IsQuantity<ScaledQuantity<ScalarType, UnitType, ScaleType>> : public std::true_type { };
+
+  /** The QuantityType counted in multiples of Scale, e.g. Scaled<si::Length, std::milli> */
+  template <typename QuantityType, typename Scale>
+  using Scaled = ScaledQuantity<ScalarOf_t<QuantityType>, UnitOf_t<QuantityType>, Scale>;
+}  // namespace poids
+
+#endif
@@ -5,6 +5,8 @@
 #include <ratio>
 #include <type_traits>
 
+#include "scalar_support.hpp"
+
 namespace poids {
   template <typename T,
             typename = void>
@@ -67,6 +69,15 @@ namespace poids {
   template <typename T>
   inline constexpr bool IsQuantity_v = IsQuantity<T>::value;
 
+  template <typename T>
+  struct IsQuantityContainer : public std::false_type { };
+
+  /** Indicates if the given type T holds many quantities of the same unit, such as
+   * poids::QuantityArray
+   */
+  template <typename T>
+  inline constexpr bool IsQuantityContainer_v = IsQuantityContainer<T>::value;
+
   template <typename QuantityType>
   struct IsBaseUnit : public std::false_type { };
 
@@ -92,12 +103,61 @@ namespace poids {
   struct is_std_ratio<std::ratio<Num, Den>> : public std::true_type { };
 
   namespace detail {
-#define POIDS_BINARY_ARITHMETIC_RESULT_TYPE(name, op)                                      \
-  template <typename ScalarTypeLHS, typename ScalarTypeRHS>                                \
-  struct name##Result {                                                                    \
-    using type = decltype(std::declval<ScalarTypeLHS>() op std::declval<ScalarTypeRHS>()); \
-  };                                                                                       \
-  template <typename ScalarTypeLHS, typename ScalarTypeRHS>                                \
+    /** Indicates if two scalars are floating-point types of different precision */
+    template <typename ScalarTypeLHS, typename ScalarTypeRHS>
+    inline constexpr bool IsMixedPrecision_v = std::is_floating_point_v<ScalarTypeLHS> &&
+                                               std::is_floating_point_v<ScalarTypeRHS> &&
+                                               !std::is_same_v<ScalarTypeLHS, ScalarTypeRHS>;
+
+    /** Applies scalar::PromotionPolicy to Natural, the result of the built-in operation */
+    template <typename ScalarTypeLHS, typename ScalarTypeRHS, typename Natural>
+    struct PromotedScalar {
+      using Policy = typename scalar::PromotionPolicy<ScalarTypeLHS, ScalarTypeRHS>::type;
+      static constexpr bool IsMixed = IsMixedPrecision_v<ScalarTypeLHS, ScalarTypeRHS>;
+
+      static_assert(!IsMixed || !std::is_same_v<Policy, scalar::RejectMixed>,
+                    "Mixed-precision arithmetic is rejected by the scalar promotion policy, "
+                    "convert one of the operands explicitly");
+
+      using type = std::conditional_t<IsMixed && std::is_same_v<Policy, scalar::KeepNarrow>,
+                                      std::conditional_t<(sizeof(ScalarTypeLHS) <= sizeof(ScalarTypeRHS)),
+                                                         ScalarTypeLHS,
+                                                         ScalarTypeRHS>,
+                                      Natural>;
+    };
+
+    template <typename ScalarTypeLHS, typename ScalarTypeRHS, typename Natural>
+    using PromotedScalar_t = typename PromotedScalar<ScalarTypeLHS, ScalarTypeRHS, Natural>::type;
+
+    /** Converts an operand to ResultScalar if they differ in precision, so that an
+     * operation with a narrow result is also computed narrowly
+     */
+    template <typename ResultScalar, typename ScalarType>
+    constexpr decltype(auto) promoteOperand(const ScalarType& value) {
+      if constexpr (IsMixedPrecision_v<ResultScalar, ScalarType>) {
+        return static_cast<ResultScalar>(value);
+      } else {
+        return (value);
+      }
+    }
+
+    /** Applies Op to operands promoted according to scalar::PromotionPolicy */
+    template <typename Op>
+    struct Promoted {
+      template <typename ScalarTypeLHS, typename ScalarTypeRHS>
+      constexpr auto operator()(const ScalarTypeLHS& lhs, const ScalarTypeRHS& rhs) const {
+        using Result = PromotedScalar_t<ScalarTypeLHS, ScalarTypeRHS, decltype(Op{}(lhs, rhs))>;
+        return Op{}(promoteOperand<Result>(lhs), promoteOperand<Result>(rhs));
+      }
+    };
+
+#define POIDS_BINARY_ARITHMETIC_RESULT_TYPE(name, op)                                         \
+  template <typename ScalarTypeLHS, typename ScalarTypeRHS>                                   \
+  struct name##Result {                                                                       \
+    using Natural = decltype(std::declval<ScalarTypeLHS>() op std::declval<ScalarTypeRHS>()); \
+    using type = PromotedScalar_t<ScalarTypeLHS, ScalarTypeRHS, Natural>;                     \
+  };                                                                                          \
+  template <typename ScalarTypeLHS, typename ScalarTypeRHS>                                   \
   using name##Result_t = typename name##Result<ScalarTypeLHS, ScalarTypeRHS>::type
 
     /** The resultant type of the operation LHS + RHS*/
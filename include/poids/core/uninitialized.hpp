@@ -0,0 +1,68 @@
+#ifndef POIDS_CORE_UNINITIALIZED_HPP
+#define POIDS_CORE_UNINITIALIZED_HPP
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace poids {
+  /** Tag type to request that a value is left default-initialized instead of zeroed.
+   *
+   * Reading a value constructed this way before assigning to it is undefined
+   * behavior. Only use this for storage which is about to be overwritten.
+   */
+  struct Uninitialized {
+    explicit Uninitialized() = default;
+  };
+
+  /** Tag to request that a value is left default-initialized instead of zeroed. */
+  inline constexpr Uninitialized uninitialized{};
+
+  /** Allocator adaptor which default-initializes elements instead of value-initializing them.
+   *
+   * Containers like std::vector value-initialize new elements on construction and
+   * resize, which zero-fills memory that is often immediately overwritten. With this
+   * allocator, types constructible from poids::Uninitialized are constructed with it,
+   * and other types are default-initialized. Explicitly given values are unaffected.
+   *
+   * \tparam T The element type
+   * \tparam Allocator The allocator to adapt
+   */
+  template <typename T, typename Allocator = std::allocator<T>>
+  class DefaultInitAllocator : public Allocator {
+    using Traits = std::allocator_traits<Allocator>;
+
+   public:
+    template <typename U>
+    struct rebind {
+      using other = DefaultInitAllocator<U, typename Traits::template rebind_alloc<U>>;
+    };
+
+    using Allocator::Allocator;
+
+    DefaultInitAllocator() = default;
+
+    template <typename U, typename AllocatorOther>
+    /*implicit*/ DefaultInitAllocator(const DefaultInitAllocator<U, AllocatorOther>& other) noexcept :
+        Allocator(other) { }
+
+    /** Default-initializes the element at p */
+    template <typename U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>) {
+      if constexpr (std::is_constructible_v<U, Uninitialized>) {
+        ::new (static_cast<void*>(p)) U(uninitialized);
+      } else {
+        ::new (static_cast<void*>(p)) U;
+      }
+    }
+
+    /** Constructs the element at p from args */
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+      Traits::construct(static_cast<Allocator&>(*this), p, std::forward<Args>(args)...);
+    }
+  };
+}  // namespace poids
+
+#endif
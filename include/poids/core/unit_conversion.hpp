@@ -0,0 +1,30 @@
+#ifndef POIDS_CORE_UNIT_CONVERSION_HPP
+#define POIDS_CORE_UNIT_CONVERSION_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace poids::detail {
+  /** The type of the factor used to convert Scalars to and from units with a ScalarTypeUnit
+   * value. Floating-point Scalars keep their own precision so the conversion loop stays
+   * in one register width.
+   */
+  template <typename ScalarType, typename ScalarTypeUnit>
+  using ConversionFactor_t = std::conditional_t<std::is_floating_point_v<ScalarType>, ScalarType, ScalarTypeUnit>;
+
+  /** Multiplies count values which are stride apart by factor, writing them contiguously to out */
+  template <typename ScalarTypeIn, typename ScalarTypeOut, typename Factor>
+  void scaleInto(const ScalarTypeIn* in, std::size_t count, std::ptrdiff_t stride, Factor factor, ScalarTypeOut* out) {
+    if (stride == 1) {
+      for (std::size_t i = 0; i < count; ++i) {
+        out[i] = in[i] * factor;
+      }
+    } else {
+      for (std::size_t i = 0; i < count; ++i) {
+        out[i] = in[static_cast<std::ptrdiff_t>(i) * stride] * factor;
+      }
+    }
+  }
+}  // namespace poids::detail
+
+#endif
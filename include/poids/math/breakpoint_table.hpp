@@ -0,0 +1,314 @@
+#ifndef POIDS_MATH_BREAKPOINT_TABLE_HPP
+#define POIDS_MATH_BREAKPOINT_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/core/traits.hpp"
+#include "poids/math/lookup_table.hpp"
+
+namespace poids {
+  /** Interpolates with piecewise cubic Hermites whose slopes are the weighted harmonic
+   * mean of the neighbouring secants (Fritsch-Butland), so the result is monotone
+   * wherever the breakpoints are and never overshoots them
+   */
+  struct MonotoneCubicInterpolation {
+    explicit MonotoneCubicInterpolation() = default;
+  };
+
+  inline constexpr MonotoneCubicInterpolation monotoneCubicInterpolation{};
+
+  namespace detail {
+    template <typename T>
+    inline constexpr bool IsBreakpointInterpolation_v =
+        std::is_same_v<T, LinearInterpolation> || std::is_same_v<T, MonotoneCubicInterpolation>;
+  }  // namespace detail
+
+  /** A quantity-valued function given at irregular breakpoints, such as a
+   * calibration curve.
+   *
+   * Breakpoints are searched in base units, without the comparison operators of
+   * Quantity. Besides the sorted breakpoints, the table keeps a copy in Eytzinger
+   * (breadth-first) order, padded to a complete tree, so a search is a fixed number
+   * of steps down the tree with a conditional move and no branch to mispredict. The
+   * first levels of the tree share a few cache lines, unlike the first probes of a
+   * binary search over the sorted array.
+   *
+   * Keys beyond the first and last breakpoints are clamped to them.
+   *
+   * \tparam ValueQuantity The quantity type of the tabulated values
+   * \tparam KeyQuantity The quantity type of the breakpoints
+   */
+  template <typename ValueQuantity, typename KeyQuantity>
+  class BreakpointTable {
+    static_assert(IsQuantity_v<ValueQuantity>, "The values of a breakpoint table must be a poids::Quantity");
+    static_assert(IsQuantity_v<KeyQuantity>, "The breakpoints of a breakpoint table must be a poids::Quantity");
+
+   public:
+    using Value = Quantity<ScalarOf_t<ValueQuantity>, UnitOf_t<ValueQuantity>>;
+    using Key = Quantity<ScalarOf_t<KeyQuantity>, UnitOf_t<KeyQuantity>>;
+    using Scalar = ScalarOf_t<ValueQuantity>;
+    using KeyScalar = ScalarOf_t<KeyQuantity>;
+
+    /** Constructs a table from strictly increasing breakpoints and the values at them */
+    BreakpointTable(QuantitySpan<const KeyScalar, UnitOf_t<KeyQuantity>> keys,
+                    QuantitySpan<const Scalar, UnitOf_t<ValueQuantity>> values) :
+        keys_(keys.size()),
+        values_(values.size()) {
+      assert(keys.size() >= 2);
+      assert(keys.size() == values.size());
+      for (std::size_t i = 0; i < keys.size(); ++i) {
+        keys_[i] = keys.data()[i * keys.stride()];
+        values_[i] = values.data()[i * values.stride()];
+        assert(i == 0 || keys_[i] > keys_[i - 1]);
+      }
+      buildWidths();
+      buildSlopes();
+      buildTree();
+    }
+
+    /** The number of breakpoints */
+    std::size_t size() const { return keys_.size(); }
+
+    /** Breakpoint i */
+    Key key(std::size_t i) const {
+      assert(i < size());
+      return Key::makeFromBaseUnitValue(keys_[i]);
+    }
+
+    /** The value at breakpoint i */
+    Value value(std::size_t i) const {
+      assert(i < size());
+      return Value::makeFromBaseUnitValue(values_[i]);
+    }
+
+    /** Locates the interval [index, index + 1] of breakpoints which contains key and
+     * the fraction of the way across it
+     */
+    AxisCell<KeyScalar> locate(const Key& key) const { return cell(lowerBound(key.base()), key.base()); }
+
+    /** Interpolates linearly at key */
+    template <typename KeyType>
+    Value operator()(const KeyType& key) const {
+      return interpolate(linearInterpolation, key);
+    }
+
+    /** Interpolates at key with the given method */
+    template <typename Interpolation, typename KeyType>
+    Value interpolate(Interpolation, const KeyType& key) const {
+      static_assert(std::is_same_v<UnitOf_t<KeyType>, UnitOf_t<KeyQuantity>>,
+                    "The key must have the unit of the breakpoints");
+      const KeyScalar x = Key{key}.base();
+      return Value::makeFromBaseUnitValue(evaluate(Interpolation{}, cell(lowerBound(x), x)));
+    }
+
+    /** Interpolates at every element of keys, in any order, writing to result.
+     * Searches for a group of keys are interleaved level by level, so that their
+     * memory accesses overlap instead of waiting on each other.
+     */
+    template <typename Result, typename KeyArray,
+              typename = std::enable_if_t<!detail::IsBreakpointInterpolation_v<std::decay_t<Result>>>>
+    void interpolateEach(Result&& result, const KeyArray& keys) const {
+      interpolateEach(linearInterpolation, std::forward<Result>(result), keys);
+    }
+
+    template <typename Interpolation, typename Result, typename KeyArray,
+              typename = std::enable_if_t<detail::IsBreakpointInterpolation_v<Interpolation>>>
+    void interpolateEach(Interpolation, Result&& result, const KeyArray& keys) const {
+      const auto [out, in] = spans<Result, KeyArray>(result, keys);
+      constexpr std::size_t group = 8;
+      const std::size_t count = out.size();
+      const KeyScalar* x = in.data();
+      Scalar* data = out.data();
+
+      std::size_t i = 0;
+      for (; i + group <= count; i += group) {
+        std::array<std::size_t, group> k;
+        std::array<std::size_t, group> found;
+        k.fill(1);
+        found.fill(0);
+        for (std::size_t level = 0; level < levels_; ++level) {
+          for (std::size_t j = 0; j < group; ++j) {
+            const bool less = tree_[k[j]] < x[i + j];
+            found[j] = less ? found[j] : k[j];
+            k[j] = 2 * k[j] + less;
+          }
+        }
+        for (std::size_t j = 0; j < group; ++j) {
+          data[i + j] = evaluate(Interpolation{}, cell(ranks_[found[j]], x[i + j]));
+        }
+      }
+      for (; i < count; ++i) {
+        data[i] = evaluate(Interpolation{}, cell(lowerBound(x[i]), x[i]));
+      }
+    }
+
+    /** Interpolates at every element of keys, which must be in increasing order,
+     * writing to result. The breakpoints are walked alongside the keys, so no key is
+     * searched for.
+     */
+    template <typename Result, typename KeyArray,
+              typename = std::enable_if_t<!detail::IsBreakpointInterpolation_v<std::decay_t<Result>>>>
+    void interpolateSorted(Result&& result, const KeyArray& keys) const {
+      interpolateSorted(linearInterpolation, std::forward<Result>(result), keys);
+    }
+
+    template <typename Interpolation, typename Result, typename KeyArray,
+              typename = std::enable_if_t<detail::IsBreakpointInterpolation_v<Interpolation>>>
+    void interpolateSorted(Interpolation, Result&& result, const KeyArray& keys) const {
+      const auto [out, in] = spans<Result, KeyArray>(result, keys);
+      const std::size_t count = out.size();
+      const std::size_t last = size() - 2;
+      const KeyScalar* x = in.data();
+      Scalar* data = out.data();
+
+      std::size_t index = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+        assert(i == 0 || !(x[i] < x[i - 1]));
+        while (index < last && keys_[index + 1] < x[i]) {
+          ++index;
+        }
+        data[i] = evaluate(Interpolation{}, cell(index + 1, x[i]));
+      }
+    }
+
+   private:
+    /** Sorted breakpoints in base units */
+    std::vector<KeyScalar> keys_;
+    /** Values at the breakpoints in base units */
+    std::vector<Scalar> values_;
+    /** The reciprocal of the width of each interval */
+    std::vector<KeyScalar> inverseWidths_;
+    /** The slope of the monotone cubic at each breakpoint, per base unit of key */
+    std::vector<Scalar> slopes_;
+    /** Breakpoints in Eytzinger order from index 1, padded with the largest key */
+    std::vector<KeyScalar> tree_;
+    /** The sorted index of each element of tree_; ranks_[0] is past the end */
+    std::vector<std::size_t> ranks_;
+    /** The depth of tree_ */
+    std::size_t levels_ = 0;
+
+    template <typename Result, typename KeyArray>
+    static auto spans(Result& result, const KeyArray& keys) {
+      static_assert(std::is_same_v<UnitOf_t<std::decay_t<Result>>, UnitOf_t<ValueQuantity>>,
+                    "The result must have the unit of the tabulated values");
+      static_assert(std::is_same_v<UnitOf_t<KeyArray>, UnitOf_t<KeyQuantity>>,
+                    "The keys must have the unit of the breakpoints");
+      const QuantitySpan<Scalar, UnitOf_t<ValueQuantity>> out{result};
+      const QuantitySpan<const KeyScalar, UnitOf_t<KeyQuantity>> in{keys};
+      assert(out.isContiguous() && in.isContiguous());
+      assert(out.size() == in.size());
+      return std::make_pair(out, in);
+    }
+
+    void buildWidths() {
+      inverseWidths_.resize(size() - 1);
+      for (std::size_t i = 0; i + 1 < size(); ++i) {
+        inverseWidths_[i] = KeyScalar{1} / (keys_[i + 1] - keys_[i]);
+      }
+    }
+
+    /** Chooses slopes with the weighted harmonic mean of Fritsch and Butland, which
+     * are zero at local extrema and keep each interval monotone
+     */
+    void buildSlopes() {
+      const std::size_t n = size();
+      std::vector<Scalar> secants(n - 1);
+      for (std::size_t i = 0; i + 1 < n; ++i) {
+        secants[i] = (values_[i + 1] - values_[i]) * static_cast<Scalar>(inverseWidths_[i]);
+      }
+      slopes_.resize(n);
+      slopes_.front() = secants.front();
+      slopes_.back() = secants.back();
+      for (std::size_t i = 1; i + 1 < n; ++i) {
+        if (secants[i - 1] * secants[i] <= Scalar{}) {
+          slopes_[i] = Scalar{};
+        } else {
+          const Scalar before = static_cast<Scalar>(keys_[i] - keys_[i - 1]);
+          const Scalar after = static_cast<Scalar>(keys_[i + 1] - keys_[i]);
+          const Scalar w1 = Scalar{2} * after + before;
+          const Scalar w2 = after + Scalar{2} * before;
+          slopes_[i] = (w1 + w2) / (w1 / secants[i - 1] + w2 / secants[i]);
+        }
+      }
+    }
+
+    void buildTree() {
+      std::size_t capacity = 1;
+      levels_ = 0;
+      while (capacity <= size()) {
+        capacity *= 2;
+        ++levels_;
+      }
+      tree_.assign(capacity, keys_.back());
+      ranks_.assign(capacity, size());
+      fillTree(0, 1);
+    }
+
+    /** Fills the subtree at node k in order from sorted index i; returns the next index */
+    std::size_t fillTree(std::size_t i, std::size_t k) {
+      if (k < tree_.size()) {
+        i = fillTree(i, 2 * k);
+        if (i < size()) {
+          tree_[k] = keys_[i];
+          ranks_[k] = i;
+        }
+        i = fillTree(i + 1, 2 * k + 1);
+      }
+      return i;
+    }
+
+    /** The sorted index of the first breakpoint which is not less than x */
+    std::size_t lowerBound(KeyScalar x) const {
+      std::size_t k = 1;
+      std::size_t found = 0;
+      for (std::size_t level = 0; level < levels_; ++level) {
+        const bool less = tree_[k] < x;
+        found = less ? found : k;
+        k = 2 * k + less;
+      }
+      return ranks_[found];
+    }
+
+    /** The interval ending at breakpoint rank, clamped to the table, containing x */
+    AxisCell<KeyScalar> cell(std::size_t rank, KeyScalar x) const {
+      const std::size_t index = std::min(std::max(rank, std::size_t{1}), size() - 1) - 1;
+      const KeyScalar fraction = (x - keys_[index]) * inverseWidths_[index];
+      return AxisCell<KeyScalar>{index, std::clamp(fraction, KeyScalar{}, KeyScalar{1})};
+    }
+
+    Scalar evaluate(LinearInterpolation, const AxisCell<KeyScalar>& at) const {
+      const Scalar a = values_[at.index];
+      const Scalar b = values_[at.index + 1];
+      return a + static_cast<Scalar>(at.fraction) * (b - a);
+    }
+
+    /** Evaluates the cubic Hermite polynomial through the ends of the interval */
+    Scalar evaluate(MonotoneCubicInterpolation, const AxisCell<KeyScalar>& at) const {
+      const Scalar t = static_cast<Scalar>(at.fraction);
+      const Scalar width = static_cast<Scalar>(keys_[at.index + 1] - keys_[at.index]);
+      const Scalar s = Scalar{1} - t;
+      return (Scalar{1} + Scalar{2} * t) * s * s * values_[at.index] + t * s * s * width * slopes_[at.index] +
+             t * t * (Scalar{3} - Scalar{2} * t) * values_[at.index + 1] - t * t * s * width * slopes_[at.index + 1];
+    }
+  };
+
+  /** Makes a breakpoint table from arrays of strictly increasing breakpoints and the
+   * values at them
+   */
+  template <typename KeyArray, typename ValueArray>
+  auto makeBreakpointTable(const KeyArray& keys, const ValueArray& values) {
+    using Table = BreakpointTable<Quantity<ScalarOf_t<ValueArray>, UnitOf_t<ValueArray>>,
+                                  Quantity<ScalarOf_t<KeyArray>, UnitOf_t<KeyArray>>>;
+    return Table{keys, values};
+  }
+}  // namespace poids
+
+#endif
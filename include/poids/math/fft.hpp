@@ -0,0 +1,504 @@
+#ifndef POIDS_MATH_FFT_HPP
+#define POIDS_MATH_FFT_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/core/traits.hpp"
+#include "poids/scalar_support/batch.hpp"
+#include "poids/scalar_support/complex_array.hpp"
+
+namespace poids {
+  namespace detail {
+    /** An iterative radix-2 transform of a power-of-two size on split real and
+     * imaginary parts. The twiddle factors of every stage are precomputed and
+     * stored contiguously, so the butterflies of a stage are a NativeBatch at a
+     * time.
+     */
+    template <typename T>
+    class Radix2Plan {
+     public:
+      explicit Radix2Plan(std::size_t size) :
+          size_(size) {
+        assert(size >= 1 && (size & (size - 1)) == 0);
+        // The twiddles of the stage combining halves of length h are at [h, 2h)
+        twiddleReal_.resize(size);
+        twiddleImag_.resize(size);
+        const double tau = 6.283185307179586476925286766559;
+        for (std::size_t h = 1; h < size; h *= 2) {
+          for (std::size_t j = 0; j < h; ++j) {
+            const double angle = -tau * static_cast<double>(j) / static_cast<double>(2 * h);
+            twiddleReal_[h + j] = static_cast<T>(std::cos(angle));
+            twiddleImag_[h + j] = static_cast<T>(std::sin(angle));
+          }
+        }
+        std::size_t bits = 0;
+        while ((std::size_t{1} << bits) < size) {
+          ++bits;
+        }
+        for (std::size_t i = 0; i < size; ++i) {
+          std::size_t reversed = 0;
+          for (std::size_t b = 0; b < bits; ++b) {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+          }
+          if (i < reversed) {
+            swaps_.emplace_back(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(reversed));
+          }
+        }
+      }
+
+      std::size_t size() const { return size_; }
+
+      /** Transforms in place, without normalization, with the kernel exp(-2 pi i jk / n).
+       * The inverse transform is the forward transform with the parts swapped.
+       */
+      void forward(T* real, T* imag) const {
+        for (const auto& [i, j] : swaps_) {
+          std::swap(real[i], real[j]);
+          std::swap(imag[i], imag[j]);
+        }
+        using Lanes = NativeBatch<T>;
+        constexpr std::size_t lanes = Lanes::lanes;
+        for (std::size_t h = 1; h < size_; h *= 2) {
+          const T* wr = twiddleReal_.data() + h;
+          const T* wi = twiddleImag_.data() + h;
+          for (std::size_t start = 0; start < size_; start += 2 * h) {
+            T* ar = real + start;
+            T* ai = imag + start;
+            T* br = ar + h;
+            T* bi = ai + h;
+            std::size_t j = 0;
+            if (h >= lanes) {
+              for (; j + lanes <= h; j += lanes) {
+                const Lanes cr = Lanes::load(wr + j);
+                const Lanes ci = Lanes::load(wi + j);
+                const Lanes xr = Lanes::load(br + j);
+                const Lanes xi = Lanes::load(bi + j);
+                const Lanes tr = cr * xr - ci * xi;
+                const Lanes ti = cr * xi + ci * xr;
+                const Lanes yr = Lanes::load(ar + j);
+                const Lanes yi = Lanes::load(ai + j);
+                (yr - tr).store(br + j);
+                (yi - ti).store(bi + j);
+                (yr + tr).store(ar + j);
+                (yi + ti).store(ai + j);
+              }
+            }
+            for (; j < h; ++j) {
+              const T tr = wr[j] * br[j] - wi[j] * bi[j];
+              const T ti = wr[j] * bi[j] + wi[j] * br[j];
+              br[j] = ar[j] - tr;
+              bi[j] = ai[j] - ti;
+              ar[j] += tr;
+              ai[j] += ti;
+            }
+          }
+        }
+      }
+
+     private:
+      std::size_t size_;
+      std::vector<T> twiddleReal_;
+      std::vector<T> twiddleImag_;
+      std::vector<std::pair<std::uint32_t, std::uint32_t>> swaps_;
+    };
+  }  // namespace detail
+
+  /** A precomputed plan for discrete Fourier transforms of one size.
+   *
+   * Power-of-two sizes use an iterative radix-2 transform. Other sizes are
+   * rewritten as a convolution (Bluestein's algorithm) and computed with radix-2
+   * transforms of the next power of two at least twice as large, so every size
+   * costs O(n log n). A plan is immutable after construction and may be shared
+   * between threads and reused for any number of channels.
+   *
+   * \tparam T The real floating-point type of the parts of each element
+   */
+  template <typename T>
+  class FftPlan {
+    static_assert(std::is_floating_point_v<T>, "FftPlan requires a floating-point T");
+
+   public:
+    explicit FftPlan(std::size_t size) :
+        size_(size),
+        radix2_((size & (size - 1)) == 0 ? size : convolutionSize(size)) {
+      assert(size >= 1);
+      if (!isPowerOfTwo()) {
+        buildChirp();
+      }
+    }
+
+    /** The number of elements transformed */
+    std::size_t size() const { return size_; }
+
+    /** Transforms size() elements in place with the kernel exp(-2 pi i jk / n), without
+     * normalization
+     */
+    void forward(T* real, T* imag) const {
+      if (isPowerOfTwo()) {
+        radix2_.forward(real, imag);
+      } else {
+        bluestein(real, imag);
+      }
+    }
+
+    /** Transforms size() elements in place with the kernel exp(+2 pi i jk / n), without
+     * normalization
+     */
+    void inverse(T* real, T* imag) const { forward(imag, real); }
+
+   private:
+    std::size_t size_;
+    detail::Radix2Plan<T> radix2_;
+    /** exp(-pi i k^2 / n) for k < n */
+    std::vector<T> chirpReal_;
+    std::vector<T> chirpImag_;
+    /** The transform of the conjugate chirp, wrapped around the convolution */
+    std::vector<T> kernelReal_;
+    std::vector<T> kernelImag_;
+
+    bool isPowerOfTwo() const { return radix2_.size() == size_; }
+
+    static std::size_t convolutionSize(std::size_t size) {
+      std::size_t result = 1;
+      while (result < 2 * size - 1) {
+        result *= 2;
+      }
+      return result;
+    }
+
+    void buildChirp() {
+      const std::size_t m = radix2_.size();
+      chirpReal_.resize(size_);
+      chirpImag_.resize(size_);
+      kernelReal_.assign(m, T{});
+      kernelImag_.assign(m, T{});
+      const double pi = 3.1415926535897932384626433832795;
+      for (std::size_t k = 0; k < size_; ++k) {
+        // k^2 mod 2n keeps the angle small, so large sizes do not lose precision
+        const std::size_t square = (k * k) % (2 * size_);
+        const double angle = -pi * static_cast<double>(square) / static_cast<double>(size_);
+        chirpReal_[k] = static_cast<T>(std::cos(angle));
+        chirpImag_[k] = static_cast<T>(std::sin(angle));
+        kernelReal_[k] = chirpReal_[k];
+        kernelImag_[k] = -chirpImag_[k];
+        if (k != 0) {
+          kernelReal_[m - k] = chirpReal_[k];
+          kernelImag_[m - k] = -chirpImag_[k];
+        }
+      }
+      radix2_.forward(kernelReal_.data(), kernelImag_.data());
+      // Fold the normalization of the inverse transform into the kernel
+      const T scale = T{1} / static_cast<T>(m);
+      for (std::size_t k = 0; k < m; ++k) {
+        kernelReal_[k] *= scale;
+        kernelImag_[k] *= scale;
+      }
+    }
+
+    void bluestein(T* real, T* imag) const {
+      const std::size_t m = radix2_.size();
+      std::vector<T> ar(m, T{});
+      std::vector<T> ai(m, T{});
+      for (std::size_t k = 0; k < size_; ++k) {
+        ar[k] = real[k] * chirpReal_[k] - imag[k] * chirpImag_[k];
+        ai[k] = real[k] * chirpImag_[k] + imag[k] * chirpReal_[k];
+      }
+      radix2_.forward(ar.data(), ai.data());
+      for (std::size_t k = 0; k < m; ++k) {
+        const T r = ar[k] * kernelReal_[k] - ai[k] * kernelImag_[k];
+        const T i = ar[k] * kernelImag_[k] + ai[k] * kernelReal_[k];
+        ar[k] = r;
+        ai[k] = i;
+      }
+      radix2_.forward(ai.data(), ar.data());
+      for (std::size_t k = 0; k < size_; ++k) {
+        real[k] = ar[k] * chirpReal_[k] - ai[k] * chirpImag_[k];
+        imag[k] = ar[k] * chirpImag_[k] + ai[k] * chirpReal_[k];
+      }
+    }
+  };
+
+  /** A precomputed plan for discrete Fourier transforms of real signals of an even
+   * size n. The signal is packed into a complex signal of n / 2 elements, so a
+   * transform costs about half as much as a complex transform of n elements. Only
+   * the n / 2 + 1 non-negative frequencies are produced, since the others are their
+   * complex conjugates.
+   *
+   * \tparam T The real floating-point type of the signal
+   */
+  template <typename T>
+  class RealFftPlan {
+   public:
+    explicit RealFftPlan(std::size_t size) :
+        size_(size),
+        half_(size / 2),
+        twiddleReal_(size / 2),
+        twiddleImag_(size / 2) {
+      assert(size >= 2 && size % 2 == 0);
+      const double tau = 6.283185307179586476925286766559;
+      for (std::size_t k = 0; k < size / 2; ++k) {
+        const double angle = -tau * static_cast<double>(k) / static_cast<double>(size);
+        twiddleReal_[k] = static_cast<T>(std::cos(angle));
+        twiddleImag_[k] = static_cast<T>(std::sin(angle));
+      }
+    }
+
+    /** The number of real samples transformed */
+    std::size_t size() const { return size_; }
+    /** The number of frequencies produced, size() / 2 + 1 */
+    std::size_t spectrumSize() const { return size_ / 2 + 1; }
+
+    /** Transforms size() real samples into spectrumSize() complex values, without
+     * normalization
+     */
+    void forward(const T* signal, T* real, T* imag) const {
+      const std::size_t n = half_.size();
+      for (std::size_t m = 0; m < n; ++m) {
+        real[m] = signal[2 * m];
+        imag[m] = signal[2 * m + 1];
+      }
+      half_.forward(real, imag);
+      // Split the transform of the packed signal into those of the even and odd samples
+      const T zr = real[0];
+      const T zi = imag[0];
+      real[n] = zr - zi;
+      imag[n] = T{};
+      real[0] = zr + zi;
+      imag[0] = T{};
+      for (std::size_t k = 1; 2 * k <= n; ++k) {
+        const std::size_t l = n - k;
+        const T er = T{0.5} * (real[k] + real[l]);
+        const T ei = T{0.5} * (imag[k] - imag[l]);
+        const T orr = T{0.5} * (imag[k] + imag[l]);
+        const T oi = T{0.5} * (real[l] - real[k]);
+        const T tr = twiddleReal_[k] * orr - twiddleImag_[k] * oi;
+        const T ti = twiddleReal_[k] * oi + twiddleImag_[k] * orr;
+        // The odd part enters bin l with the twiddle of l, which is -conj of that of k
+        real[k] = er + tr;
+        imag[k] = ei + ti;
+        real[l] = er - tr;
+        imag[l] = ti - ei;
+      }
+    }
+
+    /** Transforms spectrumSize() complex values of a real signal back into size() real
+     * samples, without normalization. The spectrum is overwritten.
+     */
+    void inverse(T* real, T* imag, T* signal) const {
+      const std::size_t n = half_.size();
+      // Recombine the transforms of the even and odd samples into a packed signal
+      const T r0 = real[0];
+      const T rn = real[n];
+      real[0] = r0 + rn;
+      imag[0] = r0 - rn;
+      for (std::size_t k = 1; 2 * k <= n; ++k) {
+        const std::size_t l = n - k;
+        const T er = real[k] + real[l];
+        const T ei = imag[k] - imag[l];
+        const T dr = real[k] - real[l];
+        const T di = imag[k] + imag[l];
+        // The odd part is (X_k - conj(X_l)) times the conjugate twiddle of k
+        const T orr = twiddleReal_[k] * dr + twiddleImag_[k] * di;
+        const T oi = twiddleReal_[k] * di - twiddleImag_[k] * dr;
+        real[k] = er - oi;
+        imag[k] = ei + orr;
+        real[l] = er + oi;
+        imag[l] = orr - ei;
+      }
+      half_.inverse(real, imag);
+      for (std::size_t m = 0; m < n; ++m) {
+        signal[2 * m] = real[m];
+        signal[2 * m + 1] = imag[m];
+      }
+    }
+
+   private:
+    std::size_t size_;
+    FftPlan<T> half_;
+    std::vector<T> twiddleReal_;
+    std::vector<T> twiddleImag_;
+  };
+
+  /** The continuous Fourier transform of a complex signal sampled every
+   * sampleInterval, approximated by the discrete transform times sampleInterval. A
+   * signal in Unit has a spectrum in Unit times the unit of sampleInterval, e.g. an
+   * acceleration in m/s^2 has a spectrum in m/s.
+   */
+  template <typename T, typename UnitType, typename Interval>
+  QuantityComplexArray<T, typename UnitType::template multiply_t<UnitOf_t<Interval>>>
+  fourierTransform(const FftPlan<T>& plan, const QuantityComplexArray<T, UnitType>& signal, const Interval& sampleInterval) {
+    using Result = QuantityComplexArray<T, typename UnitType::template multiply_t<UnitOf_t<Interval>>>;
+    assert(signal.size() == plan.size());
+    const T* re = signal.real().data();
+    const T* im = signal.imag().data();
+    typename Result::Lane real(re, re + signal.size());
+    typename Result::Lane imag(im, im + signal.size());
+    plan.forward(real.data(), imag.data());
+    const T scale = static_cast<T>(sampleInterval.base());
+    for (std::size_t k = 0; k < real.size(); ++k) {
+      real[k] *= scale;
+      imag[k] *= scale;
+    }
+    return Result::makeFromBaseUnitValues(std::move(real), std::move(imag));
+  }
+
+  /** Inverts fourierTransform of a complex signal sampled every sampleInterval */
+  template <typename T, typename UnitType, typename Interval>
+  QuantityComplexArray<T, typename UnitType::template divide_t<UnitOf_t<Interval>>>
+  inverseFourierTransform(const FftPlan<T>& plan, const QuantityComplexArray<T, UnitType>& spectrum,
+                          const Interval& sampleInterval) {
+    using Result = QuantityComplexArray<T, typename UnitType::template divide_t<UnitOf_t<Interval>>>;
+    assert(spectrum.size() == plan.size());
+    const T* re = spectrum.real().data();
+    const T* im = spectrum.imag().data();
+    typename Result::Lane real(re, re + spectrum.size());
+    typename Result::Lane imag(im, im + spectrum.size());
+    plan.inverse(real.data(), imag.data());
+    const T scale = T{1} / (static_cast<T>(plan.size()) * static_cast<T>(sampleInterval.base()));
+    for (std::size_t k = 0; k < real.size(); ++k) {
+      real[k] *= scale;
+      imag[k] *= scale;
+    }
+    return Result::makeFromBaseUnitValues(std::move(real), std::move(imag));
+  }
+
+  /** The continuous Fourier transform of a real signal sampled every sampleInterval,
+   * at the plan.spectrumSize() non-negative frequencies of spectrumFrequencies
+   */
+  template <typename T, typename Signal, typename Interval>
+  QuantityComplexArray<T, typename UnitOf_t<Signal>::template multiply_t<UnitOf_t<Interval>>>
+  fourierTransform(const RealFftPlan<T>& plan, const Signal& signal, const Interval& sampleInterval) {
+    using Result = QuantityComplexArray<T, typename UnitOf_t<Signal>::template multiply_t<UnitOf_t<Interval>>>;
+    const QuantitySpan<const T, UnitOf_t<Signal>> samples{signal};
+    assert(samples.size() == plan.size() && samples.isContiguous());
+    typename Result::Lane real(plan.spectrumSize());
+    typename Result::Lane imag(plan.spectrumSize());
+    plan.forward(samples.data(), real.data(), imag.data());
+    const T scale = static_cast<T>(sampleInterval.base());
+    for (std::size_t k = 0; k < real.size(); ++k) {
+      real[k] *= scale;
+      imag[k] *= scale;
+    }
+    return Result::makeFromBaseUnitValues(std::move(real), std::move(imag));
+  }
+
+  /** Inverts fourierTransform of a real signal sampled every sampleInterval */
+  template <typename T, typename UnitType, typename Interval>
+  QuantityArray<T, typename UnitType::template divide_t<UnitOf_t<Interval>>>
+  inverseFourierTransform(const RealFftPlan<T>& plan, const QuantityComplexArray<T, UnitType>& spectrum,
+                          const Interval& sampleInterval) {
+    using Result = QuantityArray<T, typename UnitType::template divide_t<UnitOf_t<Interval>>>;
+    assert(spectrum.size() == plan.spectrumSize());
+    const T* re = spectrum.real().data();
+    const T* im = spectrum.imag().data();
+    std::vector<T> real(re, re + spectrum.size());
+    std::vector<T> imag(im, im + spectrum.size());
+    Result result(plan.size(), uninitialized);
+    plan.inverse(real.data(), imag.data(), result.data());
+    const T scale = T{1} / (static_cast<T>(plan.size()) * static_cast<T>(sampleInterval.base()));
+    T* out = result.data();
+    for (std::size_t i = 0; i < plan.size(); ++i) {
+      out[i] *= scale;
+    }
+    return result;
+  }
+
+  /** The size / 2 + 1 non-negative frequencies of the transform of a real signal of
+   * size samples taken every sampleInterval, e.g. in hertz for an interval in seconds
+   */
+  template <typename Interval>
+  QuantityArray<ScalarOf_t<Interval>, typename UnitOf_t<Interval>::template power_t<-1, 1>>
+  spectrumFrequencies(std::size_t size, const Interval& sampleInterval) {
+    using T = ScalarOf_t<Interval>;
+    QuantityArray<T, typename UnitOf_t<Interval>::template power_t<-1, 1>> result(size / 2 + 1, uninitialized);
+    const T step = T{1} / (static_cast<T>(size) * sampleInterval.base());
+    for (std::size_t k = 0; k < result.size(); ++k) {
+      result.data()[k] = static_cast<T>(k) * step;
+    }
+    return result;
+  }
+
+  /** A one-sided power spectral density and the frequencies it is given at */
+  template <typename FrequencyArray, typename DensityArray>
+  struct PowerSpectrum {
+    FrequencyArray frequencies;
+    DensityArray density;
+  };
+
+  /** Estimates the one-sided power spectral density of a real signal sampled every
+   * sampleInterval with Welch's method: the periodograms of Hann-windowed segments of
+   * plan.size() samples, each starting overlap samples before the previous one ends
+   * and with its mean removed, are averaged. A signal in Unit has a density in Unit^2
+   * times the unit of sampleInterval, e.g. (m/s^2)^2 / Hz, and the density integrates
+   * over frequency to the mean square of the signal.
+   */
+  template <typename T, typename Signal, typename Interval>
+  auto welch(const RealFftPlan<T>& plan, const Signal& signal, const Interval& sampleInterval, std::size_t overlap) {
+    using SignalUnit = UnitOf_t<Signal>;
+    using DensityUnit = typename SignalUnit::template multiply_t<SignalUnit>::template multiply_t<UnitOf_t<Interval>>;
+    const QuantitySpan<const T, SignalUnit> samples{signal};
+    const std::size_t length = plan.size();
+    const std::size_t bins = plan.spectrumSize();
+    assert(samples.isContiguous() && samples.size() >= length && overlap < length);
+
+    std::vector<T> window(length);
+    T windowPower{};
+    const double tau = 6.283185307179586476925286766559;
+    for (std::size_t i = 0; i < length; ++i) {
+      window[i] = static_cast<T>(0.5 - 0.5 * std::cos(tau * static_cast<double>(i) / static_cast<double>(length)));
+      windowPower += window[i] * window[i];
+    }
+
+    QuantityArray<T, DensityUnit> density(bins);
+    T* sum = density.data();
+    std::vector<T> segment(length);
+    std::vector<T> real(bins);
+    std::vector<T> imag(bins);
+    const std::size_t step = length - overlap;
+    std::size_t segments = 0;
+    for (std::size_t start = 0; start + length <= samples.size(); start += step, ++segments) {
+      const T* x = samples.data() + start;
+      T mean{};
+      for (std::size_t i = 0; i < length; ++i) {
+        mean += x[i];
+      }
+      mean /= static_cast<T>(length);
+      for (std::size_t i = 0; i < length; ++i) {
+        segment[i] = (x[i] - mean) * window[i];
+      }
+      plan.forward(segment.data(), real.data(), imag.data());
+      for (std::size_t k = 0; k < bins; ++k) {
+        sum[k] += real[k] * real[k] + imag[k] * imag[k];
+      }
+    }
+
+    // Every bin but zero and the Nyquist frequency also holds the negative frequency
+    const T scale = static_cast<T>(sampleInterval.base()) / (windowPower * static_cast<T>(segments));
+    for (std::size_t k = 0; k < bins; ++k) {
+      sum[k] *= (k == 0 || k == bins - 1) ? scale : T{2} * scale;
+    }
+    using Frequencies = decltype(spectrumFrequencies(length, sampleInterval));
+    return PowerSpectrum<Frequencies, QuantityArray<T, DensityUnit>>{spectrumFrequencies(length, sampleInterval),
+                                                                     std::move(density)};
+  }
+
+  /** Estimates the power spectral density with Welch's method on segments of
+   * segmentLength samples overlapping by half
+   */
+  template <typename Signal, typename Interval>
+  auto welch(const Signal& signal, const Interval& sampleInterval, std::size_t segmentLength) {
+    const RealFftPlan<ScalarOf_t<Signal>> plan(segmentLength);
+    return welch(plan, signal, sampleInterval, segmentLength / 2);
+  }
+}  // namespace poids
+
+#endif
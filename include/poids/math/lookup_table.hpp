@@ -0,0 +1,313 @@
+#ifndef POIDS_MATH_LOOKUP_TABLE_HPP
+#define POIDS_MATH_LOOKUP_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/core/traits.hpp"
+#include "poids/core/uninitialized.hpp"
+
+namespace poids {
+  /** Interpolates linearly between the two nearest grid points along each axis */
+  struct LinearInterpolation {
+    explicit LinearInterpolation() = default;
+  };
+
+  /** Interpolates with Catmull-Rom cubics through the four nearest grid points along
+   * each axis. The result has a continuous first derivative and reproduces
+   * quadratics exactly away from the ends of the axes.
+   */
+  struct CubicInterpolation {
+    explicit CubicInterpolation() = default;
+  };
+
+  inline constexpr LinearInterpolation linearInterpolation{};
+  inline constexpr CubicInterpolation cubicInterpolation{};
+
+  namespace detail {
+    template <typename T>
+    inline constexpr bool IsInterpolation_v =
+        std::is_same_v<T, LinearInterpolation> || std::is_same_v<T, CubicInterpolation>;
+  }  // namespace detail
+
+  /** The position of a key on an axis: the cell [index, index + 1] which contains it
+   * and the fraction of the way across that cell
+   */
+  template <typename Scalar>
+  struct AxisCell {
+    std::size_t index;
+    Scalar fraction;
+  };
+
+  /** An axis of a lookup table with count evenly spaced grid points from first to
+   * last. A key is located with a single multiply-add, without a search.
+   *
+   * \tparam KeyQuantity The quantity type of the keys, such as si::Temperature
+   */
+  template <typename KeyQuantity>
+  class UniformAxis {
+    static_assert(IsQuantity_v<KeyQuantity>, "The keys of an axis must be a poids::Quantity");
+
+   public:
+    using Key = Quantity<ScalarOf_t<KeyQuantity>, UnitOf_t<KeyQuantity>>;
+    using Scalar = ScalarOf_t<KeyQuantity>;
+    using Unit = UnitOf_t<KeyQuantity>;
+
+    template <typename FirstQuantity, typename LastQuantity>
+    UniformAxis(const FirstQuantity& first, const LastQuantity& last, std::size_t count) :
+        first_(first.base()),
+        step_((last.base() - first.base()) / static_cast<Scalar>(count - 1)),
+        inverseStep_(static_cast<Scalar>(count - 1) / (last.base() - first.base())),
+        offset_(-first.base() * inverseStep_),
+        count_(count) {
+      static_assert(std::is_same_v<UnitOf_t<FirstQuantity>, Unit> && std::is_same_v<UnitOf_t<LastQuantity>, Unit>,
+                    "The ends of an axis must have the unit of its keys");
+      assert(count >= 2);
+      assert(last.base() > first.base());
+    }
+
+    /** The number of grid points */
+    std::size_t size() const { return count_; }
+
+    /** The key of grid point i */
+    Key operator[](std::size_t i) const {
+      assert(i < count_);
+      return Key::makeFromBaseUnitValue(first_ + static_cast<Scalar>(i) * step_);
+    }
+
+    Key front() const { return Key::makeFromBaseUnitValue(first_); }
+    Key back() const { return (*this)[count_ - 1]; }
+    Key step() const { return Key::makeFromBaseUnitValue(step_); }
+
+    /** Locates the cell of a key. Keys beyond the ends of the axis are clamped to
+     * them, and a NaN key lies in the first cell with a NaN fraction, so that
+     * lookups return NaN as for a BreakpointTable.
+     */
+    AxisCell<Scalar> locate(const Key& key) const { return locateBase(key.base()); }
+
+    /** Locates the cell of a key in base units */
+    AxisCell<Scalar> locateBase(Scalar key) const {
+      const Scalar position = std::clamp(key * inverseStep_ + offset_, Scalar{}, static_cast<Scalar>(count_ - 1));
+      // std::clamp passes NaN through, and converting it to an integer is undefined
+      const std::size_t index = !(position >= Scalar{}) ? 0 : std::min(static_cast<std::size_t>(position), count_ - 2);
+      return AxisCell<Scalar>{index, position - static_cast<Scalar>(index)};
+    }
+
+   private:
+    Scalar first_;
+    Scalar step_;
+    Scalar inverseStep_;
+    Scalar offset_;
+    std::size_t count_;
+  };
+
+  template <typename FirstQuantity, typename LastQuantity>
+  UniformAxis(const FirstQuantity&, const LastQuantity&, std::size_t)
+      -> UniformAxis<Quantity<ScalarOf_t<FirstQuantity>, UnitOf_t<FirstQuantity>>>;
+
+  namespace detail {
+    template <typename Scalar>
+    std::array<Scalar, 4> catmullRomWeights(Scalar t) {
+      const Scalar t2 = t * t;
+      const Scalar t3 = t2 * t;
+      return {Scalar{0.5} * (-t3 + Scalar{2} * t2 - t),
+              Scalar{0.5} * (Scalar{3} * t3 - Scalar{5} * t2 + Scalar{2}),
+              Scalar{0.5} * (Scalar{-3} * t3 + Scalar{4} * t2 + t),
+              Scalar{0.5} * (t3 - t2)};
+    }
+  }  // namespace detail
+
+  /** A table of a quantity-valued function sampled on a uniform grid of one, two
+   * or three quantity-valued keys, such as density against temperature and
+   * pressure. Values are stored contiguously, with the last axis varying fastest.
+   *
+   * Lookups locate the cell along each axis with a multiply-add and interpolate
+   * linearly (the default) or with cubics. The keys of a lookup are checked against
+   * the units of the axes at compile time.
+   *
+   * \tparam ValueQuantity The quantity type of the tabulated values
+   * \tparam Axes The axis types, such as UniformAxis<si::Temperature>
+   */
+  template <typename ValueQuantity, typename... Axes>
+  class LookupTable {
+    static_assert(sizeof...(Axes) >= 1 && sizeof...(Axes) <= 3, "Lookup tables have between one and three axes");
+    static_assert(IsQuantity_v<ValueQuantity>, "The values of a lookup table must be a poids::Quantity");
+
+   public:
+    using Value = Quantity<ScalarOf_t<ValueQuantity>, UnitOf_t<ValueQuantity>>;
+    using Scalar = ScalarOf_t<ValueQuantity>;
+
+    /** The number of axes */
+    static constexpr std::size_t dimensions = sizeof...(Axes);
+
+    /** Constructs a table from the values at every grid point, in row-major order */
+    LookupTable(const Axes&... axes, QuantityArray<Scalar, UnitOf_t<ValueQuantity>> values) :
+        axes_{axes...},
+        values_(std::move(values)) {
+      assert(values_.size() == (axes.size() * ...));
+    }
+
+    /** Accesses axis I */
+    template <std::size_t I>
+    const auto& axis() const { return std::get<I>(axes_); }
+
+    /** The value at every grid point, in row-major order */
+    const QuantityArray<Scalar, UnitOf_t<ValueQuantity>>& values() const { return values_; }
+
+    /** Interpolates linearly at keys, one per axis */
+    template <typename... Keys>
+    Value operator()(const Keys&... keys) const {
+      return interpolate(linearInterpolation, keys...);
+    }
+
+    /** Interpolates at keys, one per axis, with the given method */
+    template <typename Interpolation, typename... Keys>
+    Value interpolate(Interpolation, const Keys&... keys) const {
+      checkKeys<Keys...>(std::index_sequence_for<Axes...>{});
+      return Value::makeFromBaseUnitValue(interpolateBase(Interpolation{}, std::index_sequence_for<Axes...>{},
+                                                          Quantity<ScalarOf_t<Keys>, UnitOf_t<Keys>>{keys}.base()...));
+    }
+
+    /** Interpolates at every element of the key arrays, one per axis, writing to
+     * result. The units are checked once for the whole arrays, and the loop works on
+     * base unit values.
+     */
+    template <typename Result, typename... KeyArrays,
+              typename = std::enable_if_t<!detail::IsInterpolation_v<std::decay_t<Result>>>>
+    void interpolateEach(Result&& result, const KeyArrays&... keys) const {
+      interpolateEach(linearInterpolation, std::forward<Result>(result), keys...);
+    }
+
+    template <typename Interpolation, typename Result, typename... KeyArrays,
+              typename = std::enable_if_t<detail::IsInterpolation_v<Interpolation>>>
+    void interpolateEach(Interpolation, Result&& result, const KeyArrays&... keys) const {
+      checkKeys<KeyArrays...>(std::index_sequence_for<Axes...>{});
+      static_assert(std::is_same_v<UnitOf_t<std::decay_t<Result>>, UnitOf_t<ValueQuantity>>,
+                    "The result must have the unit of the tabulated values");
+      const QuantitySpan<Scalar, UnitOf_t<ValueQuantity>> out{result};
+      assert(out.isContiguous());
+      const std::size_t count = out.size();
+      const auto inputs = std::make_tuple(QuantitySpan<const ScalarOf_t<KeyArrays>, UnitOf_t<KeyArrays>>{keys}...);
+
+      Scalar* data = out.data();
+      std::apply(
+          [&](const auto&... spans) {
+            assert(((spans.size() == count && spans.isContiguous()) && ...));
+            for (std::size_t i = 0; i < count; ++i) {
+              data[i] = interpolateBase(Interpolation{}, std::index_sequence_for<Axes...>{}, spans.data()[i]...);
+            }
+          },
+          inputs);
+    }
+
+   private:
+    std::tuple<Axes...> axes_;
+    QuantityArray<Scalar, UnitOf_t<ValueQuantity>> values_;
+
+    template <typename... Keys, std::size_t... I>
+    static constexpr void checkKeys(std::index_sequence<I...>) {
+      static_assert(sizeof...(Keys) == sizeof...(Axes), "A lookup needs one key per axis");
+      static_assert((std::is_same_v<UnitOf_t<std::decay_t<Keys>>, typename std::tuple_element_t<I, std::tuple<Axes...>>::Unit> && ...),
+                    "Each key must have the unit of its axis");
+    }
+
+    template <typename Interpolation, std::size_t... I, typename... KeyScalars>
+    Scalar interpolateBase(Interpolation, std::index_sequence<I...>, const KeyScalars&... keys) const {
+      const std::array<AxisCell<Scalar>, dimensions> cells{toCell(std::get<I>(axes_).locateBase(keys))...};
+      if constexpr (std::is_same_v<Interpolation, CubicInterpolation>) {
+        return cubic<0>(cells, 0);
+      } else {
+        static_assert(std::is_same_v<Interpolation, LinearInterpolation>, "Unknown interpolation method");
+        return linear<0>(cells, 0);
+      }
+    }
+
+    template <typename KeyScalar>
+    static AxisCell<Scalar> toCell(const AxisCell<KeyScalar>& cell) {
+      return AxisCell<Scalar>{cell.index, static_cast<Scalar>(cell.fraction)};
+    }
+
+    /** Interpolates along axis Axis and those after it, within the block of values
+     * selected by offset on the earlier axes
+     */
+    template <std::size_t Axis>
+    Scalar linear(const std::array<AxisCell<Scalar>, dimensions>& cells, std::size_t offset) const {
+      if constexpr (Axis == dimensions) {
+        return values_.data()[offset];
+      } else {
+        const std::size_t first = offset * std::get<Axis>(axes_).size() + cells[Axis].index;
+        const Scalar a = linear<Axis + 1>(cells, first);
+        const Scalar b = linear<Axis + 1>(cells, first + 1);
+        return a + cells[Axis].fraction * (b - a);
+      }
+    }
+
+    template <std::size_t Axis>
+    Scalar cubic(const std::array<AxisCell<Scalar>, dimensions>& cells, std::size_t offset) const {
+      if constexpr (Axis == dimensions) {
+        return values_.data()[offset];
+      } else {
+        const std::size_t size = std::get<Axis>(axes_).size();
+        const std::size_t index = cells[Axis].index;
+        const std::array<Scalar, 4> weights = detail::catmullRomWeights(cells[Axis].fraction);
+        // Points beyond the ends of the axis repeat the end points
+        const std::size_t before = index == 0 ? 0 : index - 1;
+        const std::size_t after = std::min(index + 2, size - 1);
+        const std::size_t base = offset * size;
+        return weights[0] * cubic<Axis + 1>(cells, base + before) + weights[1] * cubic<Axis + 1>(cells, base + index) +
+               weights[2] * cubic<Axis + 1>(cells, base + index + 1) + weights[3] * cubic<Axis + 1>(cells, base + after);
+      }
+    }
+  };
+
+  /** A lookup table on uniform axes */
+  template <typename ValueQuantity, typename... Keys>
+  using UniformTable = LookupTable<ValueQuantity, UniformAxis<Keys>...>;
+
+  /** Tabulates f at every grid point of the axes. f is called with one key per
+   * axis, so its parameters are checked against the units of the axes at compile
+   * time, and it must return a quantity.
+   */
+  template <typename Function, typename... Axes>
+  auto makeLookupTable(Function&& f, const Axes&... axes) {
+    using Result = std::decay_t<std::invoke_result_t<Function&, const typename Axes::Key&...>>;
+    static_assert(IsQuantity_v<Result>, "The tabulated function must return a poids::Quantity");
+    using Table = LookupTable<Quantity<ScalarOf_t<Result>, UnitOf_t<Result>>, Axes...>;
+
+    QuantityArray<ScalarOf_t<Result>, UnitOf_t<Result>> values((axes.size() * ...), uninitialized);
+    ScalarOf_t<Result>* out = values.data();
+    if constexpr (sizeof...(Axes) == 1) {
+      const auto& [x] = std::tie(axes...);
+      for (std::size_t i = 0; i < x.size(); ++i) {
+        *out++ = f(x[i]).base();
+      }
+    } else if constexpr (sizeof...(Axes) == 2) {
+      const auto& [x, y] = std::tie(axes...);
+      for (std::size_t i = 0; i < x.size(); ++i) {
+        for (std::size_t j = 0; j < y.size(); ++j) {
+          *out++ = f(x[i], y[j]).base();
+        }
+      }
+    } else {
+      const auto& [x, y, z] = std::tie(axes...);
+      for (std::size_t i = 0; i < x.size(); ++i) {
+        for (std::size_t j = 0; j < y.size(); ++j) {
+          for (std::size_t k = 0; k < z.size(); ++k) {
+            *out++ = f(x[i], y[j], z[k]).base();
+          }
+        }
+      }
+    }
+    return Table{axes..., std::move(values)};
+  }
+}  // namespace poids
+
+#endif
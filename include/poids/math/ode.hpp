@@ -0,0 +1,328 @@
+#ifndef POIDS_MATH_ODE_HPP
+#define POIDS_MATH_ODE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/core/traits.hpp"
+#include "poids/scalar_support/batch.hpp"
+
+namespace poids {
+  /** The derivative with respect to TimeQuantity of a State, which is a Quantity or a
+   * std::tuple of Quantities. Each unit is divided by the unit of TimeQuantity.
+   */
+  template <typename State, typename TimeQuantity>
+  struct DerivativeOf {
+    using type = Quantity<ScalarOf_t<State>,
+                          typename UnitOf_t<State>::template divide_t<UnitOf_t<TimeQuantity>>>;
+  };
+
+  template <typename... Quantities, typename TimeQuantity>
+  struct DerivativeOf<std::tuple<Quantities...>, TimeQuantity> {
+    using type = std::tuple<typename DerivativeOf<Quantities, TimeQuantity>::type...>;
+  };
+
+  template <typename State, typename TimeQuantity>
+  using DerivativeOf_t = typename DerivativeOf<State, TimeQuantity>::type;
+
+  /** The tolerance of adaptive integration. Each error must be within
+   * absolute + relative * |state|, with absolute in the units of the state.
+   */
+  template <typename State>
+  struct OdeTolerance {
+    double relative;
+    State absolute;
+  };
+
+  /** A state with an estimate of its local error, in the units of the state */
+  template <typename State>
+  struct EmbeddedStep {
+    State state;
+    State error;
+  };
+
+  /** The outcome of adaptive integration */
+  template <typename State, typename TimeQuantity>
+  struct AdaptiveSolution {
+    State state;
+    TimeQuantity time;
+    /** The step size for continuing the integration */
+    TimeQuantity step;
+    std::size_t accepted;
+    std::size_t rejected;
+    /** Whether time reached t1, rather than the step vanishing or maxSteps being taken */
+    bool completed;
+  };
+
+  namespace detail {
+    inline constexpr std::size_t DefaultOdeSteps = 100000;
+
+    template <typename T>
+    struct IsTuple : public std::false_type { };
+
+    template <typename... Ts>
+    struct IsTuple<std::tuple<Ts...>> : public std::true_type { };
+
+    template <std::size_t I, typename Op, typename... States>
+    auto mapComponent(Op& op, const States&... states) {
+      return op(std::get<I>(states)...);
+    }
+
+    template <typename Op, std::size_t... I, typename... States>
+    auto mapTuple(Op& op, std::index_sequence<I...>, const States&... states) {
+      return std::make_tuple(mapComponent<I>(op, states...)...);
+    }
+
+    /** Applies op to corresponding components of states, which are all Quantities or
+     * all tuples of the same size
+     */
+    template <typename Op, typename First, typename... States>
+    auto mapState(Op op, const First& first, const States&... states) {
+      if constexpr (IsTuple<First>::value) {
+        return mapTuple(op, std::make_index_sequence<std::tuple_size_v<First>>{}, first, states...);
+      } else {
+        return op(first, states...);
+      }
+    }
+
+    /** The root mean square of the components of error, each scaled by its tolerance */
+    template <typename State>
+    double scaledErrorNorm(const State& error,
+                           const State& previous,
+                           const State& next,
+                           const OdeTolerance<State>& tolerance) {
+      double sumOfSquares = 0.0;
+      std::size_t count = 0;
+      // All arguments of a component share a unit, so their ratio is the same in base units.
+      // A zero error is within any tolerance, even a zero one.
+      mapState(
+          [&](const auto& e, const auto& y0, const auto& y1, const auto& absolute) {
+            using std::abs;
+            const double scale = static_cast<double>(absolute.base()) +
+                                 tolerance.relative * static_cast<double>(std::max(abs(y0.base()), abs(y1.base())));
+            const double value = static_cast<double>(e.base());
+            const double ratio = value == 0.0 ? 0.0 : value / scale;
+            sumOfSquares += ratio * ratio;
+            ++count;
+            return 0;
+          },
+          error, previous, next, tolerance.absolute);
+      return std::sqrt(sumOfSquares / static_cast<double>(count));
+    }
+
+    /** One Dormand-Prince step from (t, y) whose derivative there is k1 */
+    template <typename Function, typename TimeQuantity, typename State, typename Derivative>
+    EmbeddedStep<State> dormandPrince(Function& f,
+                                      const TimeQuantity& t,
+                                      const State& y,
+                                      const Derivative& k1,
+                                      const TimeQuantity& dt,
+                                      Derivative& k7) {
+      const Derivative k2 = f(t + dt * (1.0 / 5.0),
+                              State{mapState([&](const auto& y, const auto& k1) { return y + dt * (k1 * (1.0 / 5.0)); },
+                                             y, k1)});
+      const Derivative k3 = f(t + dt * (3.0 / 10.0),
+                              State{mapState([&](const auto& y, const auto& k1, const auto& k2) {
+                                               return y + dt * (k1 * (3.0 / 40.0) + k2 * (9.0 / 40.0));
+                                             },
+                                             y, k1, k2)});
+      const Derivative k4 = f(t + dt * (4.0 / 5.0),
+                              State{mapState([&](const auto& y, const auto& k1, const auto& k2, const auto& k3) {
+                                               return y + dt * (k1 * (44.0 / 45.0) - k2 * (56.0 / 15.0) + k3 * (32.0 / 9.0));
+                                             },
+                                             y, k1, k2, k3)});
+      const Derivative k5 = f(t + dt * (8.0 / 9.0),
+                              State{mapState([&](const auto& y, const auto& k1, const auto& k2, const auto& k3, const auto& k4) {
+                                               return y + dt * (k1 * (19372.0 / 6561.0) - k2 * (25360.0 / 2187.0) +
+                                                                k3 * (64448.0 / 6561.0) - k4 * (212.0 / 729.0));
+                                             },
+                                             y, k1, k2, k3, k4)});
+      const Derivative k6 = f(t + dt,
+                              State{mapState([&](const auto& y, const auto& k1, const auto& k2, const auto& k3, const auto& k4, const auto& k5) {
+                                               return y + dt * (k1 * (9017.0 / 3168.0) - k2 * (355.0 / 33.0) +
+                                                                k3 * (46732.0 / 5247.0) + k4 * (49.0 / 176.0) -
+                                                                k5 * (5103.0 / 18656.0));
+                                             },
+                                             y, k1, k2, k3, k4, k5)});
+      const State next{mapState([&](const auto& y, const auto& k1, const auto& k3, const auto& k4, const auto& k5, const auto& k6) {
+                                  return y + dt * (k1 * (35.0 / 384.0) + k3 * (500.0 / 1113.0) + k4 * (125.0 / 192.0) -
+                                                   k5 * (2187.0 / 6784.0) + k6 * (11.0 / 84.0));
+                                },
+                                y, k1, k3, k4, k5, k6)};
+      k7 = f(t + dt, next);
+      // The difference between the fifth order solution and the embedded fourth order one
+      const State error{mapState([&](const auto& k1, const auto& k3, const auto& k4, const auto& k5, const auto& k6, const auto& k7) {
+                                   return dt * (k1 * (71.0 / 57600.0) - k3 * (71.0 / 16695.0) + k4 * (71.0 / 1920.0) -
+                                                k5 * (17253.0 / 339200.0) + k6 * (22.0 / 525.0) - k7 * (1.0 / 40.0));
+                                 },
+                                 k1, k3, k4, k5, k6, k7)};
+      return EmbeddedStep<State>{next, error};
+    }
+
+    template <typename Container>
+    using SpanOf_t = QuantitySpan<ScalarOf_t<std::decay_t<Container>>, UnitOf_t<std::decay_t<Container>>>;
+
+    template <typename Step, typename... Spans, std::size_t... I>
+    void stepEach(Step& step, const std::tuple<Spans...>& spans, std::index_sequence<I...>) {
+      using Scalar = ScalarOf_t<std::tuple_element_t<0, std::tuple<Spans...>>>;
+      const std::size_t count = std::get<0>(spans).size();
+      assert(((std::get<I>(spans).size() == count) && ...));
+      assert((std::get<I>(spans).isContiguous() && ...));
+
+      std::size_t i = 0;
+      if constexpr (std::is_arithmetic_v<Scalar>) {
+        using Lanes = NativeBatch<Scalar>;
+        constexpr std::size_t Width = Lanes::lanes;
+        for (; i + Width <= count; i += Width) {
+          const auto next = step(std::make_tuple(
+              Quantity<Lanes, UnitOf_t<Spans>>::makeFromBaseUnitValue(Lanes::load(std::get<I>(spans).data() + i))...));
+          (std::get<I>(next).base().store(std::get<I>(spans).data() + i), ...);
+        }
+      }
+      for (; i < count; ++i) {
+        const auto next = step(std::make_tuple(
+            Quantity<Scalar, UnitOf_t<Spans>>::makeFromBaseUnitValue(std::get<I>(spans).data()[i])...));
+        ((std::get<I>(spans).data()[i] = std::get<I>(next).base()), ...);
+      }
+    }
+  }  // namespace detail
+
+  /** Advances y by dt with the classic fourth-order Runge-Kutta method.
+   * \param f The derivative of the state, called as f(t, y), which returns a
+   * DerivativeOf_t<State, TimeQuantity>
+   * \param y A Quantity or std::tuple of Quantities
+   */
+  template <typename Function, typename TimeQuantity, typename State>
+  State rungeKutta4Step(Function&& f, const TimeQuantity& t, const State& y, const TimeQuantity& dt) {
+    using Derivative = DerivativeOf_t<State, TimeQuantity>;
+    const TimeQuantity half = dt * 0.5;
+
+    const Derivative k1 = f(t, y);
+    const Derivative k2 = f(t + half, State{detail::mapState([&](const auto& y, const auto& k) { return y + half * k; }, y, k1)});
+    const Derivative k3 = f(t + half, State{detail::mapState([&](const auto& y, const auto& k) { return y + half * k; }, y, k2)});
+    const Derivative k4 = f(t + dt, State{detail::mapState([&](const auto& y, const auto& k) { return y + dt * k; }, y, k3)});
+    return State{detail::mapState(
+        [&](const auto& y, const auto& k1, const auto& k2, const auto& k3, const auto& k4) {
+          return y + (dt * (1.0 / 6.0)) * (k1 + 2.0 * (k2 + k3) + k4);
+        },
+        y, k1, k2, k3, k4)};
+  }
+
+  /** Advances y by dt with the fifth-order Dormand-Prince method, and estimates the
+   * local error with its embedded fourth-order solution
+   */
+  template <typename Function, typename TimeQuantity, typename State>
+  EmbeddedStep<State> dormandPrinceStep(Function&& f, const TimeQuantity& t, const State& y, const TimeQuantity& dt) {
+    using Derivative = DerivativeOf_t<State, TimeQuantity>;
+    Derivative last{};
+    return detail::dormandPrince(f, t, y, Derivative{f(t, y)}, dt, last);
+  }
+
+  /** Integrates y from t0 to t1 with Dormand-Prince steps, whose sizes are adapted to
+   * keep the local error within tolerance. The derivative at the end of each step is
+   * reused for the next one, so accepted steps cost six evaluations of f. The
+   * integration stops early, without completed, once a step no longer advances the
+   * time, e.g. because the error is not finite, or after maxSteps attempted steps.
+   * \param initialStep The size of the first attempted step
+   */
+  template <typename Function, typename TimeQuantity, typename State>
+  AdaptiveSolution<State, TimeQuantity> integrateAdaptive(Function&& f,
+                                                          TimeQuantity t0,
+                                                          const State& y0,
+                                                          const TimeQuantity& t1,
+                                                          const OdeTolerance<State>& tolerance,
+                                                          TimeQuantity initialStep,
+                                                          std::size_t maxSteps = detail::DefaultOdeSteps) {
+    using Derivative = DerivativeOf_t<State, TimeQuantity>;
+    constexpr double Safety = 0.9;
+    constexpr double MinimumFactor = 0.2;
+    constexpr double MaximumFactor = 5.0;
+    assert(initialStep > TimeQuantity{});
+
+    AdaptiveSolution<State, TimeQuantity> solution{y0, t0, initialStep, 0, 0, true};
+    Derivative k1 = f(t0, y0);
+    Derivative k7{};
+    while (solution.time < t1) {
+      if (solution.accepted + solution.rejected == maxSteps || !(solution.time + solution.step > solution.time)) {
+        solution.completed = false;
+        break;
+      }
+      const bool last = solution.time + solution.step >= t1;
+      const TimeQuantity dt = last ? TimeQuantity{t1 - solution.time} : solution.step;
+      const EmbeddedStep<State> step = detail::dormandPrince(f, solution.time, solution.state, k1, dt, k7);
+      const double error = detail::scaledErrorNorm(step.error, solution.state, step.state, tolerance);
+      const double factor = !std::isfinite(error) ? MinimumFactor
+                            : error == 0.0      ? MaximumFactor
+                                                : std::clamp(Safety * std::pow(error, -0.2), MinimumFactor, MaximumFactor);
+      if (error <= 1.0) {
+        solution.time = last ? t1 : TimeQuantity{solution.time + dt};
+        solution.state = step.state;
+        k1 = k7;
+        ++solution.accepted;
+        if (!last) {
+          solution.step = dt * factor;
+        }
+      } else {
+        ++solution.rejected;
+        solution.step = dt * factor;
+      }
+    }
+    return solution;
+  }
+
+  /** Advances a separable second-order system by dt with the velocity Verlet method,
+   * which is symplectic, so the energy of conservative systems does not drift.
+   * \param acceleration The second derivative of the position, called as
+   * acceleration(t, position)
+   */
+  template <typename Function, typename TimeQuantity, typename Position>
+  void velocityVerletStep(Function&& acceleration,
+                          const TimeQuantity& t,
+                          Position& position,
+                          DerivativeOf_t<Position, TimeQuantity>& velocity,
+                          const TimeQuantity& dt) {
+    using Velocity = DerivativeOf_t<Position, TimeQuantity>;
+    using Acceleration = DerivativeOf_t<Velocity, TimeQuantity>;
+    const TimeQuantity half = dt * 0.5;
+
+    const Acceleration a0 = acceleration(t, position);
+    const Velocity halfway{detail::mapState([&](const auto& v, const auto& a) { return v + half * a; }, velocity, a0)};
+    position = Position{detail::mapState([&](const auto& x, const auto& v) { return x + dt * v; }, position, halfway)};
+    const Acceleration a1 = acceleration(t + dt, position);
+    velocity = Velocity{detail::mapState([&](const auto& v, const auto& a) { return v + half * a; }, halfway, a1)};
+  }
+
+  /** Advances many independent systems stored as structures of arrays, e.g.
+   * std::tie(positions, velocities). Each call of step receives the state of
+   * NativeBatch lanes of systems as a std::tuple of Quantities of Batches (or of one
+   * system at the end of the arrays) and returns the next state, so step should be
+   * generic in the scalar, such as a generic lambda calling rungeKutta4Step.
+   */
+  template <typename Step, typename... Containers>
+  void stepEach(Step&& step, const std::tuple<Containers&...>& states) {
+    const std::tuple<detail::SpanOf_t<Containers>...> spans = std::apply(
+        [](Containers&... containers) { return std::tuple<detail::SpanOf_t<Containers>...>{containers...}; }, states);
+    detail::stepEach(step, spans, std::index_sequence_for<Containers...>{});
+  }
+
+  /** Advances many independent systems stored as structures of arrays by dt with
+   * rungeKutta4Step, a NativeBatch of systems at a time. f must accept the state of
+   * a single system as a tuple of Quantities of any scalar.
+   */
+  template <typename Function, typename TimeQuantity, typename... Containers>
+  void rungeKutta4StepEach(Function&& f,
+                           const TimeQuantity& t,
+                           const std::tuple<Containers&...>& states,
+                           const TimeQuantity& dt) {
+    stepEach([&](const auto& y) { return rungeKutta4Step(f, t, y, dt); }, states);
+  }
+}  // namespace poids
+
+#endif
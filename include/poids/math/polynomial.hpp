@@ -0,0 +1,298 @@
+#ifndef POIDS_MATH_POLYNOMIAL_HPP
+#define POIDS_MATH_POLYNOMIAL_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/core/traits.hpp"
+
+namespace poids {
+  /** Evaluates a polynomial as c0 + x (c1 + x (c2 + ...)), with the fewest
+   * operations but one long chain of dependent multiply-adds
+   */
+  struct HornerScheme {
+    explicit HornerScheme() = default;
+  };
+
+  /** Evaluates a polynomial by pairing coefficients, (c0 + c1 x) + x^2 (c2 + c3 x) and
+   * so on, which has a few more multiplications than Horner's scheme but a chain of
+   * dependent operations only logarithmic in the degree
+   */
+  struct EstrinScheme {
+    explicit EstrinScheme() = default;
+  };
+
+  inline constexpr HornerScheme horner{};
+  inline constexpr EstrinScheme estrin{};
+
+  namespace detail {
+    template <typename T>
+    inline constexpr bool IsPolynomialScheme_v = std::is_same_v<T, HornerScheme> || std::is_same_v<T, EstrinScheme>;
+
+    /** The number of times a polynomial with Count coefficients is halved by Estrin's scheme */
+    constexpr std::size_t estrinLevels(std::size_t count) {
+      std::size_t levels = 0;
+      while ((std::size_t{1} << levels) < count) {
+        ++levels;
+      }
+      return levels;
+    }
+
+    template <typename T, typename Coefficient, std::size_t Count>
+    T hornerBase(const std::array<Coefficient, Count>& c, const T& x) {
+      T result(c[Count - 1]);
+      for (std::size_t k = Count - 1; k-- > 0;) {
+        result = result * x + T(c[k]);
+      }
+      return result;
+    }
+
+    /** Evaluates the Count coefficients from First, where powers[i] is x^(2^i) */
+    template <std::size_t First, std::size_t Count, typename T, typename Coefficient, std::size_t Size, std::size_t Levels>
+    T estrinBase(const std::array<Coefficient, Size>& c, const std::array<T, Levels>& powers) {
+      if constexpr (Count == 1) {
+        return T(c[First]);
+      } else if constexpr (Count == 2) {
+        return T(c[First + 1]) * powers[0] + T(c[First]);
+      } else {
+        constexpr std::size_t level = estrinLevels(Count) - 1;
+        constexpr std::size_t half = std::size_t{1} << level;
+        const T low = estrinBase<First, half>(c, powers);
+        const T high = estrinBase<First + half, Count - half>(c, powers);
+        return high * powers[level] + low;
+      }
+    }
+
+    template <typename T, typename Coefficient, std::size_t Count>
+    T estrinBase(const std::array<Coefficient, Count>& c, const T& x) {
+      constexpr std::size_t levels = estrinLevels(Count) == 0 ? 1 : estrinLevels(Count);
+      std::array<T, levels> powers;
+      powers[0] = x;
+      for (std::size_t i = 1; i < levels; ++i) {
+        powers[i] = powers[i - 1] * powers[i - 1];
+      }
+      return estrinBase<0, Count>(c, powers);
+    }
+
+    template <typename T, typename Coefficient, std::size_t Count>
+    T evaluateBase(HornerScheme, const std::array<Coefficient, Count>& c, const T& x) {
+      return hornerBase(c, x);
+    }
+
+    template <typename T, typename Coefficient, std::size_t Count>
+    T evaluateBase(EstrinScheme, const std::array<Coefficient, Count>& c, const T& x) {
+      return estrinBase(c, x);
+    }
+  }  // namespace detail
+
+  /** A polynomial c0 + c1 x + ... + cDegree x^Degree from ArgumentQuantity to
+   * ResultQuantity, such as a specific heat capacity fitted against temperature.
+   *
+   * The unit of each coefficient follows from the units of the argument and result:
+   * ck has the unit of ResultQuantity / ArgumentQuantity^k, and coefficients of any
+   * other unit are rejected at compile time. Coefficients are stored in base units,
+   * so evaluation is plain arithmetic on the Scalar of the argument, which may be
+   * e.g. a Batch or a Dual. It is written as multiply-adds, which the compiler
+   * contracts to fused multiply-adds on targets that have them.
+   *
+   * \tparam ResultQuantity The quantity type of the value of the polynomial
+   * \tparam ArgumentQuantity The quantity type of its argument
+   * \tparam Degree The degree of the polynomial
+   */
+  template <typename ResultQuantity, typename ArgumentQuantity, std::size_t Degree>
+  class Polynomial {
+    static_assert(IsQuantity_v<ResultQuantity>, "The result of a polynomial must be a poids::Quantity");
+    static_assert(IsQuantity_v<ArgumentQuantity>, "The argument of a polynomial must be a poids::Quantity");
+
+   public:
+    using Scalar = ScalarOf_t<ResultQuantity>;
+    using ResultUnit = UnitOf_t<ResultQuantity>;
+    using ArgumentUnit = UnitOf_t<ArgumentQuantity>;
+    using Result = Quantity<Scalar, ResultUnit>;
+    using Argument = Quantity<ScalarOf_t<ArgumentQuantity>, ArgumentUnit>;
+
+    /** The unit of coefficient K, ResultUnit / ArgumentUnit^K */
+    template <std::size_t K>
+    using CoefficientUnit = typename ResultUnit::template divide_t<typename ArgumentUnit::template power_t<int{K}, 1>>;
+
+    /** The quantity type of coefficient K */
+    template <std::size_t K>
+    using Coefficient = Quantity<Scalar, CoefficientUnit<K>>;
+
+    /** The degree of the polynomial */
+    static constexpr std::size_t degree = Degree;
+
+    /** Constructs a polynomial from its Degree + 1 coefficients, from the constant
+     * term upward
+     */
+    template <typename... Coefficients,
+              typename = std::enable_if_t<sizeof...(Coefficients) == Degree + 1 && (IsQuantity_v<Coefficients> && ...)>>
+    Polynomial(const Coefficients&... coefficients) :
+        coefficients_{Scalar(coefficients.base())...} {
+      checkCoefficients<Coefficients...>(std::make_index_sequence<Degree + 1>{});
+    }
+
+    /** Coefficient K */
+    template <std::size_t K>
+    Coefficient<K> coefficient() const {
+      static_assert(K <= Degree, "The polynomial has no coefficient K");
+      return Coefficient<K>::makeFromBaseUnitValue(coefficients_[K]);
+    }
+
+    /** The coefficients in base units, from the constant term upward */
+    const std::array<Scalar, Degree + 1>& baseCoefficients() const { return coefficients_; }
+
+    /** Evaluates the polynomial at x with Horner's scheme */
+    template <typename ArgumentType>
+    auto operator()(const ArgumentType& x) const {
+      return evaluate(horner, x);
+    }
+
+    /** Evaluates the polynomial at x with the given scheme. The result has the
+     * Scalar of x.
+     */
+    template <typename Scheme, typename ArgumentType>
+    auto evaluate(Scheme, const ArgumentType& x) const {
+      static_assert(std::is_same_v<UnitOf_t<ArgumentType>, ArgumentUnit>,
+                    "The argument must have the unit of the polynomial's argument");
+      using T = ScalarOf_t<ArgumentType>;
+      return Quantity<T, ResultUnit>::makeFromBaseUnitValue(
+          detail::evaluateBase(Scheme{}, coefficients_, Quantity<T, ArgumentUnit>{x}.base()));
+    }
+
+    /** Evaluates the polynomial at every element of arguments, writing to result.
+     * The units are checked once for the whole arrays, and the loop works on base
+     * unit values, so it is vectorized across elements.
+     */
+    template <typename ResultArray, typename ArgumentArray,
+              typename = std::enable_if_t<!detail::IsPolynomialScheme_v<std::decay_t<ResultArray>>>>
+    void evaluateEach(ResultArray&& result, const ArgumentArray& arguments) const {
+      evaluateEach(horner, std::forward<ResultArray>(result), arguments);
+    }
+
+    template <typename Scheme, typename ResultArray, typename ArgumentArray,
+              typename = std::enable_if_t<detail::IsPolynomialScheme_v<Scheme>>>
+    void evaluateEach(Scheme, ResultArray&& result, const ArgumentArray& arguments) const {
+      static_assert(std::is_same_v<UnitOf_t<std::decay_t<ResultArray>>, ResultUnit>,
+                    "The result must have the unit of the polynomial's result");
+      static_assert(std::is_same_v<UnitOf_t<ArgumentArray>, ArgumentUnit>,
+                    "The arguments must have the unit of the polynomial's argument");
+      const QuantitySpan<Scalar, ResultUnit> out{result};
+      const QuantitySpan<const Scalar, ArgumentUnit> in{arguments};
+      assert(out.isContiguous() && in.isContiguous());
+      assert(out.size() == in.size());
+
+      const std::size_t count = out.size();
+      const Scalar* x = in.data();
+      Scalar* data = out.data();
+      for (std::size_t i = 0; i < count; ++i) {
+        data[i] = detail::evaluateBase(Scheme{}, coefficients_, x[i]);
+      }
+    }
+
+   private:
+    std::array<Scalar, Degree + 1> coefficients_;
+
+    template <typename... Coefficients, std::size_t... K>
+    static constexpr void checkCoefficients(std::index_sequence<K...>) {
+      static_assert((std::is_same_v<UnitOf_t<Coefficients>, CoefficientUnit<K>> && ...),
+                    "Coefficient k must have the unit of the result divided by the argument to the power k");
+    }
+  };
+
+  /** Deduces the argument from the units of the first two coefficients, e.g.
+   * Polynomial{1000.0 * joule / (kilogram * kelvin), 0.5 * joule / (kilogram * kelvin * kelvin)}
+   * is a specific heat capacity against temperature
+   */
+  template <typename C0, typename C1, typename... Rest>
+  Polynomial(const C0&, const C1&, const Rest&...)
+      -> Polynomial<Quantity<ScalarOf_t<C0>, UnitOf_t<C0>>,
+                    Quantity<ScalarOf_t<C0>, typename UnitOf_t<C0>::template divide_t<UnitOf_t<C1>>>,
+                    sizeof...(Rest) + 1>;
+
+  /** A rational function P(x) / Q(x), such as a Padé approximant or a property
+   * correlation, from ArgumentQuantity to ResultQuantity. The numerator P has the
+   * unit of the result and the denominator Q is dimensionless, so each is a
+   * Polynomial whose coefficients are checked as such.
+   *
+   * \tparam ResultQuantity The quantity type of the value of the function
+   * \tparam ArgumentQuantity The quantity type of its argument
+   * \tparam NumeratorDegree The degree of P
+   * \tparam DenominatorDegree The degree of Q
+   */
+  template <typename ResultQuantity, typename ArgumentQuantity, std::size_t NumeratorDegree, std::size_t DenominatorDegree>
+  class RationalFunction {
+   public:
+    using Numerator = Polynomial<ResultQuantity, ArgumentQuantity, NumeratorDegree>;
+    using Denominator =
+        Polynomial<Quantity<ScalarOf_t<ResultQuantity>, typename UnitOf_t<ArgumentQuantity>::template power_t<0, 1>>,
+                   ArgumentQuantity, DenominatorDegree>;
+    using Scalar = typename Numerator::Scalar;
+    using ResultUnit = typename Numerator::ResultUnit;
+    using ArgumentUnit = typename Numerator::ArgumentUnit;
+
+    RationalFunction(const Numerator& numerator, const Denominator& denominator) :
+        numerator_(numerator),
+        denominator_(denominator) { }
+
+    const Numerator& numerator() const { return numerator_; }
+    const Denominator& denominator() const { return denominator_; }
+
+    /** Evaluates the function at x with Horner's scheme */
+    template <typename ArgumentType>
+    auto operator()(const ArgumentType& x) const {
+      return evaluate(horner, x);
+    }
+
+    /** Evaluates the function at x with the given scheme */
+    template <typename Scheme, typename ArgumentType>
+    auto evaluate(Scheme, const ArgumentType& x) const {
+      return numerator_.evaluate(Scheme{}, x) / denominator_.evaluate(Scheme{}, x);
+    }
+
+    /** Evaluates the function at every element of arguments, writing to result */
+    template <typename ResultArray, typename ArgumentArray,
+              typename = std::enable_if_t<!detail::IsPolynomialScheme_v<std::decay_t<ResultArray>>>>
+    void evaluateEach(ResultArray&& result, const ArgumentArray& arguments) const {
+      evaluateEach(horner, std::forward<ResultArray>(result), arguments);
+    }
+
+    template <typename Scheme, typename ResultArray, typename ArgumentArray,
+              typename = std::enable_if_t<detail::IsPolynomialScheme_v<Scheme>>>
+    void evaluateEach(Scheme, ResultArray&& result, const ArgumentArray& arguments) const {
+      static_assert(std::is_same_v<UnitOf_t<std::decay_t<ResultArray>>, ResultUnit>,
+                    "The result must have the unit of the function's result");
+      static_assert(std::is_same_v<UnitOf_t<ArgumentArray>, ArgumentUnit>,
+                    "The arguments must have the unit of the function's argument");
+      const QuantitySpan<Scalar, ResultUnit> out{result};
+      const QuantitySpan<const Scalar, ArgumentUnit> in{arguments};
+      assert(out.isContiguous() && in.isContiguous());
+      assert(out.size() == in.size());
+
+      const std::size_t count = out.size();
+      const Scalar* x = in.data();
+      Scalar* data = out.data();
+      for (std::size_t i = 0; i < count; ++i) {
+        data[i] = detail::evaluateBase(Scheme{}, numerator_.baseCoefficients(), x[i]) /
+                  detail::evaluateBase(Scheme{}, denominator_.baseCoefficients(), x[i]);
+      }
+    }
+
+   private:
+    Numerator numerator_;
+    Denominator denominator_;
+  };
+
+  template <typename ResultQuantity, typename ArgumentQuantity, std::size_t NumeratorDegree,
+            typename DenominatorResult, std::size_t DenominatorDegree>
+  RationalFunction(const Polynomial<ResultQuantity, ArgumentQuantity, NumeratorDegree>&,
+                   const Polynomial<DenominatorResult, ArgumentQuantity, DenominatorDegree>&)
+      -> RationalFunction<ResultQuantity, ArgumentQuantity, NumeratorDegree, DenominatorDegree>;
+}  // namespace poids
+
+#endif
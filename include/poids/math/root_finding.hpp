@@ -0,0 +1,537 @@
+#ifndef POIDS_MATH_ROOT_FINDING_HPP
+#define POIDS_MATH_ROOT_FINDING_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/core/traits.hpp"
+#include "poids/scalar_support/batch.hpp"
+#include "poids/scalar_support/dual.hpp"
+
+namespace poids {
+  /** The tolerances of a root finder: it stops once the root is known to within
+   * argument, or once the magnitude of the function is at most residual, which has
+   * the unit of the function's result
+   */
+  template <typename ArgumentQuantity, typename ResidualQuantity>
+  struct RootTolerance {
+    ArgumentQuantity argument;
+    ResidualQuantity residual;
+  };
+
+  template <typename ArgumentQuantity, typename ResidualQuantity>
+  RootTolerance(ArgumentQuantity, ResidualQuantity) -> RootTolerance<ArgumentQuantity, ResidualQuantity>;
+
+  /** The outcome of a root finder */
+  template <typename ArgumentQuantity>
+  struct RootResult {
+    ArgumentQuantity root;
+    std::size_t iterations;
+    bool converged;
+  };
+
+  /** The outcome of a minimizer */
+  template <typename ArgumentQuantity, typename ValueQuantity>
+  struct MinimumResult {
+    ArgumentQuantity argument;
+    ValueQuantity value;
+    std::size_t iterations;
+    bool converged;
+  };
+
+  /** Requests that newton compute derivatives with dual numbers, which requires the
+   * function to be generic in the scalar of its argument
+   */
+  struct AutomaticDerivative {
+    explicit AutomaticDerivative() = default;
+  };
+
+  inline constexpr AutomaticDerivative automaticDerivative{};
+
+  namespace detail {
+    inline constexpr std::size_t DefaultRootIterations = 100;
+
+    template <typename T>
+    struct IsRootTolerance : public std::false_type { };
+
+    template <typename ArgumentQuantity, typename ResidualQuantity>
+    struct IsRootTolerance<RootTolerance<ArgumentQuantity, ResidualQuantity>> : public std::true_type { };
+
+    /** Checks the units of a tolerance and returns its argument and residual parts in
+     * base units, with a residual of zero if only an argument tolerance was given
+     */
+    template <typename ArgumentQuantity, typename ResultQuantity, typename Tolerance>
+    std::pair<ScalarOf_t<ArgumentQuantity>, ScalarOf_t<ResultQuantity>> baseTolerances(const Tolerance& tolerance) {
+      static_assert(IsQuantity_v<ResultQuantity>, "The function must return a poids::Quantity");
+      if constexpr (IsRootTolerance<Tolerance>::value) {
+        static_assert(std::is_same_v<UnitOf_t<decltype(tolerance.argument)>, UnitOf_t<ArgumentQuantity>>,
+                      "The argument tolerance must have the unit of the argument");
+        static_assert(std::is_same_v<UnitOf_t<decltype(tolerance.residual)>, UnitOf_t<ResultQuantity>>,
+                      "The residual tolerance must have the unit of the function's result");
+        return {tolerance.argument.base(), tolerance.residual.base()};
+      } else {
+        static_assert(std::is_same_v<UnitOf_t<Tolerance>, UnitOf_t<ArgumentQuantity>>,
+                      "The tolerance must have the unit of the argument");
+        return {tolerance.base(), ScalarOf_t<ResultQuantity>{}};
+      }
+    }
+
+    template <typename Function, typename ArgumentQuantity>
+    using ResultOf_t = std::decay_t<std::invoke_result_t<Function&, const ArgumentQuantity&>>;
+
+    // The solvers are written once for plain scalars and for Batches, whose lanes are
+    // independent problems. These helpers give comparisons the same form for both.
+
+    inline bool allLanes(bool mask) { return mask; }
+
+    template <typename T, std::size_t N>
+    bool allLanes(const BatchMask<T, N>& mask) { return mask.all(); }
+
+    inline bool andLanes(bool a, bool b) { return a && b; }
+    inline bool orLanes(bool a, bool b) { return a || b; }
+    inline bool notLanes(bool a) { return !a; }
+
+    template <typename T, std::size_t N>
+    BatchMask<T, N> andLanes(const BatchMask<T, N>& a, const BatchMask<T, N>& b) { return a & b; }
+
+    template <typename T, std::size_t N>
+    BatchMask<T, N> orLanes(const BatchMask<T, N>& a, const BatchMask<T, N>& b) { return a | b; }
+
+    template <typename T, std::size_t N>
+    BatchMask<T, N> notLanes(const BatchMask<T, N>& a) { return !a; }
+
+    template <typename ScalarType>
+    ScalarType selectLanes(bool mask, const ScalarType& a, const ScalarType& b) { return mask ? a : b; }
+
+    template <typename T, std::size_t N>
+    Batch<T, N> selectLanes(const BatchMask<T, N>& mask, const Batch<T, N>& a, const Batch<T, N>& b) {
+      return select(mask, a, b);
+    }
+
+    /** Bisects [lower, upper] of every lane, freezing lanes as they converge */
+    template <typename ScalarType, typename Evaluate>
+    std::pair<ScalarType, std::size_t> bisectLanes(Evaluate evaluate,
+                                                   ScalarType lower,
+                                                   ScalarType upper,
+                                                   const ScalarType& tolerance,
+                                                   const ScalarType& residual,
+                                                   std::size_t maxIterations,
+                                                   bool& converged) {
+      using std::abs;
+      const ScalarType half{0.5};
+      ScalarType lowerValue = evaluate(lower);
+      assert(allLanes(lowerValue * evaluate(upper) <= ScalarType{}));
+
+      ScalarType middle = (lower + upper) * half;
+      for (std::size_t i = 1; i <= maxIterations; ++i) {
+        const ScalarType middleValue = evaluate(middle);
+        const auto done = orLanes((upper - lower) * half <= tolerance, abs(middleValue) <= residual);
+        if (allLanes(done)) {
+          converged = true;
+          return {middle, i};
+        }
+        const auto sameSign = middleValue * lowerValue > ScalarType{};
+        const auto raise = andLanes(notLanes(done), sameSign);
+        const auto lowerUpper = andLanes(notLanes(done), notLanes(sameSign));
+        lower = selectLanes(raise, middle, lower);
+        lowerValue = selectLanes(raise, middleValue, lowerValue);
+        upper = selectLanes(lowerUpper, middle, upper);
+        middle = (lower + upper) * half;
+      }
+      converged = false;
+      return {middle, maxIterations};
+    }
+
+    /** Newton iterations of every lane, freezing lanes as they converge */
+    template <typename ScalarType, typename Evaluate>
+    std::pair<ScalarType, std::size_t> newtonLanes(Evaluate evaluate,
+                                                   ScalarType x,
+                                                   const ScalarType& tolerance,
+                                                   const ScalarType& residual,
+                                                   std::size_t maxIterations,
+                                                   bool& converged) {
+      using std::abs;
+      // Every lane starts active, except those guessing NaN
+      auto active = x == x;
+      for (std::size_t i = 1; i <= maxIterations; ++i) {
+        const auto [value, slope] = evaluate(x);
+        const ScalarType step = value / slope;
+        x = selectLanes(active, ScalarType{x - step}, x);
+        active = andLanes(active, notLanes(orLanes(abs(step) <= tolerance, abs(value) <= residual)));
+        if (allLanes(notLanes(active))) {
+          converged = true;
+          return {x, i};
+        }
+      }
+      converged = false;
+      return {x, maxIterations};
+    }
+
+    template <typename Container>
+    using RootSpanOf_t = QuantitySpan<ScalarOf_t<std::decay_t<Container>>, UnitOf_t<std::decay_t<Container>>>;
+
+    template <typename Container>
+    using ConstRootSpanOf_t = QuantitySpan<const ScalarOf_t<std::decay_t<Container>>, UnitOf_t<std::decay_t<Container>>>;
+
+    /** Runs solve on a NativeBatch of problems at a time, then one at a time at the
+     * end of the arrays. solve receives a flag to set on convergence and the inputs of
+     * the problems as Quantities, and returns the roots. Returns whether every
+     * problem converged.
+     */
+    template <typename Solve, typename RootSpan, typename... Spans>
+    bool solveEach(Solve solve, const RootSpan& roots, const Spans&... inputs) {
+      using Scalar = ScalarOf_t<RootSpan>;
+      using Lanes = NativeBatch<Scalar>;
+      constexpr std::size_t Width = Lanes::lanes;
+      const std::size_t count = roots.size();
+      assert(((inputs.size() == count) && ...));
+      assert(roots.isContiguous() && (inputs.isContiguous() && ...));
+
+      bool converged = true;
+      std::size_t i = 0;
+      for (; i + Width <= count; i += Width) {
+        bool lanesConverged = false;
+        solve(lanesConverged, Quantity<Lanes, UnitOf_t<Spans>>::makeFromBaseUnitValue(Lanes::load(inputs.data() + i))...)
+            .store(roots.data() + i);
+        converged = converged && lanesConverged;
+      }
+      for (; i < count; ++i) {
+        bool elementConverged = false;
+        roots.data()[i] = solve(elementConverged, Quantity<Scalar, UnitOf_t<Spans>>::makeFromBaseUnitValue(inputs.data()[i])...);
+        converged = converged && elementConverged;
+      }
+      return converged;
+    }
+  }  // namespace detail
+
+  /** Finds a root of f in [lower, upper] by bisection, where f(lower) and f(upper)
+   * must not have the same sign. It converges for every continuous f, gaining one
+   * bit per evaluation.
+   * \param tolerance A quantity with the unit of the argument, or a RootTolerance
+   */
+  template <typename Function, typename ArgumentQuantity, typename Tolerance>
+  RootResult<ArgumentQuantity> bisect(Function&& f,
+                                      const ArgumentQuantity& lower,
+                                      const ArgumentQuantity& upper,
+                                      const Tolerance& tolerance,
+                                      std::size_t maxIterations = detail::DefaultRootIterations) {
+    using Result = detail::ResultOf_t<Function, ArgumentQuantity>;
+    using Scalar = ScalarOf_t<ArgumentQuantity>;
+    const auto [argument, residual] = detail::baseTolerances<ArgumentQuantity, Result>(tolerance);
+    const auto evaluate = [&](Scalar x) { return f(ArgumentQuantity::makeFromBaseUnitValue(x)).base(); };
+
+    bool converged = false;
+    const auto [root, iterations] = detail::bisectLanes<Scalar>(evaluate, lower.base(), upper.base(), argument,
+                                                                residual, maxIterations, converged);
+    return RootResult<ArgumentQuantity>{ArgumentQuantity::makeFromBaseUnitValue(root), iterations, converged};
+  }
+
+  /** Finds a root of f in [lower, upper] with Brent's method, where f(lower) and
+   * f(upper) must not have the same sign. It interpolates where that makes progress
+   * and bisects otherwise, so it converges superlinearly for smooth f and never
+   * more slowly than bisection.
+   * \param tolerance A quantity with the unit of the argument, or a RootTolerance
+   */
+  template <typename Function, typename ArgumentQuantity, typename Tolerance>
+  RootResult<ArgumentQuantity> brent(Function&& f,
+                                     const ArgumentQuantity& lower,
+                                     const ArgumentQuantity& upper,
+                                     const Tolerance& tolerance,
+                                     std::size_t maxIterations = detail::DefaultRootIterations) {
+    using Result = detail::ResultOf_t<Function, ArgumentQuantity>;
+    using Scalar = ScalarOf_t<ArgumentQuantity>;
+    static_assert(std::is_floating_point_v<Scalar>, "brent requires a floating-point scalar");
+    using std::abs;
+    const auto [argument, residual] = detail::baseTolerances<ArgumentQuantity, Result>(tolerance);
+    const auto evaluate = [&](Scalar x) { return f(ArgumentQuantity::makeFromBaseUnitValue(x)).base(); };
+    const Scalar epsilon = std::numeric_limits<Scalar>::epsilon();
+
+    Scalar a = lower.base();
+    Scalar b = upper.base();
+    Scalar fa = evaluate(a);
+    Scalar fb = evaluate(b);
+    assert(fa * fb <= Scalar{});
+    Scalar c = a;
+    Scalar fc = fa;
+    Scalar d = b - a;
+    Scalar e = d;
+
+    for (std::size_t i = 1; i <= maxIterations; ++i) {
+      if ((fb > Scalar{} && fc > Scalar{}) || (fb < Scalar{} && fc < Scalar{})) {
+        c = a;
+        fc = fa;
+        d = b - a;
+        e = d;
+      }
+      if (abs(fc) < abs(fb)) {
+        a = b;
+        b = c;
+        c = a;
+        fa = fb;
+        fb = fc;
+        fc = fa;
+      }
+      const Scalar step = Scalar{2} * epsilon * abs(b) + Scalar{0.5} * argument;
+      const Scalar middle = Scalar{0.5} * (c - b);
+      if (abs(middle) <= step || abs(fb) <= residual) {
+        return RootResult<ArgumentQuantity>{ArgumentQuantity::makeFromBaseUnitValue(b), i, true};
+      }
+
+      if (abs(e) >= step && abs(fa) > abs(fb)) {
+        // Inverse quadratic interpolation, or the secant method with two points
+        const Scalar s = fb / fa;
+        Scalar p;
+        Scalar q;
+        if (a == c) {
+          p = Scalar{2} * middle * s;
+          q = Scalar{1} - s;
+        } else {
+          const Scalar qa = fa / fc;
+          const Scalar r = fb / fc;
+          p = s * (Scalar{2} * middle * qa * (qa - r) - (b - a) * (r - Scalar{1}));
+          q = (qa - Scalar{1}) * (r - Scalar{1}) * (s - Scalar{1});
+        }
+        if (p > Scalar{}) {
+          q = -q;
+        }
+        p = abs(p);
+        if (Scalar{2} * p < std::min(Scalar{3} * middle * q - abs(step * q), abs(e * q))) {
+          e = d;
+          d = p / q;
+        } else {
+          d = middle;
+          e = d;
+        }
+      } else {
+        d = middle;
+        e = d;
+      }
+
+      a = b;
+      fa = fb;
+      b += abs(d) > step ? d : std::copysign(step, middle);
+      fb = evaluate(b);
+    }
+    return RootResult<ArgumentQuantity>{ArgumentQuantity::makeFromBaseUnitValue(b), maxIterations, false};
+  }
+
+  /** Finds a root of f from guess with Newton's method, which converges
+   * quadratically near a simple root but may diverge from a poor guess.
+   * \param derivative The derivative of f, whose unit must be the unit of the result
+   * divided by the unit of the argument, or automaticDerivative
+   * \param tolerance A quantity with the unit of the argument, or a RootTolerance
+   */
+  template <typename Function, typename Derivative, typename ArgumentQuantity, typename Tolerance>
+  RootResult<ArgumentQuantity> newton(Function&& f,
+                                      Derivative&& derivative,
+                                      const ArgumentQuantity& guess,
+                                      const Tolerance& tolerance,
+                                      std::size_t maxIterations = detail::DefaultRootIterations) {
+    using Result = detail::ResultOf_t<Function, ArgumentQuantity>;
+    using Scalar = ScalarOf_t<ArgumentQuantity>;
+    using Slope = typename UnitOf_t<Result>::template divide_t<UnitOf_t<ArgumentQuantity>>;
+    const auto [argument, residual] = detail::baseTolerances<ArgumentQuantity, Result>(tolerance);
+
+    bool converged = false;
+    std::pair<Scalar, std::size_t> solution;
+    if constexpr (std::is_same_v<std::decay_t<Derivative>, AutomaticDerivative>) {
+      const auto evaluate = [&](Scalar x) {
+        const auto y = f(makeVariable<1>(ArgumentQuantity::makeFromBaseUnitValue(x), 0));
+        static_assert(std::is_same_v<UnitOf_t<std::decay_t<decltype(y)>>, UnitOf_t<Result>>,
+                      "f must return the same unit for every scalar");
+        return std::make_pair(y.base().value(), y.base().derivative(0));
+      };
+      solution = detail::newtonLanes<Scalar>(evaluate, guess.base(), argument, residual, maxIterations, converged);
+    } else {
+      using DerivativeResult = detail::ResultOf_t<Derivative, ArgumentQuantity>;
+      static_assert(std::is_same_v<UnitOf_t<DerivativeResult>, Slope>,
+                    "The unit of the derivative must be the unit of the result divided by the unit of the argument");
+      const auto evaluate = [&](Scalar x) {
+        const ArgumentQuantity at = ArgumentQuantity::makeFromBaseUnitValue(x);
+        return std::make_pair(Scalar{f(at).base()}, Scalar{derivative(at).base()});
+      };
+      solution = detail::newtonLanes<Scalar>(evaluate, guess.base(), argument, residual, maxIterations, converged);
+    }
+    return RootResult<ArgumentQuantity>{ArgumentQuantity::makeFromBaseUnitValue(solution.first), solution.second, converged};
+  }
+
+  /** Finds a minimum of f in [lower, upper] with Brent's method, combining golden
+   * section search with parabolic interpolation. For a unimodal f it finds the
+   * minimum to within tolerance, which has the unit of the argument.
+   */
+  template <typename Function, typename ArgumentQuantity>
+  MinimumResult<ArgumentQuantity, detail::ResultOf_t<Function, ArgumentQuantity>> minimize(
+      Function&& f,
+      const ArgumentQuantity& lower,
+      const ArgumentQuantity& upper,
+      const ArgumentQuantity& tolerance,
+      std::size_t maxIterations = detail::DefaultRootIterations) {
+    using Value = detail::ResultOf_t<Function, ArgumentQuantity>;
+    using Scalar = ScalarOf_t<ArgumentQuantity>;
+    static_assert(std::is_floating_point_v<Scalar>, "minimize requires a floating-point scalar");
+    static_assert(IsQuantity_v<Value>, "The function must return a poids::Quantity");
+    using std::abs;
+    const auto evaluate = [&](Scalar x) { return f(ArgumentQuantity::makeFromBaseUnitValue(x)).base(); };
+    const Scalar golden = Scalar{0.5} * (Scalar{3} - std::sqrt(Scalar{5}));
+    const Scalar epsilon = std::sqrt(std::numeric_limits<Scalar>::epsilon());
+
+    Scalar a = lower.base();
+    Scalar b = upper.base();
+    Scalar x = a + golden * (b - a);
+    Scalar w = x;
+    Scalar v = x;
+    Scalar fx = evaluate(x);
+    Scalar fw = fx;
+    Scalar fv = fx;
+    Scalar d{};
+    Scalar e{};
+
+    const auto result = [&](std::size_t iterations, bool converged) {
+      return MinimumResult<ArgumentQuantity, Value>{ArgumentQuantity::makeFromBaseUnitValue(x),
+                                                    Value::makeFromBaseUnitValue(fx), iterations, converged};
+    };
+
+    for (std::size_t i = 1; i <= maxIterations; ++i) {
+      const Scalar middle = Scalar{0.5} * (a + b);
+      const Scalar step = epsilon * abs(x) + tolerance.base() / Scalar{3};
+      const Scalar twiceStep = Scalar{2} * step;
+      if (abs(x - middle) <= twiceStep - Scalar{0.5} * (b - a)) {
+        return result(i, true);
+      }
+
+      Scalar p{};
+      Scalar q{};
+      Scalar r{};
+      if (abs(e) > step) {
+        // Fit a parabola through x, w and v
+        r = (x - w) * (fx - fv);
+        q = (x - v) * (fx - fw);
+        p = (x - v) * q - (x - w) * r;
+        q = Scalar{2} * (q - r);
+        if (q > Scalar{}) {
+          p = -p;
+        } else {
+          q = -q;
+        }
+        r = e;
+        e = d;
+      }
+      if (abs(p) < abs(Scalar{0.5} * q * r) && p > q * (a - x) && p < q * (b - x)) {
+        d = p / q;
+        const Scalar u = x + d;
+        if (u - a < twiceStep || b - u < twiceStep) {
+          d = x < middle ? step : -step;
+        }
+      } else {
+        e = (x < middle ? b : a) - x;
+        d = golden * e;
+      }
+
+      const Scalar u = x + (abs(d) >= step ? d : std::copysign(step, d));
+      const Scalar fu = evaluate(u);
+      if (fu <= fx) {
+        (u < x ? b : a) = x;
+        v = w;
+        fv = fw;
+        w = x;
+        fw = fx;
+        x = u;
+        fx = fu;
+      } else {
+        (u < x ? a : b) = u;
+        if (fu <= fw || w == x) {
+          v = w;
+          fv = fw;
+          w = u;
+          fw = fu;
+        } else if (fu <= fv || v == x || v == w) {
+          v = u;
+          fv = fu;
+        }
+      }
+    }
+    return result(maxIterations, false);
+  }
+
+  /** Bisects many independent problems stored as arrays, writing each root to
+   * roots. The problems may differ in parameters, arrays which are passed to f
+   * after the argument, as in f(depth, targetPressure). A NativeBatch of problems
+   * is solved at a time, so f must be generic in the scalar of its arguments.
+   * Returns whether every problem converged.
+   * \param tolerance A quantity with the unit of the argument, or a RootTolerance,
+   * shared by every problem
+   */
+  template <typename Function, typename Bounds, typename Tolerance, typename Roots, typename... Parameters>
+  bool bisectEach(Function&& f,
+                  const Bounds& lower,
+                  const Bounds& upper,
+                  const Tolerance& tolerance,
+                  Roots&& roots,
+                  const Parameters&... parameters) {
+    using Unit = UnitOf_t<std::decay_t<Bounds>>;
+    using Argument = Quantity<ScalarOf_t<std::decay_t<Bounds>>, Unit>;
+    using Result = std::decay_t<std::invoke_result_t<Function&, const Argument&,
+                                                     const Quantity<ScalarOf_t<Parameters>, UnitOf_t<Parameters>>&...>>;
+    const auto tolerances = detail::baseTolerances<Argument, Result>(tolerance);
+
+    return detail::solveEach(
+        [&](bool& converged, const auto& lowerLanes, const auto& upperLanes, const auto&... parameterLanes) {
+          using Lanes = ScalarOf_t<std::decay_t<decltype(lowerLanes)>>;
+          const auto evaluate = [&](const Lanes& x) {
+            return f(Quantity<Lanes, Unit>::makeFromBaseUnitValue(x), parameterLanes...).base();
+          };
+          return detail::bisectLanes<Lanes>(evaluate, lowerLanes.base(), upperLanes.base(), Lanes{tolerances.first},
+                                            Lanes{tolerances.second}, detail::DefaultRootIterations, converged)
+              .first;
+        },
+        detail::RootSpanOf_t<Roots>{roots}, detail::ConstRootSpanOf_t<Bounds>{lower},
+        detail::ConstRootSpanOf_t<Bounds>{upper}, detail::ConstRootSpanOf_t<Parameters>{parameters}...);
+  }
+
+  /** Applies Newton's method to many independent problems stored as arrays, from
+   * guesses, writing each root to roots. Parameters are passed to f and derivative
+   * after the argument, as with bisectEach, and both must be generic in the scalar
+   * of their arguments. Returns whether every problem converged.
+   */
+  template <typename Function, typename Derivative, typename Guesses, typename Tolerance, typename Roots, typename... Parameters>
+  bool newtonEach(Function&& f,
+                  Derivative&& derivative,
+                  const Guesses& guesses,
+                  const Tolerance& tolerance,
+                  Roots&& roots,
+                  const Parameters&... parameters) {
+    using Unit = UnitOf_t<std::decay_t<Guesses>>;
+    using Argument = Quantity<ScalarOf_t<std::decay_t<Guesses>>, Unit>;
+    using Result = std::decay_t<std::invoke_result_t<Function&, const Argument&,
+                                                     const Quantity<ScalarOf_t<Parameters>, UnitOf_t<Parameters>>&...>>;
+    using DerivativeResult = std::decay_t<std::invoke_result_t<Derivative&, const Argument&,
+                                                               const Quantity<ScalarOf_t<Parameters>, UnitOf_t<Parameters>>&...>>;
+    static_assert(std::is_same_v<UnitOf_t<DerivativeResult>, typename UnitOf_t<Result>::template divide_t<Unit>>,
+                  "The unit of the derivative must be the unit of the result divided by the unit of the argument");
+    const auto tolerances = detail::baseTolerances<Argument, Result>(tolerance);
+
+    return detail::solveEach(
+        [&](bool& converged, const auto& guessLanes, const auto&... parameterLanes) {
+          using Lanes = ScalarOf_t<std::decay_t<decltype(guessLanes)>>;
+          const auto evaluate = [&](const Lanes& x) {
+            const auto at = Quantity<Lanes, Unit>::makeFromBaseUnitValue(x);
+            return std::make_pair(Lanes{f(at, parameterLanes...).base()}, Lanes{derivative(at, parameterLanes...).base()});
+          };
+          return detail::newtonLanes<Lanes>(evaluate, guessLanes.base(), Lanes{tolerances.first}, Lanes{tolerances.second},
+                                            detail::DefaultRootIterations, converged)
+              .first;
+        },
+        detail::RootSpanOf_t<Roots>{roots}, detail::ConstRootSpanOf_t<Guesses>{guesses},
+        detail::ConstRootSpanOf_t<Parameters>{parameters}...);
+  }
+}  // namespace poids
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef POIDS_MATH_TRANSCENDENTAL_HPP
+#define POIDS_MATH_TRANSCENDENTAL_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "poids/core/array_expression.hpp"
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/traits.hpp"
+#include "poids/core/uninitialized.hpp"
+#include "poids/scalar_support/batch_expression.hpp"
+#include "poids/scalar_support/batch_math.hpp"
+
+namespace poids {
+  namespace detail {
+    template <typename UnitType>
+    constexpr void requireUnitless() {
+      static_assert(IsUnitless<UnitType>::value,
+                    "Transcendental functions are only defined for unitless poids::Quantity "
+                    "values such as si::Angle. Divide by a reference quantity first.");
+    }
+
+    template <typename ScalarType>
+    std::pair<ScalarType, ScalarType> sinCosOf(const ScalarType& x) {
+      using std::cos;
+      using std::sin;
+      return {sin(x), cos(x)};
+    }
+
+    template <typename T, std::size_t N>
+    std::pair<Batch<T, N>, Batch<T, N>> sinCosOf(const Batch<T, N>& x) {
+      return sincos(x);
+    }
+
+    /** Evaluates f over every element of a unitless range, a NativeBatch at a time where possible */
+    template <typename Range, typename F>
+    auto transformUnitless(const Range& range, F f) {
+      using Unit = typename ArrayOperandOf<Range>::Unit;
+      requireUnitless<Unit>();
+      const auto& node = nodeOf(range);
+      using Node = std::decay_t<decltype(node)>;
+      using Scalar = NodeScalar_t<Node>;
+
+      const std::size_t count = node.size();
+      QuantityArray<Scalar, Unit> result(count, uninitialized);
+      Scalar* out = result.data();
+      std::size_t i = 0;
+      if constexpr (IsBatchLoadable_v<Node>) {
+        constexpr std::size_t Width = NativeBatch<Scalar>::lanes;
+        for (; i + Width <= count; i += Width) {
+          f(loadBatch<Scalar, Width>(node, i)).store(out + i);
+        }
+      }
+      for (; i < count; ++i) {
+        out[i] = f(node(i));
+      }
+      return result;
+    }
+  }  // namespace detail
+
+  // Each function accepts a unitless Quantity, e.g. an si::Angle, and returns a unitless
+  // Quantity of the same Scalar. The Scalar is passed to the function found by
+  // argument-dependent lookup, falling back to <cmath>.
+#define POIDS_DECLARE_UNITLESS_FUNCTION(name)                                         \
+  template <typename ScalarType, typename UnitType, bool IsBase>                      \
+  auto name(const Quantity<ScalarType, UnitType, IsBase>& x) {                        \
+    detail::requireUnitless<UnitType>();                                              \
+    using std::name;                                                                  \
+    return Quantity<ScalarType, UnitType>::makeFromBaseUnitValue(name(x.base()));     \
+  }
+
+  POIDS_DECLARE_UNITLESS_FUNCTION(sin)
+  POIDS_DECLARE_UNITLESS_FUNCTION(cos)
+  POIDS_DECLARE_UNITLESS_FUNCTION(tan)
+  POIDS_DECLARE_UNITLESS_FUNCTION(asin)
+  POIDS_DECLARE_UNITLESS_FUNCTION(acos)
+  POIDS_DECLARE_UNITLESS_FUNCTION(atan)
+  POIDS_DECLARE_UNITLESS_FUNCTION(sinh)
+  POIDS_DECLARE_UNITLESS_FUNCTION(cosh)
+  POIDS_DECLARE_UNITLESS_FUNCTION(tanh)
+  POIDS_DECLARE_UNITLESS_FUNCTION(exp)
+  POIDS_DECLARE_UNITLESS_FUNCTION(log)
+  POIDS_DECLARE_UNITLESS_FUNCTION(log2)
+  POIDS_DECLARE_UNITLESS_FUNCTION(log10)
+
+#undef POIDS_DECLARE_UNITLESS_FUNCTION
+
+  /** Calculates the sine and cosine of a unitless quantity together */
+  template <typename ScalarType, typename UnitType, bool IsBase>
+  auto sincos(const Quantity<ScalarType, UnitType, IsBase>& x) {
+    detail::requireUnitless<UnitType>();
+    using Result = Quantity<ScalarType, UnitType>;
+    const auto [sinX, cosX] = detail::sinCosOf(x.base());
+    return std::pair<Result, Result>{Result::makeFromBaseUnitValue(sinX), Result::makeFromBaseUnitValue(cosX)};
+  }
+
+  /** Calculates the angle of the point (x, y), where y and x have the same unit */
+  template <typename ScalarType, typename UnitTypeY, bool IsBaseY, typename UnitTypeX, bool IsBaseX>
+  auto atan2(const Quantity<ScalarType, UnitTypeY, IsBaseY>& y, const Quantity<ScalarType, UnitTypeX, IsBaseX>& x) {
+    static_assert(std::is_same_v<UnitTypeY, UnitTypeX>, "atan2 requires both coordinates to have the same unit");
+    using std::atan2;
+    return Quantity<ScalarType, typename UnitTypeY::template divide_t<UnitTypeX>>::makeFromBaseUnitValue(
+        atan2(y.base(), x.base()));
+  }
+
+  /** Calculates the sine of every element of a unitless QuantityArray, QuantitySpan or
+   * ArrayExpression. Double elements are computed a NativeBatch at a time, see sincos(Batch).
+   */
+  template <typename Range,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  auto sin(const Range& range) {
+    return detail::transformUnitless(range, [](const auto& x) { using std::sin; return sin(x); });
+  }
+
+  /** Calculates the cosine of every element of a unitless range */
+  template <typename Range,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  auto cos(const Range& range) {
+    return detail::transformUnitless(range, [](const auto& x) { using std::cos; return cos(x); });
+  }
+
+  /** Calculates the sine and cosine of every element of a unitless range in a single pass */
+  template <typename Range,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  auto sincos(const Range& range) {
+    using Unit = typename detail::ArrayOperandOf<Range>::Unit;
+    detail::requireUnitless<Unit>();
+    const auto& node = detail::nodeOf(range);
+    using Node = std::decay_t<decltype(node)>;
+    using Scalar = detail::NodeScalar_t<Node>;
+
+    const std::size_t count = node.size();
+    std::pair<QuantityArray<Scalar, Unit>, QuantityArray<Scalar, Unit>> result{
+        QuantityArray<Scalar, Unit>(count, uninitialized), QuantityArray<Scalar, Unit>(count, uninitialized)};
+    Scalar* sinOut = result.first.data();
+    Scalar* cosOut = result.second.data();
+    std::size_t i = 0;
+    if constexpr (detail::IsBatchLoadable_v<Node>) {
+      constexpr std::size_t Width = NativeBatch<Scalar>::lanes;
+      for (; i + Width <= count; i += Width) {
+        const auto [sinX, cosX] = detail::sinCosOf(detail::loadBatch<Scalar, Width>(node, i));
+        sinX.store(sinOut + i);
+        cosX.store(cosOut + i);
+      }
+    }
+    for (; i < count; ++i) {
+      std::tie(sinOut[i], cosOut[i]) = detail::sinCosOf(node(i));
+    }
+    return result;
+  }
+
+  /** Calculates the exponential of every element of a unitless range */
+  template <typename Range,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  auto exp(const Range& range) {
+    return detail::transformUnitless(range, [](const auto& x) { using std::exp; return exp(x); });
+  }
+
+  /** Calculates the natural logarithm of every element of a unitless range */
+  template <typename Range,
+            typename = std::enable_if_t<detail::IsArrayOperand_v<Range>>>
+  auto log(const Range& range) {
+    return detail::transformUnitless(range, [](const auto& x) { using std::log; return log(x); });
+  }
+}  // namespace poids
+
+#endif
@@ -0,0 +1,390 @@
+#ifndef POIDS_PARALLEL_ALGORITHM_HPP
+#define POIDS_PARALLEL_ALGORITHM_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "poids/algorithm/reduce.hpp"
+#include "poids/core/array_expression.hpp"
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/core/traits.hpp"
+#include "poids/core/uninitialized.hpp"
+#include "poids/parallel/thread_pool.hpp"
+
+namespace poids::parallel {
+  /** Splits reductions and scans into a few blocks per thread of the pool. Results
+   * are reproducible for a given number of threads, but rounding differs between
+   * pools of different sizes.
+   */
+  struct ChunkedReduction {
+    explicit ChunkedReduction() = default;
+  };
+
+  /** Splits reductions and scans into blocks of a fixed size, combined in index
+   * order, so that results are bitwise identical for any number of threads.
+   */
+  struct DeterministicReduction {
+    explicit DeterministicReduction() = default;
+  };
+
+  inline constexpr ChunkedReduction chunkedReduction{};
+  inline constexpr DeterministicReduction deterministicReduction{};
+
+  namespace detail {
+    /** The number of elements below which a range is not split further between threads */
+    inline constexpr std::size_t Grain = 4096;
+    /** The number of blocks per thread of a chunked reduction, to balance the load */
+    inline constexpr std::size_t BlocksPerThread = 4;
+    /** The number of elements in each block of a deterministic reduction */
+    inline constexpr std::size_t DeterministicBlock = 8192;
+
+    template <typename T>
+    inline constexpr bool IsRange_v = IsQuantityContainer_v<std::decay_t<T>>;
+
+    template <typename T>
+    inline constexpr bool IsReductionOrder_v = std::is_same_v<T, ChunkedReduction> ||
+                                               std::is_same_v<T, DeterministicReduction>;
+
+    inline std::size_t blockSize(const ThreadPool& pool, std::size_t count, ChunkedReduction) {
+      const std::size_t blocks = pool.concurrency() * BlocksPerThread;
+      return std::max(Grain, (count + blocks - 1) / blocks);
+    }
+
+    inline std::size_t blockSize(const ThreadPool&, std::size_t, DeterministicReduction) {
+      return DeterministicBlock;
+    }
+
+    /** Reads an element of a range as a Quantity, rather than as a reference into it */
+    template <typename Range>
+    typename std::decay_t<Range>::value_type elementOf(const Range& range, std::size_t i) {
+      return typename std::decay_t<Range>::value_type(range[i]);
+    }
+
+    /** Calls block(first, last) for every block of [0, count), then folds the
+     * results into init with combine in index order.
+     */
+    template <typename T, typename Order, typename Block, typename Combine>
+    T reduceBlocks(ThreadPool& pool, std::size_t count, T init, Order order, const Block& block,
+                   const Combine& combine) {
+      const std::size_t size = blockSize(pool, count, order);
+      const std::size_t blockCount = (count + size - 1) / size;
+      std::vector<T> partials(blockCount, init);
+      pool.forEachChunk(blockCount, 1, [&](std::size_t firstBlock, std::size_t lastBlock) {
+        for (std::size_t b = firstBlock; b < lastBlock; ++b) {
+          partials[b] = block(b * size, std::min(count, (b + 1) * size));
+        }
+      });
+      for (const T& partial : partials) {
+        init = combine(init, partial);
+      }
+      return init;
+    }
+
+    /** Scans in three passes: the total of each block, the offset of each block
+     * from the totals before it, and the scan of each block from its offset.
+     * The first block of an inclusive scan has no offset.
+     */
+    template <bool Inclusive, typename T, typename In, typename Out, typename Op, typename Order>
+    void scanBlocks(ThreadPool& pool, const In& in, Out& out, const T& init, const Op& op, Order order) {
+      assert(in.size() == out.size());
+      const std::size_t count = in.size();
+      const std::size_t size = blockSize(pool, count, order);
+      const std::size_t blockCount = (count + size - 1) / size;
+
+      std::vector<T> offsets(blockCount, init);
+      pool.forEachChunk(blockCount - std::min<std::size_t>(blockCount, 1), 1,
+                        [&](std::size_t firstBlock, std::size_t lastBlock) {
+        for (std::size_t b = firstBlock; b < lastBlock; ++b) {
+          const std::size_t last = (b + 1) * size;
+          T total = elementOf(in, b * size);
+          for (std::size_t i = b * size + 1; i < last; ++i) {
+            total = op(total, elementOf(in, i));
+          }
+          offsets[b + 1] = total;
+        }
+      });
+      if (!Inclusive && blockCount > 1) {
+        offsets[1] = op(init, offsets[1]);
+      }
+      for (std::size_t b = 2; b < blockCount; ++b) {
+        offsets[b] = op(offsets[b - 1], offsets[b]);
+      }
+
+      pool.forEachChunk(blockCount, 1, [&](std::size_t firstBlock, std::size_t lastBlock) {
+        for (std::size_t b = firstBlock; b < lastBlock; ++b) {
+          std::size_t i = b * size;
+          const std::size_t last = std::min(count, i + size);
+          T accumulator = offsets[b];
+          if (Inclusive && b == 0) {
+            accumulator = elementOf(in, i);
+            out[i++] = accumulator;
+          }
+          for (; i < last; ++i) {
+            const T x = elementOf(in, i);
+            if constexpr (Inclusive) {
+              accumulator = op(accumulator, x);
+              out[i] = accumulator;
+            } else {
+              out[i] = accumulator;
+              accumulator = op(accumulator, x);
+            }
+          }
+        }
+      });
+    }
+  }  // namespace detail
+
+  /** Calls f(range[i]) for every element of a QuantityArray, QuantitySpan or other
+   * quantity container. Elements of mutable containers are passed as references,
+   * so f may assign to them.
+   */
+  template <typename Range,
+            typename F,
+            typename = std::enable_if_t<detail::IsRange_v<Range>>>
+  void forEach(ThreadPool& pool, Range&& range, F f) {
+    pool.forEachChunk(range.size(), detail::Grain, [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i) {
+        f(range[i]);
+      }
+    });
+  }
+
+  template <typename Range,
+            typename F,
+            typename = std::enable_if_t<detail::IsRange_v<Range>>>
+  void forEach(Range&& range, F f) {
+    forEach(ThreadPool::global(), std::forward<Range>(range), std::move(f));
+  }
+
+  /** Writes f(in[i]) to out[i] for every element. The unit of f's result must match
+   * the unit of out, exactly as when assigning a single Quantity.
+   */
+  template <typename In,
+            typename Out,
+            typename F,
+            typename = std::enable_if_t<detail::IsRange_v<In> && detail::IsRange_v<Out>>>
+  void transform(ThreadPool& pool, const In& in, Out&& out, F f) {
+    assert(in.size() == out.size());
+    pool.forEachChunk(in.size(), detail::Grain, [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i) {
+        out[i] = f(detail::elementOf(in, i));
+      }
+    });
+  }
+
+  template <typename In,
+            typename Out,
+            typename F,
+            typename = std::enable_if_t<detail::IsRange_v<In> && detail::IsRange_v<Out>>>
+  void transform(const In& in, Out&& out, F f) {
+    transform(ThreadPool::global(), in, std::forward<Out>(out), std::move(f));
+  }
+
+  /** Calculates f(in[i]) for every element into a new QuantityArray, whose Scalar
+   * and unit are those of the Quantity returned by f.
+   */
+  template <typename In,
+            typename F,
+            typename = std::enable_if_t<detail::IsRange_v<In>>>
+  auto transform(ThreadPool& pool, const In& in, F f) {
+    using Result = std::decay_t<decltype(f(detail::elementOf(in, 0)))>;
+    static_assert(IsQuantity_v<Result>, "parallel::transform requires f to return a poids::Quantity");
+    QuantityArray<ScalarOf_t<Result>, UnitOf_t<Result>> result(in.size(), uninitialized);
+    transform(pool, in, result, std::move(f));
+    return result;
+  }
+
+  template <typename In,
+            typename F,
+            typename = std::enable_if_t<detail::IsRange_v<In>>>
+  auto transform(const In& in, F f) {
+    return transform(ThreadPool::global(), in, std::move(f));
+  }
+
+  /** Adds together every element of a QuantityArray, QuantitySpan or ArrayExpression,
+   * with FastSummation inside each block. Expressions are reduced without
+   * materializing them.
+   */
+  template <typename Range,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<poids::detail::IsArrayOperand_v<Range> && detail::IsReductionOrder_v<Order>>>
+  poids::detail::ReductionResult_t<Range> reduce(ThreadPool& pool, const Range& range, Order order = Order{}) {
+    const auto& node = poids::detail::nodeOf(range);
+    using Scalar = ScalarOf_t<poids::detail::ReductionResult_t<Range>>;
+    return poids::detail::ReductionResult_t<Range>::makeFromBaseUnitValue(detail::reduceBlocks(
+        pool, node.size(), Scalar{}, order,
+        [&](std::size_t first, std::size_t last) {
+          return poids::detail::sumRange(node, first, last, fastSummation);
+        },
+        std::plus<>{}));
+  }
+
+  template <typename Range,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<poids::detail::IsArrayOperand_v<Range> && detail::IsReductionOrder_v<Order>>>
+  poids::detail::ReductionResult_t<Range> reduce(const Range& range, Order order = Order{}) {
+    return reduce(ThreadPool::global(), range, order);
+  }
+
+  /** Folds every element into init with op, which must be associative and
+   * commutative, e.g. std::plus<>() or a lambda taking the larger of two quantities.
+   */
+  template <typename Range,
+            typename T,
+            typename Op,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<Range> && detail::IsReductionOrder_v<Order>>>
+  T reduce(ThreadPool& pool, const Range& range, T init, Op op, Order order = Order{}) {
+    return detail::reduceBlocks(
+        pool, range.size(), std::move(init), order,
+        [&](std::size_t first, std::size_t last) {
+          T accumulator = detail::elementOf(range, first);
+          for (std::size_t i = first + 1; i < last; ++i) {
+            accumulator = op(accumulator, detail::elementOf(range, i));
+          }
+          return accumulator;
+        },
+        op);
+  }
+
+  template <typename Range,
+            typename T,
+            typename Op,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<Range> && detail::IsReductionOrder_v<Order>>>
+  T reduce(const Range& range, T init, Op op, Order order = Order{}) {
+    return reduce(ThreadPool::global(), range, std::move(init), std::move(op), order);
+  }
+
+  /** Folds transformOp(range[i]) for every element into init with reduceOp, e.g. the
+   * total energy of an array of powers over a time step.
+   */
+  template <typename Range,
+            typename T,
+            typename ReduceOp,
+            typename TransformOp,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<Range> && detail::IsReductionOrder_v<Order>>>
+  T transformReduce(ThreadPool& pool, const Range& range, T init, ReduceOp reduceOp, TransformOp transformOp,
+                    Order order = Order{}) {
+    return detail::reduceBlocks(
+        pool, range.size(), std::move(init), order,
+        [&](std::size_t first, std::size_t last) {
+          T accumulator = transformOp(detail::elementOf(range, first));
+          for (std::size_t i = first + 1; i < last; ++i) {
+            accumulator = reduceOp(accumulator, transformOp(detail::elementOf(range, i)));
+          }
+          return accumulator;
+        },
+        reduceOp);
+  }
+
+  template <typename Range,
+            typename T,
+            typename ReduceOp,
+            typename TransformOp,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<Range> && detail::IsReductionOrder_v<Order>>>
+  T transformReduce(const Range& range, T init, ReduceOp reduceOp, TransformOp transformOp, Order order = Order{}) {
+    return transformReduce(ThreadPool::global(), range, std::move(init), std::move(reduceOp), std::move(transformOp),
+                           order);
+  }
+
+  /** Folds transformOp(lhs[i], rhs[i]) for every pair of elements into init with
+   * reduceOp. The ranges must have the same size.
+   */
+  template <typename Lhs,
+            typename Rhs,
+            typename T,
+            typename ReduceOp,
+            typename TransformOp,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<Lhs> && detail::IsRange_v<Rhs> &&
+                                        detail::IsReductionOrder_v<Order>>>
+  T transformReduce(ThreadPool& pool, const Lhs& lhs, const Rhs& rhs, T init, ReduceOp reduceOp,
+                    TransformOp transformOp, Order order = Order{}) {
+    assert(lhs.size() == rhs.size());
+    return detail::reduceBlocks(
+        pool, lhs.size(), std::move(init), order,
+        [&](std::size_t first, std::size_t last) {
+          T accumulator = transformOp(detail::elementOf(lhs, first), detail::elementOf(rhs, first));
+          for (std::size_t i = first + 1; i < last; ++i) {
+            accumulator = reduceOp(accumulator, transformOp(detail::elementOf(lhs, i), detail::elementOf(rhs, i)));
+          }
+          return accumulator;
+        },
+        reduceOp);
+  }
+
+  template <typename Lhs,
+            typename Rhs,
+            typename T,
+            typename ReduceOp,
+            typename TransformOp,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<Lhs> && detail::IsRange_v<Rhs> &&
+                                        detail::IsReductionOrder_v<Order>>>
+  T transformReduce(const Lhs& lhs, const Rhs& rhs, T init, ReduceOp reduceOp, TransformOp transformOp,
+                    Order order = Order{}) {
+    return transformReduce(ThreadPool::global(), lhs, rhs, std::move(init), std::move(reduceOp),
+                           std::move(transformOp), order);
+  }
+
+  /** Writes op(in[0], ..., in[i]) to out[i] for every element, e.g. the running
+   * distance from an array of displacements. in and out may be the same range.
+   */
+  template <typename In,
+            typename Out,
+            typename Op = std::plus<>,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<In> && detail::IsRange_v<Out> &&
+                                        detail::IsReductionOrder_v<Order>>>
+  void inclusiveScan(ThreadPool& pool, const In& in, Out&& out, Op op = Op{}, Order order = Order{}) {
+    using T = typename std::decay_t<In>::value_type;
+    detail::scanBlocks<true>(pool, in, out, T{}, op, order);
+  }
+
+  template <typename In,
+            typename Out,
+            typename Op = std::plus<>,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<In> && detail::IsRange_v<Out> &&
+                                        detail::IsReductionOrder_v<Order>>>
+  void inclusiveScan(const In& in, Out&& out, Op op = Op{}, Order order = Order{}) {
+    inclusiveScan(ThreadPool::global(), in, std::forward<Out>(out), std::move(op), order);
+  }
+
+  /** Writes op(init, in[0], ..., in[i - 1]) to out[i] for every element, so that
+   * out[0] is init. in and out may be the same range.
+   */
+  template <typename In,
+            typename Out,
+            typename T,
+            typename Op = std::plus<>,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<In> && detail::IsRange_v<Out> &&
+                                        detail::IsReductionOrder_v<Order>>>
+  void exclusiveScan(ThreadPool& pool, const In& in, Out&& out, T init, Op op = Op{}, Order order = Order{}) {
+    detail::scanBlocks<false>(pool, in, out, init, op, order);
+  }
+
+  template <typename In,
+            typename Out,
+            typename T,
+            typename Op = std::plus<>,
+            typename Order = ChunkedReduction,
+            typename = std::enable_if_t<detail::IsRange_v<In> && detail::IsRange_v<Out> &&
+                                        detail::IsReductionOrder_v<Order>>>
+  void exclusiveScan(const In& in, Out&& out, T init, Op op = Op{}, Order order = Order{}) {
+    exclusiveScan(ThreadPool::global(), in, std::forward<Out>(out), std::move(init), std::move(op), order);
+  }
+}  // namespace poids::parallel
+
+#endif
@@ -0,0 +1,236 @@
+#ifndef POIDS_PARALLEL_THREAD_POOL_HPP
+#define POIDS_PARALLEL_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace poids::parallel {
+  /** A fixed set of worker threads which run index ranges with work-stealing.
+   *
+   * Every worker owns a deque of tasks. A task too large for the grain is split in
+   * half, and the upper half is pushed onto the back of the deque of the thread
+   * running it. Owners pop from the back, so they keep working on the most recently
+   * split, cache-hot halves, while idle threads steal from the front, which holds
+   * the largest remaining halves. Load therefore balances itself without any
+   * up-front partitioning, including when ranges are nested.
+   *
+   * The thread calling forEachChunk() takes part in the work until its range is
+   * done, so a pool of N workers runs on N + 1 threads.
+   */
+  class ThreadPool {
+   public:
+    /** One worker per hardware thread besides the calling thread */
+    static std::size_t defaultWorkerCount() {
+      const std::size_t hardware = std::thread::hardware_concurrency();
+      return hardware > 1 ? hardware - 1 : 0;
+    }
+
+    /** A pool shared by the parallel algorithms when none is given */
+    static ThreadPool& global() {
+      static ThreadPool pool;
+      return pool;
+    }
+
+    explicit ThreadPool(std::size_t workerCount = defaultWorkerCount()) {
+      // the last queue is shared by every thread outside the pool
+      for (std::size_t i = 0; i <= workerCount; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+      }
+      threads_.reserve(workerCount);
+      for (std::size_t i = 0; i < workerCount; ++i) {
+        threads_.emplace_back([this, i] { work(i); });
+      }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+      }
+      sleep_.notify_all();
+      for (std::thread& thread : threads_) {
+        thread.join();
+      }
+    }
+
+    /** The number of threads which run a range, including the calling thread */
+    std::size_t concurrency() const { return threads_.size() + 1; }
+
+    /** Calls f(first, last) on disjoint chunks covering [0, count), each of at most
+     * grain indices, and returns once every chunk is done. f is called concurrently
+     * from several threads, so it must be callable through a const reference.
+     *
+     * If f throws, the remaining chunks are skipped and the first exception is
+     * rethrown here.
+     */
+    template <typename F>
+    void forEachChunk(std::size_t count, std::size_t grain, const F& f) {
+      grain = std::max<std::size_t>(grain, 1);
+      if (count == 0) {
+        return;
+      }
+      if (threads_.empty() || count <= grain) {
+        f(std::size_t{0}, count);
+        return;
+      }
+
+      Job job;
+      job.invoke = [](const void* function, std::size_t first, std::size_t last) {
+        (*static_cast<const F*>(function))(first, last);
+      };
+      job.function = &f;
+      job.grain = grain;
+      job.remaining.store(count, std::memory_order_relaxed);
+
+      const std::size_t index = callerQueue();
+      push(index, Task{&job, 0, count});
+      while (job.remaining.load(std::memory_order_acquire) != 0) {
+        if (!runOne(index)) {
+          std::this_thread::yield();
+        }
+      }
+      if (job.error) {
+        std::rethrow_exception(job.error);
+      }
+    }
+
+   private:
+    struct Job {
+      void (*invoke)(const void*, std::size_t, std::size_t) = nullptr;
+      const void* function = nullptr;
+      std::size_t grain = 1;
+      /** The number of indices not yet processed. The job is done at zero. */
+      std::atomic<std::size_t> remaining{0};
+      std::atomic<bool> failed{false};
+      std::mutex errorMutex;
+      std::exception_ptr error;
+    };
+
+    struct Task {
+      Job* job;
+      std::size_t first;
+      std::size_t last;
+    };
+
+    struct Queue {
+      std::mutex mutex;
+      std::deque<Task> tasks;
+    };
+
+    struct Identity {
+      const ThreadPool* pool = nullptr;
+      std::size_t index = 0;
+    };
+
+    static Identity& identity() {
+      static thread_local Identity value;
+      return value;
+    }
+
+    std::size_t callerQueue() const {
+      const Identity& caller = identity();
+      return caller.pool == this ? caller.index : queues_.size() - 1;
+    }
+
+    void push(std::size_t index, const Task& task) {
+      {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(task);
+      }
+      queued_.fetch_add(1, std::memory_order_release);
+      // taking the lock orders the increment against a worker about to sleep
+      { std::lock_guard<std::mutex> lock(sleepMutex_); }
+      sleep_.notify_one();
+    }
+
+    bool pop(std::size_t index, Task& task) {
+      Queue& queue = *queues_[index];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) {
+        return false;
+      }
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+      queued_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+
+    bool steal(std::size_t index, Task& task) {
+      for (std::size_t offset = 1; offset < queues_.size(); ++offset) {
+        Queue& queue = *queues_[(index + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+          task = queue.tasks.front();
+          queue.tasks.pop_front();
+          queued_.fetch_sub(1, std::memory_order_relaxed);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /** Runs a task from the given queue, or one stolen from another queue */
+    bool runOne(std::size_t index) {
+      Task task;
+      if (!pop(index, task) && !steal(index, task)) {
+        return false;
+      }
+
+      Job& job = *task.job;
+      while (task.last - task.first > job.grain) {
+        const std::size_t middle = task.first + (task.last - task.first) / 2;
+        push(index, Task{&job, middle, task.last});
+        task.last = middle;
+      }
+      if (!job.failed.load(std::memory_order_relaxed)) {
+        try {
+          job.invoke(job.function, task.first, task.last);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(job.errorMutex);
+          if (!job.error) {
+            job.error = std::current_exception();
+          }
+          job.failed.store(true, std::memory_order_relaxed);
+        }
+      }
+      // the caller may destroy the job as soon as remaining reaches zero
+      job.remaining.fetch_sub(task.last - task.first, std::memory_order_acq_rel);
+      return true;
+    }
+
+    void work(std::size_t index) {
+      identity() = Identity{this, index};
+      while (true) {
+        if (runOne(index)) {
+          continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        sleep_.wait(lock, [this] { return stopping_ || queued_.load(std::memory_order_acquire) != 0; });
+        if (stopping_) {
+          return;
+        }
+      }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<std::size_t> queued_{0};
+    std::mutex sleepMutex_;
+    std::condition_variable sleep_;
+    bool stopping_ = false;
+  };
+}  // namespace poids::parallel
+
+#endif
@@ -2,7 +2,10 @@
 #define POIDS_POIDS_HPP
 
 #include "poids/core/quantity.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/quantity_span.hpp"
 #include "poids/core/reference.hpp"
+#include "poids/core/scaled_quantity.hpp"
 #include "poids/core/scalar_support.hpp"
 #include "poids/core/traits.hpp"
 
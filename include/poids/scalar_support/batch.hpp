@@ -0,0 +1,769 @@
+#ifndef POIDS_SCALAR_SUPPORT_BATCH_HPP
+#define POIDS_SCALAR_SUPPORT_BATCH_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define POIDS_BATCH_SSE2 1
+#include <immintrin.h>
+#endif
+#if defined(__AVX__)
+#define POIDS_BATCH_AVX 1
+#endif
+#if defined(__AVX512F__)
+#define POIDS_BATCH_AVX512 1
+#endif
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/core/scalar_support.hpp"
+
+namespace poids {
+  namespace detail {
+    /** Lane-wise operations on a register of N values of T.
+     *
+     * This portable implementation is used when no instruction set of the target
+     * matches T and N. It is specialized below for SSE2, AVX and AVX-512 registers.
+     */
+    template <typename T, std::size_t N>
+    struct BatchKernel {
+      struct Register {
+        T lanes[N];
+      };
+      struct MaskRegister {
+        bool lanes[N];
+      };
+
+      template <typename Op>
+      static Register map(const Register& a, const Register& b, Op op) {
+        Register result;
+        for (std::size_t i = 0; i < N; ++i) {
+          result.lanes[i] = op(a.lanes[i], b.lanes[i]);
+        }
+        return result;
+      }
+
+      template <typename Op>
+      static MaskRegister test(const Register& a, const Register& b, Op op) {
+        MaskRegister result;
+        for (std::size_t i = 0; i < N; ++i) {
+          result.lanes[i] = op(a.lanes[i], b.lanes[i]);
+        }
+        return result;
+      }
+
+      template <typename Op>
+      static MaskRegister combine(const MaskRegister& a, const MaskRegister& b, Op op) {
+        MaskRegister result;
+        for (std::size_t i = 0; i < N; ++i) {
+          result.lanes[i] = op(a.lanes[i], b.lanes[i]);
+        }
+        return result;
+      }
+
+      static Register broadcast(T value) {
+        Register result;
+        for (std::size_t i = 0; i < N; ++i) {
+          result.lanes[i] = value;
+        }
+        return result;
+      }
+
+      static Register load(const T* values) {
+        Register result;
+        for (std::size_t i = 0; i < N; ++i) {
+          result.lanes[i] = values[i];
+        }
+        return result;
+      }
+
+      static void store(T* values, const Register& a) {
+        for (std::size_t i = 0; i < N; ++i) {
+          values[i] = a.lanes[i];
+        }
+      }
+
+      static Register add(const Register& a, const Register& b) { return map(a, b, [](T x, T y) { return x + y; }); }
+      static Register subtract(const Register& a, const Register& b) { return map(a, b, [](T x, T y) { return x - y; }); }
+      static Register multiply(const Register& a, const Register& b) { return map(a, b, [](T x, T y) { return x * y; }); }
+      static Register divide(const Register& a, const Register& b) { return map(a, b, [](T x, T y) { return x / y; }); }
+      static Register min(const Register& a, const Register& b) { return map(a, b, [](T x, T y) { return x < y ? x : y; }); }
+      static Register max(const Register& a, const Register& b) { return map(a, b, [](T x, T y) { return x > y ? x : y; }); }
+
+      static Register negate(const Register& a) {
+        Register result;
+        for (std::size_t i = 0; i < N; ++i) {
+          result.lanes[i] = -a.lanes[i];
+        }
+        return result;
+      }
+
+      static Register sqrt(const Register& a) {
+        Register result;
+        for (std::size_t i = 0; i < N; ++i) {
+          using std::sqrt;
+          result.lanes[i] = sqrt(a.lanes[i]);
+        }
+        return result;
+      }
+
+      static Register ldexp(const Register& a, const Register& n) {
+        Register result;
+        for (std::size_t i = 0; i < N; ++i) {
+          using std::ldexp;
+          result.lanes[i] = ldexp(a.lanes[i], static_cast<int>(n.lanes[i]));
+        }
+        return result;
+      }
+
+      static Register frexp(const Register& a, Register& exponent) {
+        Register result;
+        for (std::size_t i = 0; i < N; ++i) {
+          using std::frexp;
+          int power = 0;
+          result.lanes[i] = frexp(a.lanes[i], &power);
+          exponent.lanes[i] = static_cast<T>(power);
+        }
+        return result;
+      }
+
+      static MaskRegister equal(const Register& a, const Register& b) { return test(a, b, [](T x, T y) { return x == y; }); }
+      static MaskRegister notEqual(const Register& a, const Register& b) { return test(a, b, [](T x, T y) { return x != y; }); }
+      static MaskRegister less(const Register& a, const Register& b) { return test(a, b, [](T x, T y) { return x < y; }); }
+      static MaskRegister lessEqual(const Register& a, const Register& b) { return test(a, b, [](T x, T y) { return x <= y; }); }
+
+      static MaskRegister maskAnd(const MaskRegister& a, const MaskRegister& b) { return combine(a, b, [](bool x, bool y) { return x && y; }); }
+      static MaskRegister maskOr(const MaskRegister& a, const MaskRegister& b) { return combine(a, b, [](bool x, bool y) { return x || y; }); }
+      static MaskRegister maskXor(const MaskRegister& a, const MaskRegister& b) { return combine(a, b, [](bool x, bool y) { return x != y; }); }
+
+      static MaskRegister maskNot(const MaskRegister& a) {
+        MaskRegister result;
+        for (std::size_t i = 0; i < N; ++i) {
+          result.lanes[i] = !a.lanes[i];
+        }
+        return result;
+      }
+
+      static std::uint64_t maskBits(const MaskRegister& a) {
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+          bits |= std::uint64_t{a.lanes[i]} << i;
+        }
+        return bits;
+      }
+
+      static Register select(const MaskRegister& mask, const Register& a, const Register& b) {
+        Register result;
+        for (std::size_t i = 0; i < N; ++i) {
+          result.lanes[i] = mask.lanes[i] ? a.lanes[i] : b.lanes[i];
+        }
+        return result;
+      }
+    };
+
+#ifdef POIDS_BATCH_SSE2
+    /** a * 2^n for integral n in [-1022, 1023]. Adding 2^52 + 1023 leaves n + 1023 in
+     * the low bits of the mantissa, from where it is shifted into the exponent.
+     */
+    inline __m128d ldexpPd(__m128d a, __m128d n) {
+      const __m128i biased = _mm_castpd_si128(_mm_add_pd(n, _mm_set1_pd(4503599627371519.0)));
+      return _mm_mul_pd(a, _mm_castsi128_pd(_mm_slli_epi64(biased, 52)));
+    }
+
+    /** Splits normal values into a mantissa in [0.5, 1) and a power of two. The biased
+     * exponent is converted to double by placing it in the mantissa of 2^52.
+     */
+    inline __m128d frexpPd(__m128d a, __m128d& exponent) {
+      const __m128i bits = _mm_castpd_si128(a);
+      const __m128i biased = _mm_and_si128(_mm_srli_epi64(bits, 52), _mm_set1_epi64x(0x7ff));
+      exponent = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(biased, _mm_set1_epi64x(0x4330000000000000))),
+                            _mm_set1_pd(4503599627371518.0));
+      const __m128i mantissa = _mm_and_si128(bits, _mm_set1_epi64x(static_cast<long long>(0x800fffffffffffffull)));
+      return _mm_castsi128_pd(_mm_or_si128(mantissa, _mm_set1_epi64x(0x3fe0000000000000)));
+    }
+
+    /** a * 2^n for integral n in [-126, 127], as ldexpPd */
+    inline __m128 ldexpPs(__m128 a, __m128 n) {
+      const __m128i biased = _mm_castps_si128(_mm_add_ps(n, _mm_set1_ps(8388735.0f)));
+      return _mm_mul_ps(a, _mm_castsi128_ps(_mm_slli_epi32(biased, 23)));
+    }
+
+    /** Splits normal values into a mantissa in [0.5, 1) and a power of two, as frexpPd */
+    inline __m128 frexpPs(__m128 a, __m128& exponent) {
+      const __m128i bits = _mm_castps_si128(a);
+      const __m128i biased = _mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0xff));
+      exponent = _mm_sub_ps(_mm_castsi128_ps(_mm_or_si128(biased, _mm_set1_epi32(0x4b000000))),
+                            _mm_set1_ps(8388734.0f));
+      const __m128i mantissa = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x807fffffu)));
+      return _mm_castsi128_ps(_mm_or_si128(mantissa, _mm_set1_epi32(0x3f000000)));
+    }
+
+    template <>
+    struct BatchKernel<double, 2> {
+      using Register = __m128d;
+      using MaskRegister = __m128d;
+
+      static Register broadcast(double value) { return _mm_set1_pd(value); }
+      static Register load(const double* values) { return _mm_loadu_pd(values); }
+      static void store(double* values, Register a) { _mm_storeu_pd(values, a); }
+
+      static Register add(Register a, Register b) { return _mm_add_pd(a, b); }
+      static Register subtract(Register a, Register b) { return _mm_sub_pd(a, b); }
+      static Register multiply(Register a, Register b) { return _mm_mul_pd(a, b); }
+      static Register divide(Register a, Register b) { return _mm_div_pd(a, b); }
+      static Register min(Register a, Register b) { return _mm_min_pd(a, b); }
+      static Register max(Register a, Register b) { return _mm_max_pd(a, b); }
+      static Register negate(Register a) { return _mm_xor_pd(a, _mm_set1_pd(-0.0)); }
+      static Register sqrt(Register a) { return _mm_sqrt_pd(a); }
+      static Register ldexp(Register a, Register n) { return ldexpPd(a, n); }
+      static Register frexp(Register a, Register& exponent) { return frexpPd(a, exponent); }
+
+      static MaskRegister equal(Register a, Register b) { return _mm_cmpeq_pd(a, b); }
+      static MaskRegister notEqual(Register a, Register b) { return _mm_cmpneq_pd(a, b); }
+      static MaskRegister less(Register a, Register b) { return _mm_cmplt_pd(a, b); }
+      static MaskRegister lessEqual(Register a, Register b) { return _mm_cmple_pd(a, b); }
+
+      static MaskRegister maskAnd(MaskRegister a, MaskRegister b) { return _mm_and_pd(a, b); }
+      static MaskRegister maskOr(MaskRegister a, MaskRegister b) { return _mm_or_pd(a, b); }
+      static MaskRegister maskXor(MaskRegister a, MaskRegister b) { return _mm_xor_pd(a, b); }
+      static MaskRegister maskNot(MaskRegister a) { return _mm_xor_pd(a, _mm_castsi128_pd(_mm_set1_epi32(-1))); }
+      static std::uint64_t maskBits(MaskRegister a) { return static_cast<std::uint64_t>(_mm_movemask_pd(a)); }
+
+      static Register select(MaskRegister mask, Register a, Register b) {
+        return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+      }
+    };
+
+    template <>
+    struct BatchKernel<float, 4> {
+      using Register = __m128;
+      using MaskRegister = __m128;
+
+      static Register broadcast(float value) { return _mm_set1_ps(value); }
+      static Register load(const float* values) { return _mm_loadu_ps(values); }
+      static void store(float* values, Register a) { _mm_storeu_ps(values, a); }
+
+      static Register add(Register a, Register b) { return _mm_add_ps(a, b); }
+      static Register subtract(Register a, Register b) { return _mm_sub_ps(a, b); }
+      static Register multiply(Register a, Register b) { return _mm_mul_ps(a, b); }
+      static Register divide(Register a, Register b) { return _mm_div_ps(a, b); }
+      static Register min(Register a, Register b) { return _mm_min_ps(a, b); }
+      static Register max(Register a, Register b) { return _mm_max_ps(a, b); }
+      static Register negate(Register a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+      static Register sqrt(Register a) { return _mm_sqrt_ps(a); }
+      static Register ldexp(Register a, Register n) { return ldexpPs(a, n); }
+      static Register frexp(Register a, Register& exponent) { return frexpPs(a, exponent); }
+
+      static MaskRegister equal(Register a, Register b) { return _mm_cmpeq_ps(a, b); }
+      static MaskRegister notEqual(Register a, Register b) { return _mm_cmpneq_ps(a, b); }
+      static MaskRegister less(Register a, Register b) { return _mm_cmplt_ps(a, b); }
+      static MaskRegister lessEqual(Register a, Register b) { return _mm_cmple_ps(a, b); }
+
+      static MaskRegister maskAnd(MaskRegister a, MaskRegister b) { return _mm_and_ps(a, b); }
+      static MaskRegister maskOr(MaskRegister a, MaskRegister b) { return _mm_or_ps(a, b); }
+      static MaskRegister maskXor(MaskRegister a, MaskRegister b) { return _mm_xor_ps(a, b); }
+      static MaskRegister maskNot(MaskRegister a) { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+      static std::uint64_t maskBits(MaskRegister a) { return static_cast<std::uint64_t>(_mm_movemask_ps(a)); }
+
+      static Register select(MaskRegister mask, Register a, Register b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+      }
+    };
+#endif
+
+#ifdef POIDS_BATCH_AVX
+    template <>
+    struct BatchKernel<double, 4> {
+      using Register = __m256d;
+      using MaskRegister = __m256d;
+
+      static Register broadcast(double value) { return _mm256_set1_pd(value); }
+      static Register load(const double* values) { return _mm256_loadu_pd(values); }
+      static void store(double* values, Register a) { _mm256_storeu_pd(values, a); }
+
+      static Register add(Register a, Register b) { return _mm256_add_pd(a, b); }
+      static Register subtract(Register a, Register b) { return _mm256_sub_pd(a, b); }
+      static Register multiply(Register a, Register b) { return _mm256_mul_pd(a, b); }
+      static Register divide(Register a, Register b) { return _mm256_div_pd(a, b); }
+      static Register min(Register a, Register b) { return _mm256_min_pd(a, b); }
+      static Register max(Register a, Register b) { return _mm256_max_pd(a, b); }
+      static Register negate(Register a) { return _mm256_xor_pd(a, _mm256_set1_pd(-0.0)); }
+      static Register sqrt(Register a) { return _mm256_sqrt_pd(a); }
+      // AVX has no 256-bit integer operations, so the exponent is handled in halves
+      static Register ldexp(Register a, Register n) {
+        const __m128d low = ldexpPd(_mm256_castpd256_pd128(a), _mm256_castpd256_pd128(n));
+        const __m128d high = ldexpPd(_mm256_extractf128_pd(a, 1), _mm256_extractf128_pd(n, 1));
+        return _mm256_insertf128_pd(_mm256_castpd128_pd256(low), high, 1);
+      }
+      static Register frexp(Register a, Register& exponent) {
+        __m128d lowExponent;
+        __m128d highExponent;
+        const __m128d low = frexpPd(_mm256_castpd256_pd128(a), lowExponent);
+        const __m128d high = frexpPd(_mm256_extractf128_pd(a, 1), highExponent);
+        exponent = _mm256_insertf128_pd(_mm256_castpd128_pd256(lowExponent), highExponent, 1);
+        return _mm256_insertf128_pd(_mm256_castpd128_pd256(low), high, 1);
+      }
+
+      static MaskRegister equal(Register a, Register b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+      static MaskRegister notEqual(Register a, Register b) { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+      static MaskRegister less(Register a, Register b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+      static MaskRegister lessEqual(Register a, Register b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+
+      static MaskRegister maskAnd(MaskRegister a, MaskRegister b) { return _mm256_and_pd(a, b); }
+      static MaskRegister maskOr(MaskRegister a, MaskRegister b) { return _mm256_or_pd(a, b); }
+      static MaskRegister maskXor(MaskRegister a, MaskRegister b) { return _mm256_xor_pd(a, b); }
+      static MaskRegister maskNot(MaskRegister a) { return _mm256_xor_pd(a, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+      static std::uint64_t maskBits(MaskRegister a) { return static_cast<std::uint64_t>(_mm256_movemask_pd(a)); }
+
+      static Register select(MaskRegister mask, Register a, Register b) { return _mm256_blendv_pd(b, a, mask); }
+    };
+
+    template <>
+    struct BatchKernel<float, 8> {
+      using Register = __m256;
+      using MaskRegister = __m256;
+
+      static Register broadcast(float value) { return _mm256_set1_ps(value); }
+      static Register load(const float* values) { return _mm256_loadu_ps(values); }
+      static void store(float* values, Register a) { _mm256_storeu_ps(values, a); }
+
+      static Register add(Register a, Register b) { return _mm256_add_ps(a, b); }
+      static Register subtract(Register a, Register b) { return _mm256_sub_ps(a, b); }
+      static Register multiply(Register a, Register b) { return _mm256_mul_ps(a, b); }
+      static Register divide(Register a, Register b) { return _mm256_div_ps(a, b); }
+      static Register min(Register a, Register b) { return _mm256_min_ps(a, b); }
+      static Register max(Register a, Register b) { return _mm256_max_ps(a, b); }
+      static Register negate(Register a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+      static Register sqrt(Register a) { return _mm256_sqrt_ps(a); }
+      static Register ldexp(Register a, Register n) {
+        const __m128 low = ldexpPs(_mm256_castps256_ps128(a), _mm256_castps256_ps128(n));
+        const __m128 high = ldexpPs(_mm256_extractf128_ps(a, 1), _mm256_extractf128_ps(n, 1));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+      }
+      static Register frexp(Register a, Register& exponent) {
+        __m128 lowExponent;
+        __m128 highExponent;
+        const __m128 low = frexpPs(_mm256_castps256_ps128(a), lowExponent);
+        const __m128 high = frexpPs(_mm256_extractf128_ps(a, 1), highExponent);
+        exponent = _mm256_insertf128_ps(_mm256_castps128_ps256(lowExponent), highExponent, 1);
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+      }
+
+      static MaskRegister equal(Register a, Register b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+      static MaskRegister notEqual(Register a, Register b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+      static MaskRegister less(Register a, Register b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+      static MaskRegister lessEqual(Register a, Register b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+
+      static MaskRegister maskAnd(MaskRegister a, MaskRegister b) { return _mm256_and_ps(a, b); }
+      static MaskRegister maskOr(MaskRegister a, MaskRegister b) { return _mm256_or_ps(a, b); }
+      static MaskRegister maskXor(MaskRegister a, MaskRegister b) { return _mm256_xor_ps(a, b); }
+      static MaskRegister maskNot(MaskRegister a) { return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+      static std::uint64_t maskBits(MaskRegister a) { return static_cast<std::uint64_t>(_mm256_movemask_ps(a)); }
+
+      static Register select(MaskRegister mask, Register a, Register b) { return _mm256_blendv_ps(b, a, mask); }
+    };
+#endif
+
+#ifdef POIDS_BATCH_AVX512
+    // The zero-masking forms of min, max and sqrt avoid GCC's spurious
+    // maybe-uninitialized warning on _mm512_undefined_pd in the unmasked forms
+    template <>
+    struct BatchKernel<double, 8> {
+      using Register = __m512d;
+      using MaskRegister = __mmask8;
+
+      static Register broadcast(double value) { return _mm512_set1_pd(value); }
+      static Register load(const double* values) { return _mm512_loadu_pd(values); }
+      static void store(double* values, Register a) { _mm512_storeu_pd(values, a); }
+
+      static Register add(Register a, Register b) { return _mm512_add_pd(a, b); }
+      static Register subtract(Register a, Register b) { return _mm512_sub_pd(a, b); }
+      static Register multiply(Register a, Register b) { return _mm512_mul_pd(a, b); }
+      static Register divide(Register a, Register b) { return _mm512_div_pd(a, b); }
+      static Register min(Register a, Register b) { return _mm512_maskz_min_pd(0xFF, a, b); }
+      static Register max(Register a, Register b) { return _mm512_maskz_max_pd(0xFF, a, b); }
+      static Register negate(Register a) {
+        const __m512i sign = _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ull));
+        return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a), sign));
+      }
+      static Register sqrt(Register a) { return _mm512_maskz_sqrt_pd(0xFF, a); }
+      static Register ldexp(Register a, Register n) { return _mm512_maskz_scalef_pd(0xFF, a, n); }
+      static Register frexp(Register a, Register& exponent) {
+        exponent = _mm512_add_pd(_mm512_maskz_getexp_pd(0xFF, a), _mm512_set1_pd(1.0));
+        return _mm512_maskz_getmant_pd(0xFF, a, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+      }
+
+      static MaskRegister equal(Register a, Register b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+      static MaskRegister notEqual(Register a, Register b) { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+      static MaskRegister less(Register a, Register b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+      static MaskRegister lessEqual(Register a, Register b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+
+      static MaskRegister maskAnd(MaskRegister a, MaskRegister b) { return static_cast<MaskRegister>(a & b); }
+      static MaskRegister maskOr(MaskRegister a, MaskRegister b) { return static_cast<MaskRegister>(a | b); }
+      static MaskRegister maskXor(MaskRegister a, MaskRegister b) { return static_cast<MaskRegister>(a ^ b); }
+      static MaskRegister maskNot(MaskRegister a) { return static_cast<MaskRegister>(~a); }
+      static std::uint64_t maskBits(MaskRegister a) { return static_cast<std::uint64_t>(a); }
+
+      static Register select(MaskRegister mask, Register a, Register b) { return _mm512_mask_blend_pd(mask, b, a); }
+    };
+
+    template <>
+    struct BatchKernel<float, 16> {
+      using Register = __m512;
+      using MaskRegister = __mmask16;
+
+      static Register broadcast(float value) { return _mm512_set1_ps(value); }
+      static Register load(const float* values) { return _mm512_loadu_ps(values); }
+      static void store(float* values, Register a) { _mm512_storeu_ps(values, a); }
+
+      static Register add(Register a, Register b) { return _mm512_add_ps(a, b); }
+      static Register subtract(Register a, Register b) { return _mm512_sub_ps(a, b); }
+      static Register multiply(Register a, Register b) { return _mm512_mul_ps(a, b); }
+      static Register divide(Register a, Register b) { return _mm512_div_ps(a, b); }
+      static Register min(Register a, Register b) { return _mm512_maskz_min_ps(0xFFFF, a, b); }
+      static Register max(Register a, Register b) { return _mm512_maskz_max_ps(0xFFFF, a, b); }
+      static Register negate(Register a) {
+        const __m512i sign = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+        return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), sign));
+      }
+      static Register sqrt(Register a) { return _mm512_maskz_sqrt_ps(0xFFFF, a); }
+      static Register ldexp(Register a, Register n) { return _mm512_maskz_scalef_ps(0xFFFF, a, n); }
+      static Register frexp(Register a, Register& exponent) {
+        exponent = _mm512_add_ps(_mm512_maskz_getexp_ps(0xFFFF, a), _mm512_set1_ps(1.0f));
+        return _mm512_maskz_getmant_ps(0xFFFF, a, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+      }
+
+      static MaskRegister equal(Register a, Register b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+      static MaskRegister notEqual(Register a, Register b) { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+      static MaskRegister less(Register a, Register b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+      static MaskRegister lessEqual(Register a, Register b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+
+      static MaskRegister maskAnd(MaskRegister a, MaskRegister b) { return static_cast<MaskRegister>(a & b); }
+      static MaskRegister maskOr(MaskRegister a, MaskRegister b) { return static_cast<MaskRegister>(a | b); }
+      static MaskRegister maskXor(MaskRegister a, MaskRegister b) { return static_cast<MaskRegister>(a ^ b); }
+      static MaskRegister maskNot(MaskRegister a) { return static_cast<MaskRegister>(~a); }
+      static std::uint64_t maskBits(MaskRegister a) { return static_cast<std::uint64_t>(a); }
+
+      static Register select(MaskRegister mask, Register a, Register b) { return _mm512_mask_blend_ps(mask, b, a); }
+    };
+#endif
+
+    /** The number of lanes of T in the widest register of the target */
+    template <typename T>
+    inline constexpr std::size_t NativeLanes_v =
+#if defined(POIDS_BATCH_AVX512)
+        64 / sizeof(T);
+#elif defined(POIDS_BATCH_AVX)
+        32 / sizeof(T);
+#else
+        16 / sizeof(T);
+#endif
+  }  // namespace detail
+
+  template <typename T, std::size_t N>
+  class Batch;
+
+  /** The result of comparing two Batches, holding one boolean per lane.
+   *
+   * \tparam T The scalar type of the compared Batches
+   * \tparam N The number of lanes
+   */
+  template <typename T, std::size_t N>
+  class BatchMask {
+    using Kernel = detail::BatchKernel<T, N>;
+
+   public:
+    using Register = typename Kernel::MaskRegister;
+
+    /** Constructs a mask with every lane false */
+    BatchMask() = default;
+
+    explicit BatchMask(const Register& mask) :
+        mask_(mask) { }
+
+    /** Returns the lanes as bits, with lane i at bit i */
+    std::uint64_t bits() const { return Kernel::maskBits(mask_); }
+
+    /** Indicates if lane i is set */
+    bool operator[](std::size_t i) const {
+      assert(i < N);
+      return (bits() >> i) & 1u;
+    }
+
+    /** Indicates if any lane is set */
+    bool any() const { return bits() != 0; }
+    /** Indicates if every lane is set */
+    bool all() const {
+      if constexpr (N == 64) {
+        return bits() == ~std::uint64_t{0};
+      } else {
+        return bits() == (std::uint64_t{1} << N) - 1;
+      }
+    }
+    /** Indicates if no lane is set */
+    bool none() const { return !any(); }
+
+    /** Accesses the underlying register */
+    const Register& native() const { return mask_; }
+
+   private:
+    Register mask_{};
+
+    friend BatchMask operator&(const BatchMask& lhs, const BatchMask& rhs) {
+      return BatchMask{Kernel::maskAnd(lhs.mask_, rhs.mask_)};
+    }
+
+    friend BatchMask operator|(const BatchMask& lhs, const BatchMask& rhs) {
+      return BatchMask{Kernel::maskOr(lhs.mask_, rhs.mask_)};
+    }
+
+    friend BatchMask operator^(const BatchMask& lhs, const BatchMask& rhs) {
+      return BatchMask{Kernel::maskXor(lhs.mask_, rhs.mask_)};
+    }
+
+    friend BatchMask operator!(const BatchMask& rhs) {
+      return BatchMask{Kernel::maskNot(rhs.mask_)};
+    }
+  };
+
+  /** A fixed-width SIMD vector of N values of T, usable as the Scalar of a Quantity.
+   *
+   * The register is selected at compile-time from the instruction sets enabled for
+   * the target (SSE2, AVX or AVX-512); other combinations of T and N fall back to a
+   * portable implementation. A Quantity<Batch<double, 4>, Unit> is N quantities of
+   * the same unit processed with explicit vector instructions.
+   *
+   * \tparam T The scalar type of each lane
+   * \tparam N The number of lanes
+   */
+  template <typename T, std::size_t N>
+  class Batch {
+    static_assert(std::is_arithmetic_v<T>, "Batch requires an arithmetic lane type");
+    static_assert(N > 0 && N <= 64, "Batch supports between 1 and 64 lanes");
+
+    using Kernel = detail::BatchKernel<T, N>;
+
+   public:
+    using Register = typename Kernel::Register;
+    using Mask = BatchMask<T, N>;
+    using value_type = T;
+
+    /** The number of lanes */
+    static constexpr std::size_t lanes = N;
+
+    /** Constructs a Batch with every lane zero */
+    Batch() = default;
+
+    /** Constructs a Batch with every lane set to value */
+    /*implicit*/ Batch(T value) :
+        register_(Kernel::broadcast(value)) { }
+
+    explicit Batch(const Register& values) :
+        register_(values) { }
+
+    /** Loads N consecutive values, which need not be aligned */
+    static Batch load(const T* values) { return Batch{Kernel::load(values)}; }
+
+    /** Stores the lanes to N consecutive values, which need not be aligned */
+    void store(T* values) const { Kernel::store(values, register_); }
+
+    /** Reads the value of lane i */
+    T operator[](std::size_t i) const {
+      assert(i < N);
+      T values[N];
+      store(values);
+      return values[i];
+    }
+
+    /** Adds all lanes together */
+    T sum() const {
+      T values[N];
+      store(values);
+      T result = values[0];
+      for (std::size_t i = 1; i < N; ++i) {
+        result += values[i];
+      }
+      return result;
+    }
+
+    /** Returns the smallest lane */
+    T min() const {
+      T values[N];
+      store(values);
+      T result = values[0];
+      for (std::size_t i = 1; i < N; ++i) {
+        result = values[i] < result ? values[i] : result;
+      }
+      return result;
+    }
+
+    /** Returns the largest lane */
+    T max() const {
+      T values[N];
+      store(values);
+      T result = values[0];
+      for (std::size_t i = 1; i < N; ++i) {
+        result = values[i] > result ? values[i] : result;
+      }
+      return result;
+    }
+
+    /** Accesses the underlying register */
+    const Register& native() const { return register_; }
+
+    Batch& operator+=(const Batch& rhs) {
+      register_ = Kernel::add(register_, rhs.register_);
+      return *this;
+    }
+
+    Batch& operator-=(const Batch& rhs) {
+      register_ = Kernel::subtract(register_, rhs.register_);
+      return *this;
+    }
+
+    Batch& operator*=(const Batch& rhs) {
+      register_ = Kernel::multiply(register_, rhs.register_);
+      return *this;
+    }
+
+    Batch& operator/=(const Batch& rhs) {
+      register_ = Kernel::divide(register_, rhs.register_);
+      return *this;
+    }
+
+   private:
+    Register register_{};
+
+    friend Batch operator-(const Batch& rhs) { return Batch{Kernel::negate(rhs.register_)}; }
+    friend Batch operator+(const Batch& rhs) { return rhs; }
+
+    friend Batch operator+(const Batch& lhs, const Batch& rhs) { return Batch{Kernel::add(lhs.register_, rhs.register_)}; }
+    friend Batch operator-(const Batch& lhs, const Batch& rhs) { return Batch{Kernel::subtract(lhs.register_, rhs.register_)}; }
+    friend Batch operator*(const Batch& lhs, const Batch& rhs) { return Batch{Kernel::multiply(lhs.register_, rhs.register_)}; }
+    friend Batch operator/(const Batch& lhs, const Batch& rhs) { return Batch{Kernel::divide(lhs.register_, rhs.register_)}; }
+
+    friend Mask operator==(const Batch& lhs, const Batch& rhs) { return Mask{Kernel::equal(lhs.register_, rhs.register_)}; }
+    friend Mask operator!=(const Batch& lhs, const Batch& rhs) { return Mask{Kernel::notEqual(lhs.register_, rhs.register_)}; }
+    friend Mask operator<(const Batch& lhs, const Batch& rhs) { return Mask{Kernel::less(lhs.register_, rhs.register_)}; }
+    friend Mask operator<=(const Batch& lhs, const Batch& rhs) { return Mask{Kernel::lessEqual(lhs.register_, rhs.register_)}; }
+    friend Mask operator>(const Batch& lhs, const Batch& rhs) { return rhs < lhs; }
+    friend Mask operator>=(const Batch& lhs, const Batch& rhs) { return rhs <= lhs; }
+
+    /** Chooses each lane from a where mask is set and from b otherwise */
+    friend Batch select(const Mask& mask, const Batch& a, const Batch& b) {
+      return Batch{Kernel::select(mask.native(), a.register_, b.register_)};
+    }
+
+    /** Lane-wise minimum */
+    friend Batch min(const Batch& a, const Batch& b) { return Batch{Kernel::min(a.register_, b.register_)}; }
+    /** Lane-wise maximum */
+    friend Batch max(const Batch& a, const Batch& b) { return Batch{Kernel::max(a.register_, b.register_)}; }
+    /** Lane-wise square root */
+    friend Batch sqrt(const Batch& x) { return Batch{Kernel::sqrt(x.register_)}; }
+    /** Lane-wise absolute value */
+    friend Batch abs(const Batch& x) { return select(x < Batch{T{}}, -x, x); }
+
+    /** Lane-wise x * 2^n for integral n. Native registers require 2^n to be a normal
+     * value of T, e.g. -1022 <= n <= 1023 for double.
+     */
+    friend Batch ldexp(const Batch& x, const Batch& n) { return Batch{Kernel::ldexp(x.register_, n.register_)}; }
+
+    /** Lane-wise split of x into a mantissa in [0.5, 1), which is returned, and a power
+     * of two stored in exponent. Native registers require normal values of x.
+     */
+    friend Batch frexp(const Batch& x, Batch* exponent) {
+      return Batch{Kernel::frexp(x.register_, exponent->register_)};
+    }
+
+    /** Lane-wise cube root */
+    friend Batch cbrt(const Batch& x) {
+      T values[N];
+      x.store(values);
+      for (std::size_t i = 0; i < N; ++i) {
+        using std::cbrt;
+        values[i] = static_cast<T>(cbrt(values[i]));
+      }
+      return load(values);
+    }
+
+    /** Lane-wise power */
+    friend Batch pow(const Batch& x, double exponent) {
+      T values[N];
+      x.store(values);
+      for (std::size_t i = 0; i < N; ++i) {
+        using std::pow;
+        values[i] = static_cast<T>(pow(values[i], exponent));
+      }
+      return load(values);
+    }
+  };
+
+  /** A Batch of T as wide as the widest register of the target */
+  template <typename T>
+  using NativeBatch = Batch<T, detail::NativeLanes_v<T>>;
+
+  namespace scalar {
+    /** Additional functionality for Quantities of SIMD Batches */
+    template <typename Derived, typename T, std::size_t N>
+    class ScalarMixin<Derived, Batch<T, N>> {
+     private:
+      using LaneQuantity = Quantity<T, UnitOf_t<Derived>, IsBaseUnit_v<Derived>>;
+
+     public:
+      /** The number of lanes */
+      static constexpr std::size_t lanes = N;
+
+      /** Loads N consecutive quantities starting at offset */
+      static Derived load(QuantitySpan<const T, UnitOf_t<Derived>> values, std::size_t offset = 0) {
+        assert(values.isContiguous());
+        assert(offset + N <= values.size());
+        return Derived::makeFromBaseUnitValue(Batch<T, N>::load(values.data() + offset));
+      }
+
+      /** Stores the lanes to N consecutive quantities starting at offset */
+      void store(QuantitySpan<T, UnitOf_t<Derived>> values, std::size_t offset = 0) const {
+        assert(values.isContiguous());
+        assert(offset + N <= values.size());
+        derived()->base().store(values.data() + offset);
+      }
+
+      /** Accesses the value of lane i */
+      LaneQuantity operator[](std::size_t i) const {
+        return LaneQuantity::makeFromBaseUnitValue(derived()->base()[i]);
+      }
+
+      /** Adds all lanes together */
+      LaneQuantity sum() const {
+        return LaneQuantity::makeFromBaseUnitValue(derived()->base().sum());
+      }
+
+      /** Returns the smallest lane */
+      LaneQuantity min() const {
+        return LaneQuantity::makeFromBaseUnitValue(derived()->base().min());
+      }
+
+      /** Returns the largest lane */
+      LaneQuantity max() const {
+        return LaneQuantity::makeFromBaseUnitValue(derived()->base().max());
+      }
+
+     private:
+      Derived* derived() { return static_cast<Derived*>(this); }
+      const Derived* derived() const { return static_cast<const Derived*>(this); }
+    };
+  }  // namespace scalar
+
+  /** Chooses each lane from a where mask is set and from b otherwise */
+  template <typename T, std::size_t N, typename UnitType, bool IsBaseA, bool IsBaseB>
+  Quantity<Batch<T, N>, UnitType> select(const BatchMask<T, N>& mask,
+                                         const Quantity<Batch<T, N>, UnitType, IsBaseA>& a,
+                                         const Quantity<Batch<T, N>, UnitType, IsBaseB>& b) {
+    return Quantity<Batch<T, N>, UnitType>::makeFromBaseUnitValue(select(mask, a.base(), b.base()));
+  }
+}  // namespace poids
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef POIDS_SCALAR_SUPPORT_BATCH_EXPRESSION_HPP
+#define POIDS_SCALAR_SUPPORT_BATCH_EXPRESSION_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "poids/core/array_expression.hpp"
+#include "poids/scalar_support/batch.hpp"
+
+namespace poids::detail {
+  /** The scalar an expression node yields for each element */
+  template <typename Node>
+  using NodeScalar_t = std::decay_t<decltype(std::declval<const Node&>()(std::size_t{}))>;
+
+  /** Whether every terminal of an expression node holds Scalar, so that it can be
+   * loaded a Batch at a time without changing the result
+   */
+  template <typename Scalar, typename Node>
+  struct IsBatchLoadable : public std::false_type { };
+
+  template <typename Scalar>
+  struct IsBatchLoadable<Scalar, ContiguousTerminal<Scalar>> : public std::true_type { };
+
+  template <typename Scalar>
+  struct IsBatchLoadable<Scalar, StridedTerminal<Scalar>> : public std::true_type { };
+
+  template <typename Scalar, typename UnitType>
+  struct IsBatchLoadable<Scalar, OwningTerminal<Scalar, UnitType>> : public std::true_type { };
+
+  template <typename Scalar>
+  struct IsBatchLoadable<Scalar, BroadcastTerminal<Scalar>> : public std::true_type { };
+
+  template <typename Scalar, typename Op, typename Operand>
+  struct IsBatchLoadable<Scalar, UnaryNode<Op, Operand>> : public IsBatchLoadable<Scalar, Operand> { };
+
+  /** A conversion of a loadable operand is loaded by converting N elements at once */
+  template <typename Scalar, typename Operand>
+  struct IsBatchLoadable<Scalar, UnaryNode<ScalarCast<Scalar>, Operand>>
+      : public std::bool_constant<std::is_floating_point_v<NodeScalar_t<Operand>> &&
+                                  IsBatchLoadable<NodeScalar_t<Operand>, Operand>::value> { };
+
+  template <typename Scalar, typename Op, typename Lhs, typename Rhs>
+  struct IsBatchLoadable<Scalar, BinaryNode<Op, Lhs, Rhs>>
+      : public std::bool_constant<IsBatchLoadable<Scalar, Lhs>::value && IsBatchLoadable<Scalar, Rhs>::value> { };
+
+  /** Whether a floating point expression node can be loaded a NativeBatch at a time */
+  template <typename Node>
+  inline constexpr bool IsBatchLoadable_v =
+      std::is_floating_point_v<NodeScalar_t<Node>> && IsBatchLoadable<NodeScalar_t<Node>, Node>::value;
+
+  /** Loads the elements [i, i + N) of an expression node */
+  template <typename Scalar, std::size_t N>
+  Batch<Scalar, N> loadBatch(const ContiguousTerminal<Scalar>& node, std::size_t i) {
+    return Batch<Scalar, N>::load(node.data + i);
+  }
+
+  template <typename Scalar, std::size_t N>
+  Batch<Scalar, N> loadBatch(const StridedTerminal<Scalar>& node, std::size_t i) {
+    Scalar values[N];
+    for (std::size_t k = 0; k < N; ++k) {
+      values[k] = node(i + k);
+    }
+    return Batch<Scalar, N>::load(values);
+  }
+
+  template <typename Scalar, std::size_t N, typename UnitType>
+  Batch<Scalar, N> loadBatch(const OwningTerminal<Scalar, UnitType>& node, std::size_t i) {
+    return Batch<Scalar, N>::load(node.array.data() + i);
+  }
+
+  template <typename Scalar, std::size_t N>
+  Batch<Scalar, N> loadBatch(const BroadcastTerminal<Scalar>& node, std::size_t) {
+    return Batch<Scalar, N>{node.value};
+  }
+
+  template <typename Scalar, std::size_t N, typename Op, typename Operand>
+  Batch<Scalar, N> loadBatch(const UnaryNode<Op, Operand>& node, std::size_t i) {
+    return Op{}(loadBatch<Scalar, N>(node.operand, i));
+  }
+
+  template <typename Scalar, std::size_t N, typename Operand>
+  Batch<Scalar, N> loadBatch(const UnaryNode<ScalarCast<Scalar>, Operand>& node, std::size_t i) {
+    Scalar converted[N];
+    for (std::size_t k = 0; k < N; ++k) {
+      converted[k] = static_cast<Scalar>(node.operand(i + k));
+    }
+    return Batch<Scalar, N>::load(converted);
+  }
+
+  template <typename Scalar, std::size_t N, typename Op, typename Lhs, typename Rhs>
+  Batch<Scalar, N> loadBatch(const BinaryNode<Op, Lhs, Rhs>& node, std::size_t i) {
+    return Op{}(loadBatch<Scalar, N>(node.lhs, i), loadBatch<Scalar, N>(node.rhs, i));
+  }
+}  // namespace poids::detail
+
+#endif
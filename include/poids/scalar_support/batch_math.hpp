@@ -0,0 +1,194 @@
+#ifndef POIDS_SCALAR_SUPPORT_BATCH_MATH_HPP
+#define POIDS_SCALAR_SUPPORT_BATCH_MATH_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "poids/scalar_support/batch.hpp"
+
+namespace poids {
+  namespace detail {
+    /** Adding and subtracting 1.5 * 2^52 rounds a double below 2^51 to the nearest integer */
+    inline constexpr double RoundingShift = 6755399441055744.0;
+
+    /** sin and cos are reduced with a three part pi / 2 up to this magnitude */
+    inline constexpr double SinCosLimit = 1.0e5;
+    inline constexpr double TwoOverPi = 6.36619772367581382433e-01;
+    inline constexpr double PiOverTwo1 = 1.57079632673412561417e+00;
+    inline constexpr double PiOverTwo2 = 6.07710050630396597660e-11;
+    inline constexpr double PiOverTwo3 = 2.02226624879595063154e-21;
+
+    /** exp neither overflows nor becomes subnormal between these bounds */
+    inline constexpr double ExpLower = -708.0;
+    inline constexpr double ExpUpper = 709.0;
+    inline constexpr double InverseLn2 = 1.44269504088896338700e+00;
+    inline constexpr double Ln2High = 6.93147180369123816490e-01;
+    inline constexpr double Ln2Low = 1.90821492927058770002e-10;
+
+    template <std::size_t N>
+    Batch<double, N> roundNearest(const Batch<double, N>& x) {
+      return (x + RoundingShift) - RoundingShift;
+    }
+
+    /** Calls f on every lane of x, for the lanes set in mask */
+    template <typename T, std::size_t N, typename F>
+    Batch<T, N> fixLanes(const BatchMask<T, N>& mask, const Batch<T, N>& x, const Batch<T, N>& result, F f) {
+      if (mask.none()) {
+        return result;
+      }
+      T values[N];
+      T results[N];
+      x.store(values);
+      result.store(results);
+      for (std::size_t i = 0; i < N; ++i) {
+        if (mask[i]) {
+          results[i] = f(values[i]);
+        }
+      }
+      return Batch<T, N>::load(results);
+    }
+
+    /** Calls f on every lane of x */
+    template <typename T, std::size_t N, typename F>
+    Batch<T, N> mapLanes(const Batch<T, N>& x, F f) {
+      T values[N];
+      x.store(values);
+      for (std::size_t i = 0; i < N; ++i) {
+        values[i] = f(values[i]);
+      }
+      return Batch<T, N>::load(values);
+    }
+
+    /** The fdlibm sin and cos kernels, after a Cody-Waite reduction by multiples of pi / 2 */
+    template <std::size_t N>
+    std::pair<Batch<double, N>, Batch<double, N>> sinCosKernel(const Batch<double, N>& x) {
+      using B = Batch<double, N>;
+      const B quadrant = roundNearest(x * TwoOverPi);
+      const B r = ((x - quadrant * PiOverTwo1) - quadrant * PiOverTwo2) - quadrant * PiOverTwo3;
+      const B z = r * r;
+
+      const B sinR = r + r * z * (-1.66666666666666324348e-01 +
+                                  z * (8.33333333332248946124e-03 +
+                                       z * (-1.98412698298579493134e-04 +
+                                            z * (2.75573137070700676789e-06 +
+                                                 z * (-2.50507602534068634195e-08 +
+                                                      z * 1.58969099521155010221e-10)))));
+      const B halfZ = 0.5 * z;
+      const B w = 1.0 - halfZ;
+      const B cosR = w + (((1.0 - w) - halfZ) + z * z * (4.16666666666666019037e-02 +
+                                                         z * (-1.38888888888741095749e-03 +
+                                                              z * (2.48015872894767294178e-05 +
+                                                                   z * (-2.75573143513906633035e-07 +
+                                                                        z * (2.08757232129817482790e-09 +
+                                                                             z * -1.13596475577881948265e-11))))));
+
+      // quadrant mod 4, computed exactly in floating point as floor(q / 4) = round(q / 4 - 3 / 8)
+      const B k = quadrant - 4.0 * roundNearest(quadrant * 0.25 - 0.375);
+      const auto swap = (k == B{1.0}) | (k == B{3.0});
+      const B sinBase = select(swap, cosR, sinR);
+      const B cosBase = select(swap, sinR, cosR);
+      return {select(k >= B{2.0}, -sinBase, sinBase),
+              select((k == B{1.0}) | (k == B{2.0}), -cosBase, cosBase)};
+    }
+
+    /** exp(r) for |r| <= ln(2) / 2 by its Taylor series to degree 13, scaled by 2^n */
+    template <std::size_t N>
+    Batch<double, N> expKernel(const Batch<double, N>& x) {
+      using B = Batch<double, N>;
+      const B clamped = min(max(x, B{ExpLower}), B{ExpUpper});
+      const B n = roundNearest(clamped * InverseLn2);
+      const B r = (clamped - n * Ln2High) - n * Ln2Low;
+
+      B p{1.0 / 6227020800.0};
+      for (double coefficient : {1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0,
+                                 1.0 / 40320.0, 1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0,
+                                 1.0 / 6.0, 0.5, 1.0, 1.0}) {
+        p = p * r + coefficient;
+      }
+      return ldexp(p, n);
+    }
+
+    /** The fdlibm log kernel, after splitting x into 2^e * m with m in [sqrt(2) / 2, sqrt(2)) */
+    template <std::size_t N>
+    Batch<double, N> logKernel(const Batch<double, N>& x) {
+      using B = Batch<double, N>;
+      B e;
+      const B fraction = frexp(x, &e);
+      const auto small = fraction < B{0.70710678118654752440};
+      const B m = select(small, fraction + fraction, fraction);
+      e = select(small, e - 1.0, e);
+      const B f = m - 1.0;
+
+      const B s = f / (2.0 + f);
+      const B z = s * s;
+      const B w = z * z;
+      const B odd = w * (3.999999999940941908e-01 + w * (2.222219843214978396e-01 + w * 1.531383769920937332e-01));
+      const B even = z * (6.666666666666735130e-01 +
+                          w * (2.857142874366239149e-01 + w * (1.818357216161805012e-01 + w * 1.479819860511658591e-01)));
+      const B halfSquare = 0.5 * f * f;
+      return e * Ln2High - ((halfSquare - (s * (halfSquare + (odd + even)) + e * Ln2Low)) - f);
+    }
+  }  // namespace detail
+
+  /** Lane-wise sine and cosine, computed together.
+   *
+   * Double lanes use a vectorized kernel within 3 ulp for |x| <= 1e5, and the C
+   * library beyond. Other lane types call the C library for each lane.
+   */
+  template <typename T, std::size_t N>
+  std::pair<Batch<T, N>, Batch<T, N>> sincos(const Batch<T, N>& x) {
+    if constexpr (std::is_same_v<T, double>) {
+      const auto [sinX, cosX] = detail::sinCosKernel(x);
+      const auto outside = !(abs(x) <= Batch<T, N>{detail::SinCosLimit});
+      return {detail::fixLanes(outside, x, sinX, [](double value) { return std::sin(value); }),
+              detail::fixLanes(outside, x, cosX, [](double value) { return std::cos(value); })};
+    } else {
+      return {detail::mapLanes(x, [](T value) { using std::sin; return static_cast<T>(sin(value)); }),
+              detail::mapLanes(x, [](T value) { using std::cos; return static_cast<T>(cos(value)); })};
+    }
+  }
+
+  /** Lane-wise sine, with the accuracy of sincos */
+  template <typename T, std::size_t N>
+  Batch<T, N> sin(const Batch<T, N>& x) {
+    return sincos(x).first;
+  }
+
+  /** Lane-wise cosine, with the accuracy of sincos */
+  template <typename T, std::size_t N>
+  Batch<T, N> cos(const Batch<T, N>& x) {
+    return sincos(x).second;
+  }
+
+  /** Lane-wise exponential. Double lanes use a vectorized kernel within 2 ulp, and
+   * the C library where the result overflows or is subnormal.
+   */
+  template <typename T, std::size_t N>
+  Batch<T, N> exp(const Batch<T, N>& x) {
+    if constexpr (std::is_same_v<T, double>) {
+      const auto outside = !((x >= Batch<T, N>{detail::ExpLower}) & (x <= Batch<T, N>{detail::ExpUpper}));
+      return detail::fixLanes(outside, x, detail::expKernel(x), [](double value) { return std::exp(value); });
+    } else {
+      return detail::mapLanes(x, [](T value) { using std::exp; return static_cast<T>(exp(value)); });
+    }
+  }
+
+  /** Lane-wise natural logarithm. Double lanes use a vectorized kernel within 2 ulp
+   * for positive normal values, and the C library for every other value.
+   */
+  template <typename T, std::size_t N>
+  Batch<T, N> log(const Batch<T, N>& x) {
+    if constexpr (std::is_same_v<T, double>) {
+      const auto outside = !((x >= Batch<T, N>{std::numeric_limits<double>::min()}) &
+                             (x <= Batch<T, N>{std::numeric_limits<double>::max()}));
+      return detail::fixLanes(outside, x, detail::logKernel(x), [](double value) { return std::log(value); });
+    } else {
+      return detail::mapLanes(x, [](T value) { using std::log; return static_cast<T>(log(value)); });
+    }
+  }
+}  // namespace poids
+
+#endif
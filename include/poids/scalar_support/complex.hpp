@@ -50,6 +50,14 @@ namespace poids::scalar {
     Derived* derived() { return static_cast<Derived*>(this); }
     const Derived* derived() const { return static_cast<const Derived*>(this); }
   };
+
+  /** There is no complex cbrt, so thirds use the principal value of std::pow */
+  template <typename T>
+  struct PowerTraits<std::complex<T>> : public DefaultPowerTraits<std::complex<T>> {
+    static std::complex<T> cubeRoot(const std::complex<T>& x) {
+      return std::pow(x, T{1} / T{3});
+    }
+  };
 }  // namespace poids::scalar
 
 #endif
\ No newline at end of file
@@ -0,0 +1,300 @@
+#ifndef POIDS_SCALAR_SUPPORT_COMPLEX_ARRAY_HPP
+#define POIDS_SCALAR_SUPPORT_COMPLEX_ARRAY_HPP
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/scalar_support/complex.hpp"
+
+namespace poids {
+  /** An array of complex quantities with the real and imaginary parts stored in
+   * separate contiguous lanes.
+   *
+   * Splitting the parts avoids the interleaved loads of std::complex storage, so
+   * bulk complex arithmetic runs as simple vectorizable loops over real Scalars.
+   *
+   * \tparam T The real scalar type of each part
+   * \tparam UnitType The unit type shared by every element
+   */
+  template <typename T, typename UnitType>
+  class QuantityComplexArray {
+    static_assert(IsValidUnit_v<UnitType>, "The given UnitType is not a valid unit");
+
+   public:
+    /** The raw storage of each part. Elements are only zeroed when explicitly requested. */
+    using Lane = std::vector<T, DefaultInitAllocator<T>>;
+
+    /** The unit type of each element */
+    using Unit = UnitType;
+    /** Identity of this QuantityComplexArray */
+    using Type = QuantityComplexArray<T, Unit>;
+
+    using value_type = Quantity<std::complex<T>, Unit>;
+    using size_type = std::size_t;
+
+    QuantityComplexArray() = default;
+
+    /** Constructs an array of count zero-valued elements */
+    explicit QuantityComplexArray(size_type count) :
+        real_(count, T{}), imag_(count, T{}) { }
+
+    /** Constructs an array of count elements without zeroing them.
+     * \warning Every element must be assigned before it is read.
+     */
+    QuantityComplexArray(size_type count, Uninitialized) :
+        real_(count), imag_(count) { }
+
+    /** Constructs an array of count copies of value */
+    template <bool IsBase>
+    QuantityComplexArray(size_type count, const Quantity<std::complex<T>, Unit, IsBase>& value) :
+        real_(count, value.realBase()), imag_(count, value.imagBase()) { }
+
+    QuantityComplexArray(std::initializer_list<value_type> values) {
+      real_.reserve(values.size());
+      imag_.reserve(values.size());
+      for (const auto& value : values) {
+        real_.push_back(value.realBase());
+        imag_.push_back(value.imagBase());
+      }
+    }
+
+    /** Constructs a QuantityComplexArray taking ownership of the given parts in base units. */
+    static Type makeFromBaseUnitValues(Lane real, Lane imag) {
+      assert(real.size() == imag.size());
+      Type result;
+      result.real_ = std::move(real);
+      result.imag_ = std::move(imag);
+      return result;
+    }
+
+    /** Accesses the value of an element */
+    value_type operator[](size_type i) const {
+      assert(i < size());
+      return value_type::makeFromBaseUnitValue(real_[i], imag_[i]);
+    }
+
+    /** Sets the value of an element */
+    template <bool IsBase>
+    void set(size_type i, const Quantity<std::complex<T>, Unit, IsBase>& value) {
+      assert(i < size());
+      real_[i] = value.realBase();
+      imag_[i] = value.imagBase();
+    }
+
+    /** Returns the number of elements in the array */
+    size_type size() const { return real_.size(); }
+    /** Indicates if the array has no elements */
+    bool empty() const { return real_.empty(); }
+    /** Resizes the array, filling any new elements with zero */
+    void resize(size_type count) {
+      real_.resize(count, T{});
+      imag_.resize(count, T{});
+    }
+
+    /** Views the real part of every element in-place */
+    QuantitySpan<T, Unit> real() { return QuantitySpan<T, Unit>::makeFromBaseUnitValues(real_.data(), size()); }
+    /** Views the real part of every element */
+    QuantitySpan<const T, Unit> real() const { return QuantitySpan<const T, Unit>::makeFromBaseUnitValues(real_.data(), size()); }
+    /** Views the imaginary part of every element in-place */
+    QuantitySpan<T, Unit> imag() { return QuantitySpan<T, Unit>::makeFromBaseUnitValues(imag_.data(), size()); }
+    /** Views the imaginary part of every element */
+    QuantitySpan<const T, Unit> imag() const { return QuantitySpan<const T, Unit>::makeFromBaseUnitValues(imag_.data(), size()); }
+
+    /** Calculates the magnitude of every element */
+    QuantityArray<T, Unit> abs() const {
+      const T* re = real_.data();
+      const T* im = imag_.data();
+      QuantityArray<T, Unit> result(size(), uninitialized);
+      T* out = result.data();
+      for (size_type i = 0; i < size(); ++i) {
+        using std::sqrt;
+        out[i] = sqrt(re[i] * re[i] + im[i] * im[i]);
+      }
+      return result;
+    }
+
+    /** Calculates the squared magnitude of every element, like std::norm */
+    QuantityArray<T, typename Unit::template multiply_t<Unit>> norm() const {
+      const T* re = real_.data();
+      const T* im = imag_.data();
+      QuantityArray<T, typename Unit::template multiply_t<Unit>> result(size(), uninitialized);
+      T* out = result.data();
+      for (size_type i = 0; i < size(); ++i) {
+        out[i] = re[i] * re[i] + im[i] * im[i];
+      }
+      return result;
+    }
+
+    /** Returns the complex conjugate of every element */
+    Type conj() const {
+      const T* im = imag_.data();
+      Lane imag(size());
+      T* out = imag.data();
+      for (size_type i = 0; i < size(); ++i) {
+        out[i] = -im[i];
+      }
+      return makeFromBaseUnitValues(real_, std::move(imag));
+    }
+
+    /** Multiplies every element by the complex conjugate of the corresponding element
+     * of other, e.g. the complex power S = V * conj(I)
+     */
+    template <typename UnitTypeRHS>
+    auto multiplyConjugate(const QuantityComplexArray<T, UnitTypeRHS>& other) const {
+      using Result = QuantityComplexArray<T, typename Unit::template multiply_t<UnitTypeRHS>>;
+      assert(size() == other.size());
+      const T* ar = real_.data();
+      const T* ai = imag_.data();
+      const T* br = other.real().data();
+      const T* bi = other.imag().data();
+      Lane real(size());
+      Lane imag(size());
+      T* outReal = real.data();
+      T* outImag = imag.data();
+      for (size_type i = 0; i < size(); ++i) {
+        outReal[i] = ar[i] * br[i] + ai[i] * bi[i];
+        outImag[i] = ai[i] * br[i] - ar[i] * bi[i];
+      }
+      return Result::makeFromBaseUnitValues(std::move(real), std::move(imag));
+    }
+
+    Type& operator+=(const Type& rhs) {
+      assert(size() == rhs.size());
+      for (size_type i = 0; i < size(); ++i) {
+        real_[i] += rhs.real_[i];
+        imag_[i] += rhs.imag_[i];
+      }
+      return *this;
+    }
+
+    Type& operator-=(const Type& rhs) {
+      assert(size() == rhs.size());
+      for (size_type i = 0; i < size(); ++i) {
+        real_[i] -= rhs.real_[i];
+        imag_[i] -= rhs.imag_[i];
+      }
+      return *this;
+    }
+
+   private:
+    Lane real_;
+    Lane imag_;
+
+    friend Type operator-(const Type& rhs) {
+      Lane real(rhs.size());
+      Lane imag(rhs.size());
+      for (size_type i = 0; i < rhs.size(); ++i) {
+        real[i] = -rhs.real_[i];
+        imag[i] = -rhs.imag_[i];
+      }
+      return makeFromBaseUnitValues(std::move(real), std::move(imag));
+    }
+
+    friend Type operator+(const Type& lhs, const Type& rhs) {
+      Type result = lhs;
+      return result += rhs;
+    }
+
+    friend Type operator-(const Type& lhs, const Type& rhs) {
+      Type result = lhs;
+      return result -= rhs;
+    }
+
+    template <typename UnitTypeRHS>
+    friend auto operator*(const Type& lhs, const QuantityComplexArray<T, UnitTypeRHS>& rhs) {
+      using Result = QuantityComplexArray<T, typename Unit::template multiply_t<UnitTypeRHS>>;
+      assert(lhs.size() == rhs.size());
+      const T* ar = lhs.real_.data();
+      const T* ai = lhs.imag_.data();
+      const T* br = rhs.real().data();
+      const T* bi = rhs.imag().data();
+      Lane real(lhs.size());
+      Lane imag(lhs.size());
+      T* outReal = real.data();
+      T* outImag = imag.data();
+      for (size_type i = 0; i < lhs.size(); ++i) {
+        outReal[i] = ar[i] * br[i] - ai[i] * bi[i];
+        outImag[i] = ar[i] * bi[i] + ai[i] * br[i];
+      }
+      return Result::makeFromBaseUnitValues(std::move(real), std::move(imag));
+    }
+
+    template <typename UnitTypeRHS, bool IsBaseRHS>
+    friend auto operator*(const Type& lhs, const Quantity<std::complex<T>, UnitTypeRHS, IsBaseRHS>& rhs) {
+      using Result = QuantityComplexArray<T, typename Unit::template multiply_t<UnitTypeRHS>>;
+      const T br = rhs.realBase();
+      const T bi = rhs.imagBase();
+      Lane real(lhs.size());
+      Lane imag(lhs.size());
+      for (size_type i = 0; i < lhs.size(); ++i) {
+        real[i] = lhs.real_[i] * br - lhs.imag_[i] * bi;
+        imag[i] = lhs.real_[i] * bi + lhs.imag_[i] * br;
+      }
+      return Result::makeFromBaseUnitValues(std::move(real), std::move(imag));
+    }
+
+    template <typename UnitTypeRHS, bool IsBaseRHS>
+    friend auto operator*(const Type& lhs, const Quantity<T, UnitTypeRHS, IsBaseRHS>& rhs) {
+      using Result = QuantityComplexArray<T, typename Unit::template multiply_t<UnitTypeRHS>>;
+      const T scale = rhs.base();
+      Lane real(lhs.size());
+      Lane imag(lhs.size());
+      for (size_type i = 0; i < lhs.size(); ++i) {
+        real[i] = lhs.real_[i] * scale;
+        imag[i] = lhs.imag_[i] * scale;
+      }
+      return Result::makeFromBaseUnitValues(std::move(real), std::move(imag));
+    }
+
+    friend Type operator*(const Type& lhs, const T& rhs) {
+      Lane real(lhs.size());
+      Lane imag(lhs.size());
+      for (size_type i = 0; i < lhs.size(); ++i) {
+        real[i] = lhs.real_[i] * rhs;
+        imag[i] = lhs.imag_[i] * rhs;
+      }
+      return makeFromBaseUnitValues(std::move(real), std::move(imag));
+    }
+
+    friend Type operator*(const T& lhs, const Type& rhs) {
+      return rhs * lhs;
+    }
+  };
+
+  template <typename T, typename UnitType>
+  struct UnitOf<QuantityComplexArray<T, UnitType>> {
+    using type = UnitType;
+  };
+
+  template <typename T, typename UnitType>
+  struct IsQuantityContainer<QuantityComplexArray<T, UnitType>> : public std::true_type { };
+
+  namespace detail {
+    template <typename T>
+    struct RealScalarOf {
+      using type = T;
+    };
+
+    template <typename T>
+    struct RealScalarOf<std::complex<T>> {
+      using type = T;
+    };
+  }  // namespace detail
+
+  /** A split real/imaginary array of complex quantities with the same Unit as
+   * QuantityType. QuantityType may have either a real or a complex Scalar.
+   */
+  template <typename QuantityType>
+  using ComplexArrayOf = QuantityComplexArray<typename detail::RealScalarOf<ScalarOf_t<QuantityType>>::type,
+                                              UnitOf_t<QuantityType>>;
+}  // namespace poids
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef POIDS_SCALAR_SUPPORT_DUAL_HPP
+#define POIDS_SCALAR_SUPPORT_DUAL_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/scalar_support.hpp"
+#include "poids/scalar_support/batch.hpp"
+
+namespace poids {
+  /** A dual number for forward-mode automatic differentiation: a value together with
+   * its derivatives with respect to N independent variables.
+   *
+   * Every operation applies the chain rule to all N derivatives at once. They are
+   * held in a Batch, so that they are updated a SIMD register at a time, and a
+   * Jacobian with N columns costs one evaluation instead of the 2N of central
+   * differences. Comparisons only consider the value, so branches follow the
+   * evaluation that is being differentiated.
+   *
+   * \tparam T The arithmetic type of the value and its derivatives
+   * \tparam N The number of independent variables
+   */
+  template <typename T, std::size_t N>
+  class Dual {
+    static_assert(std::is_floating_point_v<T>, "Dual requires a floating-point T");
+
+   public:
+    using Derivatives = Batch<T, N>;
+    using value_type = T;
+
+    /** The number of independent variables */
+    static constexpr std::size_t variables = N;
+
+    /** Constructs zero */
+    Dual() :
+        value_{},
+        derivatives_{} { }
+
+    /** Constructs a constant, whose derivatives are all zero */
+    /*implicit*/ Dual(T value) :
+        value_(value),
+        derivatives_{} { }
+
+    Dual(T value, const Derivatives& derivatives) :
+        value_(value),
+        derivatives_(derivatives) { }
+
+    /** Constructs independent variable i, whose derivative is one with respect to
+     * itself and zero with respect to all other variables
+     */
+    static Dual variable(T value, std::size_t i) {
+      assert(i < N);
+      T seed[N] = {};
+      seed[i] = T{1};
+      return Dual{value, Derivatives::load(seed)};
+    }
+
+    /** The value */
+    T value() const { return value_; }
+
+    /** The derivative with respect to variable i */
+    T derivative(std::size_t i) const {
+      assert(i < N);
+      return derivatives_[i];
+    }
+
+    /** All derivatives */
+    const Derivatives& derivatives() const { return derivatives_; }
+
+    Dual& operator+=(const Dual& rhs) { return *this = *this + rhs; }
+    Dual& operator-=(const Dual& rhs) { return *this = *this - rhs; }
+    Dual& operator*=(const Dual& rhs) { return *this = *this * rhs; }
+    Dual& operator/=(const Dual& rhs) { return *this = *this / rhs; }
+
+   private:
+    T value_;
+    Derivatives derivatives_;
+
+    /** Applies the chain rule for f(x) with the value fx and derivative dfdx */
+    static Dual chain(const Dual& x, T fx, T dfdx) { return Dual{fx, x.derivatives_ * Derivatives{dfdx}}; }
+
+    friend Dual operator+(const Dual& rhs) { return rhs; }
+    friend Dual operator-(const Dual& rhs) { return Dual{-rhs.value_, -rhs.derivatives_}; }
+
+    friend Dual operator+(const Dual& lhs, const Dual& rhs) {
+      return Dual{lhs.value_ + rhs.value_, lhs.derivatives_ + rhs.derivatives_};
+    }
+
+    friend Dual operator-(const Dual& lhs, const Dual& rhs) {
+      return Dual{lhs.value_ - rhs.value_, lhs.derivatives_ - rhs.derivatives_};
+    }
+
+    friend Dual operator*(const Dual& lhs, const Dual& rhs) {
+      return Dual{lhs.value_ * rhs.value_,
+                  lhs.derivatives_ * Derivatives{rhs.value_} + rhs.derivatives_ * Derivatives{lhs.value_}};
+    }
+
+    friend Dual operator/(const Dual& lhs, const Dual& rhs) {
+      const T quotient = lhs.value_ / rhs.value_;
+      return Dual{quotient, (lhs.derivatives_ - rhs.derivatives_ * Derivatives{quotient}) / Derivatives{rhs.value_}};
+    }
+
+    friend bool operator==(const Dual& lhs, const Dual& rhs) { return lhs.value_ == rhs.value_; }
+    friend bool operator!=(const Dual& lhs, const Dual& rhs) { return lhs.value_ != rhs.value_; }
+    friend bool operator<(const Dual& lhs, const Dual& rhs) { return lhs.value_ < rhs.value_; }
+    friend bool operator<=(const Dual& lhs, const Dual& rhs) { return lhs.value_ <= rhs.value_; }
+    friend bool operator>(const Dual& lhs, const Dual& rhs) { return lhs.value_ > rhs.value_; }
+    friend bool operator>=(const Dual& lhs, const Dual& rhs) { return lhs.value_ >= rhs.value_; }
+
+    friend Dual abs(const Dual& x) { return x.value_ < T{} ? -x : x; }
+
+    friend Dual sqrt(const Dual& x) {
+      const T root = std::sqrt(x.value_);
+      return chain(x, root, T{1} / (T{2} * root));
+    }
+
+    friend Dual cbrt(const Dual& x) {
+      const T root = std::cbrt(x.value_);
+      return chain(x, root, T{1} / (T{3} * root * root));
+    }
+
+    friend Dual pow(const Dual& x, double exponent) {
+      const T power = static_cast<T>(std::pow(x.value_, exponent));
+      return chain(x, power, static_cast<T>(exponent * std::pow(x.value_, exponent - 1.0)));
+    }
+
+    friend Dual exp(const Dual& x) {
+      const T e = std::exp(x.value_);
+      return chain(x, e, e);
+    }
+
+    friend Dual log(const Dual& x) { return chain(x, std::log(x.value_), T{1} / x.value_); }
+    friend Dual sin(const Dual& x) { return chain(x, std::sin(x.value_), std::cos(x.value_)); }
+    friend Dual cos(const Dual& x) { return chain(x, std::cos(x.value_), -std::sin(x.value_)); }
+
+    friend Dual tan(const Dual& x) {
+      const T t = std::tan(x.value_);
+      return chain(x, t, T{1} + t * t);
+    }
+
+    friend Dual atan(const Dual& x) { return chain(x, std::atan(x.value_), T{1} / (T{1} + x.value_ * x.value_)); }
+  };
+
+  namespace scalar {
+    /** Additional functionality for Quantities of dual numbers */
+    template <typename Derived, typename T, std::size_t N>
+    class ScalarMixin<Derived, Dual<T, N>> {
+     private:
+      using Unit = UnitOf_t<Derived>;
+
+     public:
+      /** The value without derivatives */
+      Quantity<T, Unit> primal() const {
+        return Quantity<T, Unit>::makeFromBaseUnitValue(derived()->base().value());
+      }
+
+      /** The derivative with respect to independent variable i, which is a
+       * ParameterQuantity. Its unit is Unit / UnitOf_t<ParameterQuantity>, e.g. a
+       * pressure drop differentiated by a length is in pascal per meter.
+       */
+      template <typename ParameterQuantity>
+      Quantity<T, typename Unit::template divide_t<UnitOf_t<ParameterQuantity>>> derivative(std::size_t i) const {
+        using Result = Quantity<T, typename Unit::template divide_t<UnitOf_t<ParameterQuantity>>>;
+        return Result::makeFromBaseUnitValue(derived()->base().derivative(i));
+      }
+
+     private:
+      Derived* derived() { return static_cast<Derived*>(this); }
+      const Derived* derived() const { return static_cast<const Derived*>(this); }
+    };
+  }  // namespace scalar
+
+  /** Makes x independent variable i of N, e.g. the pipe length to differentiate by */
+  template <std::size_t N, typename T, typename UnitType, bool IsBase>
+  Quantity<Dual<T, N>, UnitType> makeVariable(const Quantity<T, UnitType, IsBase>& x, std::size_t i) {
+    return Quantity<Dual<T, N>, UnitType>::makeFromBaseUnitValue(Dual<T, N>::variable(x.base(), i));
+  }
+
+  /** Makes x a constant with N zero derivatives */
+  template <std::size_t N, typename T, typename UnitType, bool IsBase>
+  Quantity<Dual<T, N>, UnitType> makeConstant(const Quantity<T, UnitType, IsBase>& x) {
+    return Quantity<Dual<T, N>, UnitType>::makeFromBaseUnitValue(Dual<T, N>{x.base()});
+  }
+}  // namespace poids
+
+#endif
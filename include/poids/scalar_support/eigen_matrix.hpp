@@ -0,0 +1,228 @@
+#ifndef POIDS_SCALAR_SUPPORT_EIGEN_MATRIX_HPP
+#define POIDS_SCALAR_SUPPORT_EIGEN_MATRIX_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/traits.hpp"
+
+namespace poids {
+  /** A compile-time list of units, e.g. the unit of every state of a filter */
+  template <typename... UnitTypes>
+  struct UnitList {
+    static constexpr std::size_t size = sizeof...(UnitTypes);
+  };
+
+  template <typename RowUnits, typename ColumnUnits>
+  class QuantityMatrix;
+
+  namespace detail {
+    template <typename List, std::size_t I>
+    struct UnitAt;
+
+    template <typename... UnitTypes, std::size_t I>
+    struct UnitAt<UnitList<UnitTypes...>, I> {
+      using type = std::tuple_element_t<I, std::tuple<UnitTypes...>>;
+    };
+
+    template <typename List, std::size_t I>
+    using UnitAt_t = typename UnitAt<List, I>::type;
+
+    template <typename UnitType>
+    using InverseUnit_t = typename UnitlessOf_t<UnitType>::template divide_t<UnitType>;
+
+    template <typename List>
+    struct InverseUnits;
+
+    template <typename... UnitTypes>
+    struct InverseUnits<UnitList<UnitTypes...>> {
+      using type = UnitList<InverseUnit_t<UnitTypes>...>;
+    };
+
+    /** The reciprocal of every unit of a UnitList */
+    template <typename List>
+    using InverseUnits_t = typename InverseUnits<List>::type;
+
+    template <typename List, typename Factor>
+    struct ScaledUnits;
+
+    template <typename... UnitTypes, typename Factor>
+    struct ScaledUnits<UnitList<UnitTypes...>, Factor> {
+      using type = UnitList<typename UnitTypes::template multiply_t<Factor>...>;
+    };
+
+    /** Every unit of a UnitList multiplied by Factor */
+    template <typename List, typename Factor>
+    using ScaledUnits_t = typename ScaledUnits<List, Factor>::type;
+  }  // namespace detail
+
+  /** A fixed-size matrix whose rows and columns each carry their own unit.
+   *
+   * Element (i, j) has the unit RowUnits[i] / ColumnUnits[j], so the matrix maps a
+   * vector in ColumnUnits to a vector in RowUnits, like the Jacobian of a state
+   * transition. A column vector has a single unitless column, and the covariance of
+   * a vector in units U has the columns 1 / U, see CovarianceMatrix.
+   *
+   * Values are stored in a plain Eigen::Matrix in base units, so arithmetic compiles
+   * to the Eigen kernels, while products, transposes and inverses compute their
+   * units at compile-time. A product requires the columns of the left operand to
+   * match the rows of the right one exactly.
+   *
+   * \tparam RowUnits A UnitList with the unit of every row
+   * \tparam ColumnUnits A UnitList with the unit of every column
+   */
+  template <typename... RowUnitTypes, typename... ColumnUnitTypes>
+  class QuantityMatrix<UnitList<RowUnitTypes...>, UnitList<ColumnUnitTypes...>> {
+    static_assert(sizeof...(RowUnitTypes) > 0 && sizeof...(ColumnUnitTypes) > 0,
+                  "QuantityMatrix requires at least one row and one column");
+    static_assert((IsValidUnit_v<RowUnitTypes> && ...), "Every row unit must be a valid unit");
+    static_assert((IsValidUnit_v<ColumnUnitTypes> && ...), "Every column unit must be a valid unit");
+
+   public:
+    using RowUnits = UnitList<RowUnitTypes...>;
+    using ColumnUnits = UnitList<ColumnUnitTypes...>;
+    /** Identity of this QuantityMatrix */
+    using Type = QuantityMatrix<RowUnits, ColumnUnits>;
+
+    static constexpr int Rows = static_cast<int>(sizeof...(RowUnitTypes));
+    static constexpr int Columns = static_cast<int>(sizeof...(ColumnUnitTypes));
+
+    /** The raw storage of the values, in base units */
+    using Matrix = Eigen::Matrix<double, Rows, Columns>;
+
+    /** The unit of element (I, J) */
+    template <std::size_t I, std::size_t J>
+    using ElementUnit = typename detail::UnitAt_t<RowUnits, I>::template divide_t<detail::UnitAt_t<ColumnUnits, J>>;
+
+    /** Constructs a zero matrix */
+    QuantityMatrix() :
+        values_(Matrix::Zero()) { }
+
+    /** Constructs a column vector from one Quantity per row */
+    explicit QuantityMatrix(const Quantity<double, RowUnitTypes>&... values) :
+        values_{values.base()...} {
+      static_assert(Columns == 1, "Only column vectors can be constructed from their elements");
+      static_assert((IsUnitless_v<ColumnUnitTypes> && ...), "The column of a vector must be unitless");
+    }
+
+    /** Constructs a QuantityMatrix from values in base units */
+    static Type makeFromBaseUnitValues(const Matrix& values) {
+      Type result;
+      result.values_ = values;
+      return result;
+    }
+
+    /** The identity, which only exists when every diagonal element is unitless */
+    static Type identity() {
+      static_assert(std::is_same_v<RowUnits, ColumnUnits>,
+                    "The identity requires the same units for the rows and the columns");
+      return makeFromBaseUnitValues(Matrix::Identity());
+    }
+
+    /** Returns element (I, J). J may be omitted for column vectors. */
+    template <std::size_t I, std::size_t J = 0>
+    Quantity<double, ElementUnit<I, J>> get() const {
+      static_assert(I < Rows && J < Columns, "Element index out of range");
+      return Quantity<double, ElementUnit<I, J>>::makeFromBaseUnitValue(values_(I, J));
+    }
+
+    /** Sets element (I, J). J may be omitted for column vectors. */
+    template <std::size_t I, std::size_t J = 0, bool IsBase>
+    void set(const Quantity<double, ElementUnit<I, J>, IsBase>& value) {
+      static_assert(I < Rows && J < Columns, "Element index out of range");
+      values_(I, J) = value.base();
+    }
+
+    /** Returns the underlying values in base units.
+     * \warning Modifying the value returned from this function can circumvent the guarantees
+     * provided by the library. Use only with great caution.
+     */
+    Matrix& data() { return values_; }
+    const Matrix& data() const { return values_; }
+
+    /** Returns the transpose, whose element (j, i) keeps the unit of element (i, j) */
+    QuantityMatrix<detail::InverseUnits_t<ColumnUnits>, detail::InverseUnits_t<RowUnits>> transpose() const {
+      using Result = QuantityMatrix<detail::InverseUnits_t<ColumnUnits>, detail::InverseUnits_t<RowUnits>>;
+      return Result::makeFromBaseUnitValues(values_.transpose());
+    }
+
+    /** Returns the inverse, which maps vectors in RowUnits back to ColumnUnits */
+    QuantityMatrix<ColumnUnits, RowUnits> inverse() const {
+      static_assert(Rows == Columns, "Only square matrices can be inverted");
+      return QuantityMatrix<ColumnUnits, RowUnits>::makeFromBaseUnitValues(values_.inverse());
+    }
+
+    /** Indicates if this and other are equal within the relative precision of Eigen::isApprox */
+    bool isApprox(const Type& other, double precision = 1.0e-12) const {
+      return values_.isApprox(other.values_, precision);
+    }
+
+    Type& operator+=(const Type& rhs) {
+      values_ += rhs.values_;
+      return *this;
+    }
+
+    Type& operator-=(const Type& rhs) {
+      values_ -= rhs.values_;
+      return *this;
+    }
+
+    Type& operator*=(double rhs) {
+      values_ *= rhs;
+      return *this;
+    }
+
+   private:
+    Matrix values_;
+
+    friend Type operator-(const Type& rhs) { return makeFromBaseUnitValues(-rhs.values_); }
+
+    friend Type operator+(const Type& lhs, const Type& rhs) { return makeFromBaseUnitValues(lhs.values_ + rhs.values_); }
+
+    friend Type operator-(const Type& lhs, const Type& rhs) { return makeFromBaseUnitValues(lhs.values_ - rhs.values_); }
+
+    friend Type operator*(const Type& lhs, double rhs) { return makeFromBaseUnitValues(lhs.values_ * rhs); }
+
+    friend Type operator*(double lhs, const Type& rhs) { return makeFromBaseUnitValues(lhs * rhs.values_); }
+
+    friend Type operator/(const Type& lhs, double rhs) { return makeFromBaseUnitValues(lhs.values_ / rhs); }
+
+    template <typename OtherRowUnits, typename OtherColumnUnits>
+    friend auto operator*(const Type& lhs, const QuantityMatrix<OtherRowUnits, OtherColumnUnits>& rhs) {
+      static_assert(std::is_same_v<ColumnUnits, OtherRowUnits>,
+                    "The column units of the left operand must match the row units of the right operand");
+      return QuantityMatrix<RowUnits, OtherColumnUnits>::makeFromBaseUnitValues(lhs.values_ * rhs.data());
+    }
+
+    template <typename UnitTypeRHS, bool IsBaseRHS>
+    friend auto operator*(const Type& lhs, const Quantity<double, UnitTypeRHS, IsBaseRHS>& rhs) {
+      using Result = QuantityMatrix<detail::ScaledUnits_t<RowUnits, UnitTypeRHS>, ColumnUnits>;
+      return Result::makeFromBaseUnitValues(lhs.values_ * rhs.base());
+    }
+
+    template <typename UnitTypeLHS, bool IsBaseLHS>
+    friend auto operator*(const Quantity<double, UnitTypeLHS, IsBaseLHS>& lhs, const Type& rhs) {
+      using Result = QuantityMatrix<detail::ScaledUnits_t<RowUnits, UnitTypeLHS>, ColumnUnits>;
+      return Result::makeFromBaseUnitValues(lhs.base() * rhs.values_);
+    }
+  };
+
+  template <typename RowUnits, typename ColumnUnits>
+  struct IsQuantityContainer<QuantityMatrix<RowUnits, ColumnUnits>> : public std::true_type { };
+
+  /** A column vector whose elements have the given units */
+  template <typename FirstUnitType, typename... UnitTypes>
+  using QuantityColumn = QuantityMatrix<UnitList<FirstUnitType, UnitTypes...>, UnitList<UnitlessOf_t<FirstUnitType>>>;
+
+  /** The covariance of a vector with the given units, where element (i, j) has the
+   * unit UnitTypes[i] * UnitTypes[j]
+   */
+  template <typename... UnitTypes>
+  using CovarianceMatrix = QuantityMatrix<UnitList<UnitTypes...>, detail::InverseUnits_t<UnitList<UnitTypes...>>>;
+}  // namespace poids
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef POIDS_SCALAR_SUPPORT_EIGEN_VECTOR_HPP
 #define POIDS_SCALAR_SUPPORT_EIGEN_VECTOR_HPP
 
+#include <cmath>
 #include <cstddef>
 #include <Eigen/Core>
 #include <Eigen/Geometry>
@@ -98,6 +99,21 @@ namespace poids {
       Derived* derived() { return static_cast<Derived*>(this); }
       const Derived* derived() const { return static_cast<const Derived*>(this); }
     };
+
+    /** Raises Eigen::Vector<double, N> quantities to a power coefficient-wise */
+    template <int Rows, int Options>
+    struct PowerTraits<Eigen::Matrix<double, Rows, 1, Options, Rows, 1>> {
+      using VectorType = Eigen::Matrix<double, Rows, 1, Options, Rows, 1>;
+
+      static VectorType one(const VectorType& x) { return VectorType::Ones(x.size()); }
+      static VectorType multiply(const VectorType& a, const VectorType& b) { return a.cwiseProduct(b); }
+      static VectorType reciprocal(const VectorType& x) { return x.cwiseInverse(); }
+      static VectorType squareRoot(const VectorType& x) { return x.cwiseSqrt(); }
+      static VectorType cubeRoot(const VectorType& x) {
+        return x.unaryExpr([](double value) { return std::cbrt(value); });
+      }
+      static VectorType power(const VectorType& x, double exponent) { return x.array().pow(exponent).matrix(); }
+    };
   }  // namespace scalar
 
   template <typename QuantityType, int N>
@@ -0,0 +1,417 @@
+#ifndef POIDS_SCALAR_SUPPORT_EIGEN_VECTOR_ARRAY_HPP
+#define POIDS_SCALAR_SUPPORT_EIGEN_VECTOR_ARRAY_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+#include <Eigen/Core>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/scalar_support/eigen_vector.hpp"
+
+namespace poids {
+  /** A structure-of-arrays collection of Vector quantities which all share one unit.
+   *
+   * Each component is stored in its own contiguous lane, so per-component kernels
+   * like dot, cross and norm run as vectorized loops over every element at once.
+   * The bulk operations mirror those on a single poids::Vector.
+   *
+   * \tparam UnitType The unit type shared by every element
+   * \tparam N The number of components of each Vector
+   */
+  template <typename UnitType, int N>
+  class QuantityVectorArray {
+    static_assert(N > 0, "QuantityVectorArray requires at least one component");
+    static_assert(IsValidUnit_v<UnitType>, "The given UnitType is not a valid unit");
+
+   public:
+    /** The raw storage, one column per component */
+    using Lanes = Eigen::Matrix<double, Eigen::Dynamic, N, Eigen::ColMajor>;
+    /** The unit type of each element */
+    using Unit = UnitType;
+    /** Identity of this QuantityVectorArray */
+    using Type = QuantityVectorArray<Unit, N>;
+
+    using value_type = Quantity<Eigen::Vector<double, N>, Unit>;
+    using component_type = Quantity<double, Unit>;
+    using size_type = std::size_t;
+
+    QuantityVectorArray() = default;
+
+    /** Constructs an array of count zero-valued vectors */
+    explicit QuantityVectorArray(size_type count) :
+        lanes_(Lanes::Zero(static_cast<Eigen::Index>(count), N)) { }
+
+    /** Constructs an array of count vectors without zeroing them.
+     * \warning Every element must be assigned before it is read.
+     */
+    QuantityVectorArray(size_type count, Uninitialized) :
+        lanes_(static_cast<Eigen::Index>(count), N) { }
+
+    /** Constructs an array of count copies of value */
+    template <bool IsBase>
+    QuantityVectorArray(size_type count, const Quantity<Eigen::Vector<double, N>, Unit, IsBase>& value) :
+        lanes_(value.base().transpose().replicate(static_cast<Eigen::Index>(count), 1)) { }
+
+    QuantityVectorArray(std::initializer_list<value_type> values) :
+        lanes_(static_cast<Eigen::Index>(values.size()), N) {
+      Eigen::Index row = 0;
+      for (const auto& value : values) {
+        lanes_.row(row++) = value.base().transpose();
+      }
+    }
+
+    /** Constructs a QuantityVectorArray taking ownership of the given components in base units. */
+    static Type makeFromBaseUnitValues(Lanes lanes) {
+      Type result;
+      result.lanes_ = std::move(lanes);
+      return result;
+    }
+
+    /** Accesses the value of an element */
+    value_type operator[](size_type i) const {
+      assert(i < size());
+      return value_type::makeFromBaseUnitValue(lanes_.row(static_cast<Eigen::Index>(i)).transpose());
+    }
+
+    /** Sets the value of an element */
+    template <bool IsBase>
+    void set(size_type i, const Quantity<Eigen::Vector<double, N>, Unit, IsBase>& value) {
+      assert(i < size());
+      lanes_.row(static_cast<Eigen::Index>(i)) = value.base().transpose();
+    }
+
+    /** Returns the number of vectors in the array */
+    size_type size() const { return static_cast<size_type>(lanes_.rows()); }
+    /** Indicates if the array has no elements */
+    bool empty() const { return lanes_.rows() == 0; }
+    /** Resizes the array, discarding its contents */
+    void resize(size_type count) { lanes_.resize(static_cast<Eigen::Index>(count), N); }
+
+    /** Views the k-th component of every vector in-place */
+    QuantitySpan<double, Unit> component(int k) {
+      assert(0 <= k && k < N);
+      return QuantitySpan<double, Unit>::makeFromBaseUnitValues(lanes_.col(k).data(), size());
+    }
+    /** Views the k-th component of every vector */
+    QuantitySpan<const double, Unit> component(int k) const {
+      assert(0 <= k && k < N);
+      return QuantitySpan<const double, Unit>::makeFromBaseUnitValues(lanes_.col(k).data(), size());
+    }
+
+    QuantitySpan<double, Unit> x() { return component(0); }
+    QuantitySpan<const double, Unit> x() const { return component(0); }
+    QuantitySpan<double, Unit> y() { return component(1); }
+    QuantitySpan<const double, Unit> y() const { return component(1); }
+    QuantitySpan<double, Unit> z() { return component(2); }
+    QuantitySpan<const double, Unit> z() const { return component(2); }
+    QuantitySpan<double, Unit> w() { return component(3); }
+    QuantitySpan<const double, Unit> w() const { return component(3); }
+
+    /** Returns the underlying components in base units, one column per component.
+     * \warning Modifying the value returned from this function can circumvent the guarantees
+     * provided by the library. Use only with great caution.
+     */
+    Lanes& data() { return lanes_; }
+    const Lanes& data() const { return lanes_; }
+
+    /** Calculates the euclidean norm of every vector. */
+    QuantityArray<double, Unit> norm() const {
+      auto result = QuantityArray<double, Unit>(size(), uninitialized);
+      mapOf(result) = squaredNorms().cwiseSqrt();
+      return result;
+    }
+
+    /** Returns the unit vectors corresponding to every vector. */
+    Type normalized() const {
+      Type result = *this;
+      result.normalize();
+      return result;
+    }
+
+    /** Normalizes every vector in-place. As for a single vector, zero vectors are left unchanged. */
+    void normalize() {
+      const Eigen::ArrayXd squared = squaredNorms().array();
+      const Eigen::ArrayXd inverseNorms = (squared > 0.0).select(squared.rsqrt(), 1.0);
+      for (int k = 0; k < N; ++k) {
+        lanes_.col(k).array() *= inverseNorms;
+      }
+    }
+
+    /** Calculates the dot product of every vector with the corresponding vector in other. */
+    template <typename UnitTypeRHS>
+    QuantityArray<double, typename Unit::template multiply_t<UnitTypeRHS>>
+    dot(const QuantityVectorArray<UnitTypeRHS, N>& other) const {
+      assert(size() == other.size());
+      auto result = QuantityArray<double, typename Unit::template multiply_t<UnitTypeRHS>>(size(), uninitialized);
+      auto out = mapOf(result);
+      out = lanes_.col(0).cwiseProduct(other.data().col(0));
+      for (int k = 1; k < N; ++k) {
+        out += lanes_.col(k).cwiseProduct(other.data().col(k));
+      }
+      return result;
+    }
+
+    /** Calculates the cross product of every vector with the corresponding vector in other.
+     * \note Requires that both this and other have length 3
+     */
+    template <typename UnitTypeRHS>
+    QuantityVectorArray<typename Unit::template multiply_t<UnitTypeRHS>, 3>
+    cross(const QuantityVectorArray<UnitTypeRHS, N>& other) const {
+      static_assert(N == 3, "Cross-product is only defined on vectors of length 3");
+      assert(size() == other.size());
+      QuantityVectorArray<typename Unit::template multiply_t<UnitTypeRHS>, 3> result(size(), uninitialized);
+      const double* ax = lanes_.col(0).data();
+      const double* ay = lanes_.col(1).data();
+      const double* az = lanes_.col(2).data();
+      const double* bx = other.data().col(0).data();
+      const double* by = other.data().col(1).data();
+      const double* bz = other.data().col(2).data();
+      double* outX = result.data().col(0).data();
+      double* outY = result.data().col(1).data();
+      double* outZ = result.data().col(2).data();
+      for (size_type i = 0; i < size(); ++i) {
+        outX[i] = ay[i] * bz[i] - az[i] * by[i];
+        outY[i] = az[i] * bx[i] - ax[i] * bz[i];
+        outZ[i] = ax[i] * by[i] - ay[i] * bx[i];
+      }
+      return result;
+    }
+
+    /** Applies a unitless linear map, such as a rotation matrix, to every vector. */
+    Type rotated(const Eigen::Matrix<double, N, N>& rotation) const {
+      Type result(size(), uninitialized);
+      affineInto(rotation, Eigen::Vector<double, N>::Zero(), result.lanes_);
+      return result;
+    }
+
+    /** Applies a unitless linear map to every vector in-place. */
+    void rotate(const Eigen::Matrix<double, N, N>& rotation) {
+      affineInto(rotation, Eigen::Vector<double, N>::Zero(), lanes_);
+    }
+
+    /** Rotates every vector, then adds translation to it, e.g. to move a point cloud
+     * into another frame. The translation has the unit of the elements.
+     */
+    template <bool IsBase>
+    Type transformed(const Eigen::Matrix<double, N, N>& rotation,
+                     const Quantity<Eigen::Vector<double, N>, Unit, IsBase>& translation) const {
+      Type result(size(), uninitialized);
+      affineInto(rotation, translation.base(), result.lanes_);
+      return result;
+    }
+
+    /** Rotates and translates every vector in-place. */
+    template <bool IsBase>
+    void transform(const Eigen::Matrix<double, N, N>& rotation,
+                   const Quantity<Eigen::Vector<double, N>, Unit, IsBase>& translation) {
+      affineInto(rotation, translation.base(), lanes_);
+    }
+
+    /** Calculates the distance between every vector and the corresponding vector in other. */
+    QuantityArray<double, Unit> distance(const Type& other) const {
+      assert(size() == other.size());
+      auto result = QuantityArray<double, Unit>(size(), uninitialized);
+      auto out = mapOf(result);
+      out = (lanes_.col(0) - other.lanes_.col(0)).cwiseAbs2();
+      for (int k = 1; k < N; ++k) {
+        out += (lanes_.col(k) - other.lanes_.col(k)).cwiseAbs2();
+      }
+      out = out.cwiseSqrt();
+      return result;
+    }
+
+    Type& operator+=(const Type& rhs) {
+      assert(size() == rhs.size());
+      lanes_ += rhs.lanes_;
+      return *this;
+    }
+
+    Type& operator-=(const Type& rhs) {
+      assert(size() == rhs.size());
+      lanes_ -= rhs.lanes_;
+      return *this;
+    }
+
+    Type& operator*=(double rhs) {
+      lanes_ *= rhs;
+      return *this;
+    }
+
+    Type& operator/=(double rhs) {
+      lanes_ /= rhs;
+      return *this;
+    }
+
+   private:
+    Lanes lanes_;
+
+    /** Writes rotation * v + translation for every vector v to out, which may be lanes_.
+     * Every component of an element is read before any is written, so the loop
+     * streams through each column once.
+     */
+    void affineInto(const Eigen::Matrix<double, N, N>& rotation, const Eigen::Vector<double, N>& translation,
+                    Lanes& out) const {
+      const double* in[N];
+      double* result[N];
+      for (int k = 0; k < N; ++k) {
+        in[k] = lanes_.col(k).data();
+        result[k] = out.col(k).data();
+      }
+      for (size_type i = 0; i < size(); ++i) {
+        double v[N];
+        for (int j = 0; j < N; ++j) {
+          v[j] = in[j][i];
+        }
+        for (int k = 0; k < N; ++k) {
+          double accumulator = translation[k];
+          for (int j = 0; j < N; ++j) {
+            accumulator += rotation(k, j) * v[j];
+          }
+          result[k][i] = accumulator;
+        }
+      }
+    }
+
+    Eigen::VectorXd squaredNorms() const {
+      Eigen::VectorXd result = lanes_.col(0).cwiseAbs2();
+      for (int k = 1; k < N; ++k) {
+        result += lanes_.col(k).cwiseAbs2();
+      }
+      return result;
+    }
+
+    template <typename UnitTypeOther>
+    static Eigen::Map<Eigen::VectorXd> mapOf(QuantityArray<double, UnitTypeOther>& array) {
+      return Eigen::Map<Eigen::VectorXd>(array.data(), static_cast<Eigen::Index>(array.size()));
+    }
+
+    friend Type operator-(const Type& rhs) {
+      return makeFromBaseUnitValues(-rhs.lanes_);
+    }
+
+    friend Type operator+(const Type& lhs, const Type& rhs) {
+      assert(lhs.size() == rhs.size());
+      return makeFromBaseUnitValues(lhs.lanes_ + rhs.lanes_);
+    }
+
+    friend Type operator-(const Type& lhs, const Type& rhs) {
+      assert(lhs.size() == rhs.size());
+      return makeFromBaseUnitValues(lhs.lanes_ - rhs.lanes_);
+    }
+
+    friend Type operator*(const Type& lhs, double rhs) {
+      return makeFromBaseUnitValues(lhs.lanes_ * rhs);
+    }
+
+    friend Type operator*(double lhs, const Type& rhs) {
+      return makeFromBaseUnitValues(lhs * rhs.lanes_);
+    }
+
+    friend Type operator/(const Type& lhs, double rhs) {
+      return makeFromBaseUnitValues(lhs.lanes_ / rhs);
+    }
+
+    template <typename UnitTypeRHS, bool IsBaseRHS>
+    friend auto operator*(const Type& lhs, const Quantity<double, UnitTypeRHS, IsBaseRHS>& rhs) {
+      using Result = QuantityVectorArray<typename Unit::template multiply_t<UnitTypeRHS>, N>;
+      return Result::makeFromBaseUnitValues(lhs.lanes_ * rhs.base());
+    }
+
+    template <typename UnitTypeLHS, bool IsBaseLHS>
+    friend auto operator*(const Quantity<double, UnitTypeLHS, IsBaseLHS>& lhs, const Type& rhs) {
+      using Result = QuantityVectorArray<typename UnitTypeLHS::template multiply_t<Unit>, N>;
+      return Result::makeFromBaseUnitValues(lhs.base() * rhs.lanes_);
+    }
+
+    template <typename UnitTypeRHS, bool IsBaseRHS>
+    friend auto operator/(const Type& lhs, const Quantity<double, UnitTypeRHS, IsBaseRHS>& rhs) {
+      using Result = QuantityVectorArray<typename Unit::template divide_t<UnitTypeRHS>, N>;
+      return Result::makeFromBaseUnitValues(lhs.lanes_ / rhs.base());
+    }
+
+    /** Scales every vector by the corresponding element of rhs */
+    template <typename UnitTypeRHS>
+    friend auto operator*(const Type& lhs, const QuantityArray<double, UnitTypeRHS>& rhs) {
+      assert(lhs.size() == rhs.size());
+      using Result = QuantityVectorArray<typename Unit::template multiply_t<UnitTypeRHS>, N>;
+      const Eigen::Map<const Eigen::VectorXd> scale(rhs.data(), static_cast<Eigen::Index>(rhs.size()));
+      return Result::makeFromBaseUnitValues(scale.asDiagonal() * lhs.lanes_);
+    }
+
+    template <typename UnitTypeLHS>
+    friend auto operator*(const QuantityArray<double, UnitTypeLHS>& lhs, const Type& rhs) {
+      assert(lhs.size() == rhs.size());
+      using Result = QuantityVectorArray<typename UnitTypeLHS::template multiply_t<Unit>, N>;
+      const Eigen::Map<const Eigen::VectorXd> scale(lhs.data(), static_cast<Eigen::Index>(lhs.size()));
+      return Result::makeFromBaseUnitValues(scale.asDiagonal() * rhs.lanes_);
+    }
+  };
+
+  template <typename UnitType, int N>
+  struct UnitOf<QuantityVectorArray<UnitType, N>> {
+    using type = UnitType;
+  };
+
+  template <typename UnitType, int N>
+  struct IsQuantityContainer<QuantityVectorArray<UnitType, N>> : public std::true_type { };
+
+  namespace detail {
+    /** The number of vectors of the second array kept in L1 cache by pairwiseDistances */
+    inline constexpr std::size_t DistanceBlock = 256;
+  }  // namespace detail
+
+  /** Calculates the distance from every vector of lhs to every vector of rhs, as a
+   * row-major lhs.size() by rhs.size() matrix: element i * rhs.size() + j is the
+   * distance from lhs[i] to rhs[j]. rhs is processed in blocks which stay in cache
+   * while every vector of lhs is compared with them.
+   */
+  template <typename UnitType, int N>
+  QuantityArray<double, UnitType> pairwiseDistances(const QuantityVectorArray<UnitType, N>& lhs,
+                                                    const QuantityVectorArray<UnitType, N>& rhs) {
+    const std::size_t rows = lhs.size();
+    const std::size_t columns = rhs.size();
+    QuantityArray<double, UnitType> result(rows * columns, uninitialized);
+    double* out = result.data();
+    const double* a[N];
+    const double* b[N];
+    for (int k = 0; k < N; ++k) {
+      a[k] = lhs.data().col(k).data();
+      b[k] = rhs.data().col(k).data();
+    }
+
+    for (std::size_t first = 0; first < columns; first += detail::DistanceBlock) {
+      const std::size_t last = std::min(columns, first + detail::DistanceBlock);
+      for (std::size_t i = 0; i < rows; ++i) {
+        double point[N];
+        for (int k = 0; k < N; ++k) {
+          point[k] = a[k][i];
+        }
+        double* row = out + i * columns;
+        for (std::size_t j = first; j < last; ++j) {
+          double squared = 0.0;
+          for (int k = 0; k < N; ++k) {
+            const double difference = b[k][j] - point[k];
+            squared += difference * difference;
+          }
+          row[j] = squared;
+        }
+        // Eigen's packet sqrt vectorizes, unlike std::sqrt when errno must be set
+        Eigen::Map<Eigen::ArrayXd> distances(row + first, static_cast<Eigen::Index>(last - first));
+        distances = distances.sqrt();
+      }
+    }
+    return result;
+  }
+
+  /** A structure-of-arrays collection of poids::Vector<QuantityType, N> */
+  template <typename QuantityType, int N>
+  using VectorArray = QuantityVectorArray<UnitOf_t<QuantityType>, N>;
+}  // namespace poids
+
+#endif
@@ -0,0 +1,310 @@
+#ifndef POIDS_SCALAR_SUPPORT_FIXED_POINT_HPP
+#define POIDS_SCALAR_SUPPORT_FIXED_POINT_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/scalar_support.hpp"
+
+namespace poids {
+  /** Overflow policy of FixedPoint which clamps every result to the representable range */
+  struct Saturate { };
+  /** Overflow policy of FixedPoint which wraps every result modulo 2^bits, as in two's complement */
+  struct Wrap { };
+
+  namespace detail {
+    /** A signed integer wide enough to hold the product of two IntegerTypes */
+    template <typename IntegerType>
+    struct WideInteger;
+
+    template <>
+    struct WideInteger<std::int8_t> {
+      using type = std::int16_t;
+    };
+
+    template <>
+    struct WideInteger<std::int16_t> {
+      using type = std::int32_t;
+    };
+
+    template <>
+    struct WideInteger<std::int32_t> {
+      using type = std::int64_t;
+    };
+
+#if defined(__SIZEOF_INT128__)
+    template <>
+    struct WideInteger<std::int64_t> {
+      __extension__ typedef __int128 type;
+    };
+#endif
+
+    template <typename IntegerType>
+    using WideInteger_t = typename WideInteger<IntegerType>::type;
+
+    /** Brings an exact intermediate result back into IntegerType. Saturation compiles to
+     * a pair of conditional moves or a vector min/max, and wrapping to a truncation, so
+     * neither branches.
+     */
+    template <typename OverflowPolicy, typename IntegerType, typename WideType>
+    constexpr IntegerType narrow(WideType value) {
+      if constexpr (std::is_same_v<OverflowPolicy, Saturate>) {
+        constexpr WideType lowest = std::numeric_limits<IntegerType>::lowest();
+        constexpr WideType highest = std::numeric_limits<IntegerType>::max();
+        value = value < lowest ? lowest : value;
+        value = value > highest ? highest : value;
+        return static_cast<IntegerType>(value);
+      } else {
+        return static_cast<IntegerType>(static_cast<std::make_unsigned_t<IntegerType>>(value));
+      }
+    }
+  }  // namespace detail
+
+  /** A signed binary fixed-point number, i.e. an integer counting steps of 2^-FractionalBits.
+   *
+   * All arithmetic between fixed-point values runs on integers with a result which is
+   * identical on every platform: sums are exact, products are rounded to the nearest
+   * step and quotients are truncated towards zero. A result outside the range of
+   * IntegerType is saturated or wrapped as given by OverflowPolicy, both without
+   * branches so that loops over arrays of FixedPoint vectorize.
+   *
+   * Arithmetic with integers is exact, while arithmetic with floating-point values
+   * goes through double and is meant for conversions at the boundaries, e.g. for
+   * Quantity::as or for multiplying with the floating-point unit constants.
+   *
+   * \tparam IntegerType The signed integer holding the value
+   * \tparam FractionalBits The number of bits after the binary point
+   * \tparam OverflowPolicy Either Saturate or Wrap
+   */
+  template <typename IntegerType, int FractionalBits, typename OverflowPolicy = Saturate>
+  class FixedPoint {
+    static_assert(std::is_integral_v<IntegerType> && std::is_signed_v<IntegerType>,
+                  "FixedPoint requires a signed IntegerType");
+    static_assert(FractionalBits >= 0 && FractionalBits < std::numeric_limits<IntegerType>::digits,
+                  "FixedPoint requires at least one integer bit besides the sign");
+    static_assert(std::is_same_v<OverflowPolicy, Saturate> || std::is_same_v<OverflowPolicy, Wrap>,
+                  "The OverflowPolicy of FixedPoint must be poids::Saturate or poids::Wrap");
+
+    using Wide = detail::WideInteger_t<IntegerType>;
+
+    static constexpr Wide one = Wide{1} << FractionalBits;
+
+   public:
+    using Integer = IntegerType;
+    using Policy = OverflowPolicy;
+    static constexpr int fractionalBits = FractionalBits;
+
+    /** Constructs zero */
+    constexpr FixedPoint() :
+        raw_{} { }
+
+    /** Converts an integer exactly, if it is in range */
+    template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+    constexpr explicit FixedPoint(T value) :
+        raw_(fromWide(static_cast<Wide>(fromInteger(value)) * one)) { }
+
+    /** Converts a floating-point value to the nearest step. Out of range values
+     * saturate regardless of the policy and NaN becomes zero.
+     */
+    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    constexpr explicit FixedPoint(T value) :
+        raw_(fromFloating(static_cast<double>(value))) { }
+
+    /** Constructs a FixedPoint from its integer representation */
+    static constexpr FixedPoint fromRaw(Integer raw) {
+      FixedPoint result;
+      result.raw_ = raw;
+      return result;
+    }
+
+    /** The integer representation, i.e. the value in steps of 2^-FractionalBits */
+    constexpr Integer raw() const { return raw_; }
+
+    /** Converts to the nearest floating-point value */
+    template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+    constexpr explicit operator T() const {
+      return static_cast<T>(raw_) * (T{1} / static_cast<T>(one));
+    }
+
+    constexpr FixedPoint& operator+=(const FixedPoint& rhs) { return *this = *this + rhs; }
+    constexpr FixedPoint& operator-=(const FixedPoint& rhs) { return *this = *this - rhs; }
+    constexpr FixedPoint& operator*=(const FixedPoint& rhs) { return *this = *this * rhs; }
+    constexpr FixedPoint& operator/=(const FixedPoint& rhs) { return *this = *this / rhs; }
+
+   private:
+    Integer raw_;
+
+    static constexpr Integer fromWide(Wide value) { return detail::narrow<Policy, Integer>(value); }
+
+    template <typename T>
+    static constexpr Integer fromInteger(T value) {
+      if constexpr (std::is_unsigned_v<T>) {
+        using Unsigned = std::make_unsigned_t<Integer>;
+        constexpr auto highest = static_cast<Unsigned>(std::numeric_limits<Integer>::max());
+        if constexpr (std::is_same_v<Policy, Saturate>) {
+          value = value > highest ? static_cast<T>(highest) : value;
+        }
+        return static_cast<Integer>(static_cast<Unsigned>(value));
+      } else {
+        return detail::narrow<Policy, Integer>(static_cast<std::intmax_t>(value));
+      }
+    }
+
+    static constexpr Integer fromFloating(double value) {
+      constexpr double limit = static_cast<double>(Wide{1} << std::numeric_limits<Integer>::digits);
+      const double scaled = value * static_cast<double>(one);
+      const double rounded = scaled < 0.0 ? scaled - 0.5 : scaled + 0.5;
+      if (!(rounded == rounded)) {
+        return Integer{0};
+      }
+      if (rounded >= limit) {
+        return std::numeric_limits<Integer>::max();
+      }
+      if (rounded <= -limit - 1.0) {
+        return std::numeric_limits<Integer>::lowest();
+      }
+      return static_cast<Integer>(rounded);
+    }
+
+    friend constexpr FixedPoint operator+(const FixedPoint& rhs) { return rhs; }
+
+    friend constexpr FixedPoint operator-(const FixedPoint& rhs) {
+      return fromRaw(fromWide(-static_cast<Wide>(rhs.raw_)));
+    }
+
+    friend constexpr FixedPoint operator+(const FixedPoint& lhs, const FixedPoint& rhs) {
+      return fromRaw(fromWide(static_cast<Wide>(lhs.raw_) + static_cast<Wide>(rhs.raw_)));
+    }
+
+    friend constexpr FixedPoint operator-(const FixedPoint& lhs, const FixedPoint& rhs) {
+      return fromRaw(fromWide(static_cast<Wide>(lhs.raw_) - static_cast<Wide>(rhs.raw_)));
+    }
+
+    /** The exact product, rounded half up to the nearest step */
+    friend constexpr FixedPoint operator*(const FixedPoint& lhs, const FixedPoint& rhs) {
+      Wide product = static_cast<Wide>(lhs.raw_) * static_cast<Wide>(rhs.raw_);
+      if constexpr (FractionalBits > 0) {
+        product = (product + (one >> 1)) >> FractionalBits;
+      }
+      return fromRaw(fromWide(product));
+    }
+
+    /** The quotient truncated towards zero. The divisor must not be zero. */
+    friend constexpr FixedPoint operator/(const FixedPoint& lhs, const FixedPoint& rhs) {
+      assert(rhs.raw_ != 0);
+      return fromRaw(fromWide(static_cast<Wide>(lhs.raw_) * one / static_cast<Wide>(rhs.raw_)));
+    }
+
+    /** Whether an integer is representable in Target, which is Integer or Wide */
+    template <typename Target, typename T>
+    static constexpr bool fits(T value) {
+      if constexpr (sizeof(T) < sizeof(Target)) {
+        return true;
+      } else if constexpr (std::is_unsigned_v<T>) {
+        return value <= static_cast<std::uintmax_t>(std::numeric_limits<Target>::max());
+      } else {
+        return value >= static_cast<std::intmax_t>(std::numeric_limits<Target>::lowest()) &&
+               value <= static_cast<std::intmax_t>(std::numeric_limits<Target>::max());
+      }
+    }
+
+    // Integers scale the raw value directly, so that neither the operand nor the
+    // result is limited to the range of a FixedPoint before the final narrowing,
+    // while floating-point operands go through double
+
+    /** The exact product, narrowed by the policy. An integer beyond the range of
+     * IntegerType overflows any non-zero product, which then saturates on the sign
+     * of the product. Wrapping only depends on the integer modulo 2^bits, so it is
+     * wrapped into IntegerType first.
+     */
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    friend constexpr FixedPoint operator*(const FixedPoint& lhs, T rhs) {
+      if constexpr (std::is_integral_v<T>) {
+        if constexpr (std::is_same_v<Policy, Saturate>) {
+          if (!fits<Integer>(rhs)) {
+            const bool negative = (lhs.raw_ < 0) != (rhs < T{0});
+            return lhs.raw_ == 0 ? FixedPoint{}
+                   : negative    ? fromRaw(std::numeric_limits<Integer>::lowest())
+                                 : fromRaw(std::numeric_limits<Integer>::max());
+          }
+        }
+        return fromRaw(fromWide(static_cast<Wide>(lhs.raw_) * static_cast<Wide>(fromInteger(rhs))));
+      } else {
+        return FixedPoint{static_cast<double>(lhs) * static_cast<double>(rhs)};
+      }
+    }
+
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    friend constexpr FixedPoint operator*(T lhs, const FixedPoint& rhs) {
+      return rhs * lhs;
+    }
+
+    /** The quotient truncated towards zero. The divisor must not be zero. */
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    friend constexpr FixedPoint operator/(const FixedPoint& lhs, T rhs) {
+      if constexpr (std::is_integral_v<T>) {
+        assert(rhs != 0);
+        if (!fits<Wide>(rhs)) {
+          return FixedPoint{};
+        }
+        return fromRaw(fromWide(static_cast<Wide>(lhs.raw_) / static_cast<Wide>(rhs)));
+      } else {
+        return FixedPoint{static_cast<double>(lhs) / static_cast<double>(rhs)};
+      }
+    }
+
+    friend constexpr bool operator==(const FixedPoint& lhs, const FixedPoint& rhs) { return lhs.raw_ == rhs.raw_; }
+    friend constexpr bool operator!=(const FixedPoint& lhs, const FixedPoint& rhs) { return lhs.raw_ != rhs.raw_; }
+    friend constexpr bool operator<(const FixedPoint& lhs, const FixedPoint& rhs) { return lhs.raw_ < rhs.raw_; }
+    friend constexpr bool operator<=(const FixedPoint& lhs, const FixedPoint& rhs) { return lhs.raw_ <= rhs.raw_; }
+    friend constexpr bool operator>(const FixedPoint& lhs, const FixedPoint& rhs) { return lhs.raw_ > rhs.raw_; }
+    friend constexpr bool operator>=(const FixedPoint& lhs, const FixedPoint& rhs) { return lhs.raw_ >= rhs.raw_; }
+
+    friend constexpr FixedPoint abs(const FixedPoint& x) { return x < FixedPoint{} ? -x : x; }
+    friend constexpr FixedPoint min(const FixedPoint& a, const FixedPoint& b) { return b < a ? b : a; }
+    friend constexpr FixedPoint max(const FixedPoint& a, const FixedPoint& b) { return a < b ? b : a; }
+
+    /** The square root through double, which is correctly rounded and thus deterministic */
+    friend FixedPoint sqrt(const FixedPoint& x) { return FixedPoint{std::sqrt(static_cast<double>(x))}; }
+  };
+
+  /** A 32 bit FixedPoint, e.g. Fixed32<16> for the Q15.16 format */
+  template <int FractionalBits, typename OverflowPolicy = Saturate>
+  using Fixed32 = FixedPoint<std::int32_t, FractionalBits, OverflowPolicy>;
+
+#if defined(__SIZEOF_INT128__)
+  /** A 64 bit FixedPoint, whose products need 128 bit intermediates */
+  template <int FractionalBits, typename OverflowPolicy = Saturate>
+  using Fixed64 = FixedPoint<std::int64_t, FractionalBits, OverflowPolicy>;
+#endif
+
+  namespace scalar {
+    /** Additional functionality for fixed-point Quantities */
+    template <typename Derived, typename IntegerType, int FractionalBits, typename OverflowPolicy>
+    class ScalarMixin<Derived, FixedPoint<IntegerType, FractionalBits, OverflowPolicy>> {
+     private:
+      using DoubleQuantity = Quantity<double, UnitOf_t<Derived>, IsBaseUnit_v<Derived>>;
+
+     public:
+      /** Accesses the integer representation in base units, e.g. to write it to a device */
+      IntegerType rawBase() const {
+        return derived()->base().raw();
+      }
+
+      /** Converts to a Quantity of double, e.g. for logging or tests */
+      DoubleQuantity toDouble() const {
+        return DoubleQuantity::makeFromBaseUnitValue(static_cast<double>(derived()->base()));
+      }
+
+     private:
+      Derived* derived() { return static_cast<Derived*>(this); }
+      const Derived* derived() const { return static_cast<const Derived*>(this); }
+    };
+  }  // namespace scalar
+}  // namespace poids
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef POIDS_SCALAR_SUPPORT_MEASUREMENT_HPP
+#define POIDS_SCALAR_SUPPORT_MEASUREMENT_HPP
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "poids/core/quantity.hpp"
+#include "poids/core/scalar_support.hpp"
+
+namespace poids {
+  namespace detail {
+    /** Returns an identifier for a new independent source of uncertainty */
+    inline std::uint64_t nextUncertaintySource() {
+      static std::atomic<std::uint64_t> next{0};
+      return next.fetch_add(1, std::memory_order_relaxed);
+    }
+  }  // namespace detail
+
+  /** A measured value with a standard uncertainty, propagated linearly (to first
+   * order) through arithmetic.
+   *
+   * The uncertainty is held as a sparse vector of the contributions of independent
+   * sources, sorted by source. Each measurement constructed with an uncertainty is
+   * a new source, and results keep their sensitivity to every source they depend
+   * on, so correlations are accounted for: x - x is exact, and x * x has twice the
+   * relative uncertainty of x. Comparisons only consider the value.
+   *
+   * \tparam T The floating-point type of the value and uncertainty
+   */
+  template <typename T>
+  class Measurement {
+    static_assert(std::is_floating_point_v<T>, "Measurement requires a floating-point T");
+
+   public:
+    /** The contribution of one independent source to the uncertainty */
+    struct Component {
+      std::uint64_t source;
+      T coefficient;
+    };
+
+    using value_type = T;
+
+    /** Constructs an exact zero */
+    Measurement() :
+        value_{} { }
+
+    /** Constructs an exact value, without uncertainty */
+    /*implicit*/ Measurement(T value) :
+        value_(value) { }
+
+    /** Constructs a value with a standard uncertainty from a new independent source */
+    Measurement(T value, T uncertainty) :
+        value_(value) {
+      if (uncertainty != T{}) {
+        components_.push_back(Component{detail::nextUncertaintySource(), std::abs(uncertainty)});
+      }
+    }
+
+    /** The value */
+    T value() const { return value_; }
+
+    /** The combined standard uncertainty */
+    T uncertainty() const { return std::sqrt(covariance(*this, *this)); }
+
+    /** The contributions of the independent sources, sorted by source */
+    const std::vector<Component>& components() const { return components_; }
+
+    /** The covariance of two measurements, from the sources they share */
+    friend T covariance(const Measurement& lhs, const Measurement& rhs) {
+      T result{};
+      auto l = lhs.components_.begin();
+      auto r = rhs.components_.begin();
+      while (l != lhs.components_.end() && r != rhs.components_.end()) {
+        if (l->source < r->source) {
+          ++l;
+        } else if (r->source < l->source) {
+          ++r;
+        } else {
+          result += l->coefficient * r->coefficient;
+          ++l;
+          ++r;
+        }
+      }
+      return result;
+    }
+
+    /** The correlation coefficient of two measurements, in [-1, 1] */
+    friend T correlation(const Measurement& lhs, const Measurement& rhs) {
+      return covariance(lhs, rhs) / (lhs.uncertainty() * rhs.uncertainty());
+    }
+
+    Measurement& operator+=(const Measurement& rhs) { return *this = *this + rhs; }
+    Measurement& operator-=(const Measurement& rhs) { return *this = *this - rhs; }
+    Measurement& operator*=(const Measurement& rhs) { return *this = *this * rhs; }
+    Measurement& operator/=(const Measurement& rhs) { return *this = *this / rhs; }
+
+   private:
+    T value_;
+    std::vector<Component> components_;
+
+    /** Returns a result with the value fx, whose sensitivity to x is dfdx */
+    static Measurement chain(const Measurement& x, T fx, T dfdx) {
+      Measurement result{fx};
+      result.components_.reserve(x.components_.size());
+      for (const Component& component : x.components_) {
+        result.components_.push_back(Component{component.source, component.coefficient * dfdx});
+      }
+      return result;
+    }
+
+    /** Returns a result with the value fxy, whose sensitivities to x and y are dfdx
+     * and dfdy, merging the sources of x and y
+     */
+    static Measurement chain(const Measurement& x, const Measurement& y, T fxy, T dfdx, T dfdy) {
+      Measurement result{fxy};
+      result.components_.reserve(x.components_.size() + y.components_.size());
+      auto l = x.components_.begin();
+      auto r = y.components_.begin();
+      while (l != x.components_.end() || r != y.components_.end()) {
+        if (r == y.components_.end() || (l != x.components_.end() && l->source < r->source)) {
+          result.components_.push_back(Component{l->source, l->coefficient * dfdx});
+          ++l;
+        } else if (l == x.components_.end() || r->source < l->source) {
+          result.components_.push_back(Component{r->source, r->coefficient * dfdy});
+          ++r;
+        } else {
+          result.components_.push_back(Component{l->source, l->coefficient * dfdx + r->coefficient * dfdy});
+          ++l;
+          ++r;
+        }
+      }
+      return result;
+    }
+
+    friend Measurement operator+(const Measurement& rhs) { return rhs; }
+    friend Measurement operator-(const Measurement& rhs) { return chain(rhs, -rhs.value_, T{-1}); }
+
+    friend Measurement operator+(const Measurement& lhs, const Measurement& rhs) {
+      return chain(lhs, rhs, lhs.value_ + rhs.value_, T{1}, T{1});
+    }
+
+    friend Measurement operator-(const Measurement& lhs, const Measurement& rhs) {
+      return chain(lhs, rhs, lhs.value_ - rhs.value_, T{1}, T{-1});
+    }
+
+    friend Measurement operator*(const Measurement& lhs, const Measurement& rhs) {
+      return chain(lhs, rhs, lhs.value_ * rhs.value_, rhs.value_, lhs.value_);
+    }
+
+    friend Measurement operator/(const Measurement& lhs, const Measurement& rhs) {
+      const T quotient = lhs.value_ / rhs.value_;
+      return chain(lhs, rhs, quotient, T{1} / rhs.value_, -quotient / rhs.value_);
+    }
+
+    friend bool operator==(const Measurement& lhs, const Measurement& rhs) { return lhs.value_ == rhs.value_; }
+    friend bool operator!=(const Measurement& lhs, const Measurement& rhs) { return lhs.value_ != rhs.value_; }
+    friend bool operator<(const Measurement& lhs, const Measurement& rhs) { return lhs.value_ < rhs.value_; }
+    friend bool operator<=(const Measurement& lhs, const Measurement& rhs) { return lhs.value_ <= rhs.value_; }
+    friend bool operator>(const Measurement& lhs, const Measurement& rhs) { return lhs.value_ > rhs.value_; }
+    friend bool operator>=(const Measurement& lhs, const Measurement& rhs) { return lhs.value_ >= rhs.value_; }
+
+    friend Measurement abs(const Measurement& x) { return x.value_ < T{} ? -x : x; }
+
+    friend Measurement sqrt(const Measurement& x) {
+      const T root = std::sqrt(x.value_);
+      return chain(x, root, T{1} / (T{2} * root));
+    }
+
+    friend Measurement cbrt(const Measurement& x) {
+      const T root = std::cbrt(x.value_);
+      return chain(x, root, T{1} / (T{3} * root * root));
+    }
+
+    friend Measurement pow(const Measurement& x, double exponent) {
+      const T power = static_cast<T>(std::pow(x.value_, exponent));
+      return chain(x, power, static_cast<T>(exponent * std::pow(x.value_, exponent - 1.0)));
+    }
+
+    friend Measurement exp(const Measurement& x) {
+      const T e = std::exp(x.value_);
+      return chain(x, e, e);
+    }
+
+    friend Measurement log(const Measurement& x) { return chain(x, std::log(x.value_), T{1} / x.value_); }
+    friend Measurement sin(const Measurement& x) { return chain(x, std::sin(x.value_), std::cos(x.value_)); }
+    friend Measurement cos(const Measurement& x) { return chain(x, std::cos(x.value_), -std::sin(x.value_)); }
+  };
+
+  namespace scalar {
+    /** Additional functionality for Quantities of measurements */
+    template <typename Derived, typename T>
+    class ScalarMixin<Derived, Measurement<T>> {
+     private:
+      using Unit = UnitOf_t<Derived>;
+
+     public:
+      /** The measured value without uncertainty */
+      Quantity<T, Unit> nominal() const {
+        return Quantity<T, Unit>::makeFromBaseUnitValue(derived()->base().value());
+      }
+
+      /** The combined standard uncertainty, in the unit of the quantity */
+      Quantity<T, Unit> uncertainty() const {
+        return Quantity<T, Unit>::makeFromBaseUnitValue(derived()->base().uncertainty());
+      }
+
+      /** The standard uncertainty relative to the magnitude of the value */
+      T relativeUncertainty() const {
+        return derived()->base().uncertainty() / std::abs(derived()->base().value());
+      }
+
+     private:
+      Derived* derived() { return static_cast<Derived*>(this); }
+      const Derived* derived() const { return static_cast<const Derived*>(this); }
+    };
+  }  // namespace scalar
+
+  /** Makes a measurement of value with a standard uncertainty in the same unit, from a
+   * new independent source
+   */
+  template <typename T, typename UnitType, bool IsBaseValue, bool IsBaseUncertainty>
+  Quantity<Measurement<T>, UnitType> makeMeasurement(const Quantity<T, UnitType, IsBaseValue>& value,
+                                                      const Quantity<T, UnitType, IsBaseUncertainty>& uncertainty) {
+    return Quantity<Measurement<T>, UnitType>::makeFromBaseUnitValue(Measurement<T>{value.base(), uncertainty.base()});
+  }
+}  // namespace poids
+
+#endif
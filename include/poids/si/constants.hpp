@@ -1,6 +1,8 @@
 #ifndef POIDS_SI_CONSTANTS_HPP
 #define POIDS_SI_CONSTANTS_HPP
 
+#include <type_traits>
+
 #include "poids/core/quantity.hpp"
 #include "poids/si/unit.hpp"
 
@@ -110,6 +112,7 @@ namespace si {
     using namespace si::base;
 
     inline constexpr si::SolidAngle::BaseType steradian = si::base::radian * si::base::radian;
+    inline constexpr si::Angle::BaseType degree = si::base::radian * si::Unitless::BaseType{0.017453292519943295};
     inline constexpr si::Frequency::BaseType hertz = si::Unitless::BaseType{1.0} / si::base::second;
     inline constexpr si::Area::BaseType meter2 = si::base::meter * si::base::meter;
     inline constexpr si::Volume::BaseType meter3 = si::base::meter * si::base::meter * si::base::meter;
@@ -132,6 +135,50 @@ namespace si {
     inline constexpr si::CatalyticActivity::BaseType katal = si::base::mole / si::base::second;
   }  // namespace units
 
+  /** The constants of si::units with a float scalar, for single-precision data, e.g.
+   * 2.5f * si::float_units::meter is a si::LengthOf<float>. The prefixes keep the
+   * scalar, so milli(si::float_units::meter) is a float millimeter.
+   */
+  namespace float_units {
+#define POIDS_SI_DECLARE_FLOAT_UNIT(name)                                               \
+  inline constexpr auto name =                                                          \
+      poids::makeBase<float, poids::UnitOf_t<std::decay_t<decltype(si::units::name)>>>( \
+          static_cast<float>(si::units::name.value()))
+
+    POIDS_SI_DECLARE_FLOAT_UNIT(radian);
+    POIDS_SI_DECLARE_FLOAT_UNIT(second);
+    POIDS_SI_DECLARE_FLOAT_UNIT(meter);
+    POIDS_SI_DECLARE_FLOAT_UNIT(kilogram);
+    POIDS_SI_DECLARE_FLOAT_UNIT(ampere);
+    POIDS_SI_DECLARE_FLOAT_UNIT(kelvin);
+    POIDS_SI_DECLARE_FLOAT_UNIT(mole);
+    POIDS_SI_DECLARE_FLOAT_UNIT(candela);
+    POIDS_SI_DECLARE_FLOAT_UNIT(steradian);
+    POIDS_SI_DECLARE_FLOAT_UNIT(degree);
+    POIDS_SI_DECLARE_FLOAT_UNIT(hertz);
+    POIDS_SI_DECLARE_FLOAT_UNIT(meter2);
+    POIDS_SI_DECLARE_FLOAT_UNIT(meter3);
+    POIDS_SI_DECLARE_FLOAT_UNIT(meter4);
+    POIDS_SI_DECLARE_FLOAT_UNIT(gram);
+    POIDS_SI_DECLARE_FLOAT_UNIT(newton);
+    POIDS_SI_DECLARE_FLOAT_UNIT(joule);
+    POIDS_SI_DECLARE_FLOAT_UNIT(watt);
+    POIDS_SI_DECLARE_FLOAT_UNIT(pascal);
+    POIDS_SI_DECLARE_FLOAT_UNIT(coulomb);
+    POIDS_SI_DECLARE_FLOAT_UNIT(volt);
+    POIDS_SI_DECLARE_FLOAT_UNIT(farad);
+    POIDS_SI_DECLARE_FLOAT_UNIT(ohm);
+    POIDS_SI_DECLARE_FLOAT_UNIT(siemen);
+    POIDS_SI_DECLARE_FLOAT_UNIT(weber);
+    POIDS_SI_DECLARE_FLOAT_UNIT(henry);
+    POIDS_SI_DECLARE_FLOAT_UNIT(tesla);
+    POIDS_SI_DECLARE_FLOAT_UNIT(lumen);
+    POIDS_SI_DECLARE_FLOAT_UNIT(lux);
+    POIDS_SI_DECLARE_FLOAT_UNIT(katal);
+
+#undef POIDS_SI_DECLARE_FLOAT_UNIT
+  }  // namespace float_units
+
   namespace detail {
     template <typename Ratio>
     struct Prefix {
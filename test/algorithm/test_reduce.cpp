@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "poids/algorithm/reduce.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+TEST(TestReduce, SumKeepsUnits) {
+  poids::ArrayOf<si::Energy> energy{1.0 * joule, 2.0 * joule, 3.5 * joule};
+
+  auto actual = poids::sum(energy);
+
+  EXPECT_TRUE((std::is_same_v<si::Energy, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(6.5, actual.as(joule));
+}
+
+TEST(TestReduce, SumOfEmptyRangeIsZero) {
+  poids::ArrayOf<si::Energy> energy;
+
+  EXPECT_DOUBLE_EQ(0.0, poids::sum(energy).as(joule));
+}
+
+TEST(TestReduce, SummationPoliciesAgree) {
+  poids::ArrayOf<si::Power> power(1001, poids::uninitialized);
+  for (std::size_t i = 0; i < power.size(); ++i) {
+    power[i] = static_cast<double>(i) * watt;
+  }
+
+  EXPECT_DOUBLE_EQ(500500.0, poids::sum(power, poids::fastSummation).as(watt));
+  EXPECT_DOUBLE_EQ(500500.0, poids::sum(power, poids::pairwiseSummation).as(watt));
+  EXPECT_DOUBLE_EQ(500500.0, poids::sum(power, poids::kahanSummation).as(watt));
+}
+
+TEST(TestReduce, KahanSummationIsAccurate) {
+  const std::size_t count = 100000;
+  poids::ArrayOf<si::Energy> energy(count + 1, 1.0e-16 * joule);
+  energy[0] = 1.0 * joule;
+
+  auto naive = 0.0 * joule;
+  for (si::Energy value : energy) {
+    naive += value;
+  }
+  auto compensated = poids::sum(energy, poids::kahanSummation);
+
+  EXPECT_DOUBLE_EQ(1.0, naive.as(joule));
+  EXPECT_DOUBLE_EQ(1.0 + 1.0e-11, compensated.as(joule));
+}
+
+TEST(TestReduce, SumOfExpressionIsFused) {
+  poids::ArrayOf<si::Power> power{10.0 * watt, 20.0 * watt};
+  si::Time dt = 0.5 * second;
+
+  auto actual = poids::sum(power * dt);
+
+  EXPECT_TRUE((std::is_same_v<si::Energy, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(15.0, actual.as(joule));
+}
+
+TEST(TestReduce, Mean) {
+  poids::ArrayOf<si::Length> length{1.0 * meter, 2.0 * meter, 6.0 * meter};
+
+  EXPECT_DOUBLE_EQ(3.0, poids::mean(length).as(meter));
+}
+
+TEST(TestReduce, DotDerivesUnit) {
+  poids::ArrayOf<si::Current> current{1.0 * ampere, 2.0 * ampere, 3.0 * ampere};
+  poids::ArrayOf<si::Voltage> voltage{4.0 * volt, 5.0 * volt, 6.0 * volt};
+
+  auto actual = poids::dot(current, voltage);
+
+  EXPECT_TRUE((std::is_same_v<si::Power, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(32.0, actual.as(watt));
+}
+
+TEST(TestReduce, NormAndRms) {
+  poids::ArrayOf<si::Current> current{3.0 * ampere, -4.0 * ampere};
+
+  auto norm = poids::norm(current);
+  auto rms = poids::rms(current);
+
+  EXPECT_TRUE((std::is_same_v<si::Current, decltype(norm)>));
+  EXPECT_DOUBLE_EQ(5.0, norm.as(ampere));
+  EXPECT_DOUBLE_EQ(std::sqrt(12.5), rms.as(ampere));
+}
+
+TEST(TestReduce, MinMax) {
+  poids::ArrayOf<si::Temperature> temperature(19, poids::uninitialized);
+  for (std::size_t i = 0; i < temperature.size(); ++i) {
+    temperature[i] = (static_cast<double>((i * 7) % 19) - 5.0) * kelvin;
+  }
+
+  EXPECT_DOUBLE_EQ(-5.0, poids::min(temperature).as(kelvin));
+  EXPECT_DOUBLE_EQ(13.0, poids::max(temperature).as(kelvin));
+}
+
+TEST(TestReduce, StridedSpan) {
+  const double interleaved[] = {1.0, 100.0, 2.0, 100.0, 3.0, 100.0};
+  auto span = poids::ConstSpanOf<si::Length>::makeFromBaseUnitValues(interleaved, 3, 2);
+
+  EXPECT_DOUBLE_EQ(6.0, poids::sum(span).as(meter));
+  EXPECT_DOUBLE_EQ(3.0, poids::max(span).as(meter));
+}
+
+TEST(TestReduce, VectorOfQuantities) {
+  std::vector<si::Mass> mass{1.0 * kilogram, 2.0 * kilogram};
+
+  EXPECT_DOUBLE_EQ(3.0, poids::sum(poids::makeSpan(mass)).as(kilogram));
+}
+
+TEST(TestReduce, LongStridedExpression) {
+  std::vector<double> interleaved(2 * 101);
+  for (std::size_t i = 0; i < interleaved.size(); ++i) {
+    interleaved[i] = static_cast<double>(i % 2 == 0 ? i / 2 : 1000);
+  }
+  auto span = poids::ConstSpanOf<si::Length>::makeFromBaseUnitValues(interleaved.data(), 101, 2);
+  si::Length offset = 1.0 * meter;
+
+  EXPECT_DOUBLE_EQ(-4949.0, poids::sum(offset - span).as(meter));
+  EXPECT_DOUBLE_EQ(-4949.0, poids::sum(offset - span, poids::kahanSummation).as(meter));
+  EXPECT_DOUBLE_EQ(-99.0, poids::min(offset - span).as(meter));
+  EXPECT_DOUBLE_EQ(1.0, poids::max(offset - span).as(meter));
+}
+
+TEST(TestReduce, AccumulateFloatsInDouble) {
+  constexpr std::size_t count = 1000003;
+  poids::ArrayOf<si::LengthOf<float>> length(count, 0.1f * si::float_units::meter);
+  const double element = static_cast<double>(0.1f);
+
+  auto wide = poids::sumAs<double>(length);
+  auto narrow = poids::sum(length);
+
+  EXPECT_TRUE((std::is_same_v<si::Length, decltype(wide)>));
+  EXPECT_TRUE((std::is_same_v<si::LengthOf<float>, decltype(narrow)>));
+  EXPECT_NEAR(element * count, wide.as(meter), 1.0e-6);
+  EXPECT_NEAR(element, poids::meanAs<double>(length).as(meter), 1.0e-12);
+  EXPECT_NEAR(element * element * count, poids::dotAs<double>(length, length).base(), 1.0e-6);
+}
@@ -319,6 +319,48 @@ TEST(TestQuantityArithmetic, Pow) {
   EXPECT_NEAR(expected.base(), actual.base(), 1e-6);
 }
 
+TEST(TestQuantityArithmetic, PowInteger) {
+  auto a = si::Length::makeFromBaseUnitValue(3.0);
+
+  auto cube = poids::pow<3, 1>(a);
+  auto fifth = poids::pow<10, 2>(a);
+
+  EXPECT_TRUE((std::is_same_v<si::Volume, decltype(cube)>));
+  EXPECT_DOUBLE_EQ(27.0, cube.base());
+  EXPECT_DOUBLE_EQ(243.0, fifth.base());
+}
+
+TEST(TestQuantityArithmetic, PowNegative) {
+  auto a = si::Time::makeFromBaseUnitValue(4.0);
+
+  auto actual = poids::pow<-2, 1>(a);
+  auto inverseRoot = poids::pow<-1, 2>(a);
+
+  EXPECT_TRUE((std::is_same_v<si::TimeUnit<-2>, poids::UnitOf_t<decltype(actual)>>));
+  EXPECT_DOUBLE_EQ(0.0625, actual.base());
+  EXPECT_DOUBLE_EQ(0.5, inverseRoot.base());
+}
+
+TEST(TestQuantityArithmetic, PowZeroIsOne) {
+  auto a = si::Length::makeFromBaseUnitValue(7.0);
+
+  auto actual = poids::pow<0, 1>(a);
+
+  EXPECT_TRUE(poids::IsUnitless_v<decltype(actual)>);
+  EXPECT_DOUBLE_EQ(1.0, actual.base());
+}
+
+TEST(TestQuantityArithmetic, PowCubeRoot) {
+  auto a = si::Volume::makeFromBaseUnitValue(-8.0);
+
+  auto actual = poids::pow<1, 3>(a);
+  auto squared = poids::pow<2, 3>(a);
+
+  EXPECT_TRUE((std::is_same_v<si::Length, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(-2.0, actual.base());
+  EXPECT_DOUBLE_EQ(4.0, squared.base());
+}
+
 TEST(TestQuantityArithmetic, Square) {
   auto expected = si::Area::makeFromBaseUnitValue(25.0);
 
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/quantity_span.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  poids::ArrayOf<si::Length> makeLengths() {
+    return poids::ArrayOf<si::Length>{1.0 * meter, 2.0 * meter, 3.0 * meter};
+  }
+}  // namespace
+
+TEST(TestArrayExpression, ArithmeticIsLazy) {
+  poids::ArrayOf<si::Voltage> voltage{2.0 * volt, 3.0 * volt};
+  poids::ArrayOf<si::Current> current{4.0 * ampere, 5.0 * ampere};
+
+  auto actual = voltage * current;
+
+  EXPECT_FALSE((std::is_same_v<poids::ArrayOf<si::Power>, decltype(actual)>));
+  EXPECT_TRUE((std::is_same_v<si::Power::Unit, poids::UnitOf_t<decltype(actual)>>));
+  EXPECT_TRUE(poids::IsQuantityContainer_v<decltype(actual)>);
+  ASSERT_EQ(2u, actual.size());
+  EXPECT_DOUBLE_EQ(15.0, actual[1].as(watt));
+}
+
+TEST(TestArrayExpression, FusedExpressionHasDerivedUnit) {
+  poids::ArrayOf<si::Density> density{1000.0 * kilogram / meter3, 800.0 * kilogram / meter3};
+  poids::ArrayOf<si::Length> depth{10.0 * meter, 5.0 * meter};
+  si::Acceleration g = 10.0 * meter / square(second);
+  si::Pressure surface = 100.0 * pascal;
+
+  poids::QuantityArray actual = density * g * depth + surface;
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Pressure>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(100100.0, actual[0].as(pascal));
+  EXPECT_DOUBLE_EQ(40100.0, actual[1].as(pascal));
+}
+
+TEST(TestArrayExpression, Evaluate) {
+  poids::ArrayOf<si::Length> length{4.0 * meter, 6.0 * meter};
+
+  auto actual = (-length / 2.0).evaluate();
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Length>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(-2.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(-3.0, actual[1].as(meter));
+}
+
+TEST(TestArrayExpression, AssignmentMayReferToItself) {
+  poids::ArrayOf<si::Length> actual{1.0 * meter, 2.0 * meter};
+
+  actual = actual * 2.0 + actual;
+
+  EXPECT_DOUBLE_EQ(3.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(6.0, actual[1].as(meter));
+}
+
+TEST(TestArrayExpression, AssignmentResizes) {
+  poids::ArrayOf<si::Length> source{1.0 * meter, 2.0 * meter, 3.0 * meter};
+  poids::ArrayOf<si::Length> actual;
+
+  actual = source + source;
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_DOUBLE_EQ(6.0, actual[2].as(meter));
+}
+
+TEST(TestArrayExpression, CompoundAssignmentFromExpression) {
+  poids::ArrayOf<si::Length> actual{1.0 * meter, 2.0 * meter};
+  poids::ArrayOf<si::Velocity> velocity{1.0 * meter / second, 3.0 * meter / second};
+  si::Time dt = 0.5 * second;
+
+  actual += velocity * dt;
+  EXPECT_DOUBLE_EQ(3.5, actual[1].as(meter));
+
+  actual -= velocity * dt * 2.0;
+  EXPECT_DOUBLE_EQ(0.5, actual[1].as(meter));
+}
+
+TEST(TestArrayExpression, TakesOwnershipOfTemporaryArrays) {
+  poids::ArrayOf<si::Length> offset{1.0 * meter, 1.0 * meter, 1.0 * meter};
+
+  auto expression = makeLengths() + offset;
+  poids::QuantityArray actual = expression;
+
+  EXPECT_DOUBLE_EQ(2.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(4.0, actual[2].as(meter));
+}
+
+TEST(TestArrayExpression, StridedSpanOperand) {
+  const double interleaved[] = {1.0, -1.0, 2.0, -1.0, 3.0, -1.0};
+  auto current = poids::ConstSpanOf<si::Current>::makeFromBaseUnitValues(interleaved, 3, 2);
+  poids::ArrayOf<si::Resistance> resistance{10.0 * ohm, 20.0 * ohm, 30.0 * ohm};
+
+  poids::QuantityArray actual = current * resistance;
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Voltage>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(10.0, actual[0].as(volt));
+  EXPECT_DOUBLE_EQ(40.0, actual[1].as(volt));
+  EXPECT_DOUBLE_EQ(90.0, actual[2].as(volt));
+}
+
+TEST(TestArrayExpression, AddAndSubtractQuantity) {
+  poids::ArrayOf<si::Time> time{1.0 * second, 2.0 * second};
+  si::Time offset = 0.5 * second;
+
+  poids::QuantityArray actual1 = time + offset;
+  poids::QuantityArray actual2 = offset - time;
+
+  EXPECT_DOUBLE_EQ(2.5, actual1[1].as(second));
+  EXPECT_DOUBLE_EQ(-1.5, actual2[1].as(second));
+}
+
+TEST(TestArrayExpression, BroadcastsElementReferences) {
+  poids::ArrayOf<si::Length> lengths = makeLengths();
+
+  poids::ArrayOf<si::Area> products = lengths * lengths[1];
+  poids::ArrayOf<si::Length> sums = lengths[0] + lengths;
+  poids::ArrayOf<si::Length> differences = lengths - lengths[0];
+  poids::ArrayOf<si::Unitless> ratios = lengths / lengths[2];
+
+  EXPECT_DOUBLE_EQ(6.0, products[2].as(meter * meter));
+  EXPECT_DOUBLE_EQ(4.0, sums[2].as(meter));
+  EXPECT_DOUBLE_EQ(2.0, differences[2].as(meter));
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, ratios[0].base());
+}
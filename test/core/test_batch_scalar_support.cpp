@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <type_traits>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/scalar_support/batch.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+template <typename BatchType>
+class TestBatch : public ::testing::Test { };
+
+using BatchTypes = ::testing::Types<poids::Batch<double, 2>,
+                                    poids::Batch<double, 3>,
+                                    poids::Batch<double, 4>,
+                                    poids::Batch<double, 8>,
+                                    poids::Batch<float, 4>,
+                                    poids::Batch<float, 8>,
+                                    poids::Batch<float, 16>>;
+TYPED_TEST_SUITE(TestBatch, BatchTypes);
+
+TYPED_TEST(TestBatch, DefaultIsZero) {
+  TypeParam actual{};
+
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    EXPECT_EQ(0, actual[i]);
+  }
+}
+
+TYPED_TEST(TestBatch, DefaultConstructedIsZero) {
+  TypeParam actual;
+
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    EXPECT_EQ(0, actual[i]);
+  }
+}
+
+TYPED_TEST(TestBatch, LoadStoreRoundTrip) {
+  using T = typename TypeParam::value_type;
+  T values[TypeParam::lanes];
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    values[i] = static_cast<T>(i + 1);
+  }
+
+  TypeParam batch = TypeParam::load(values);
+  T actual[TypeParam::lanes];
+  (batch * T{2}).store(actual);
+
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    EXPECT_EQ(static_cast<T>(2 * (i + 1)), actual[i]);
+  }
+}
+
+TYPED_TEST(TestBatch, Arithmetic) {
+  using T = typename TypeParam::value_type;
+  T values[TypeParam::lanes];
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    values[i] = static_cast<T>(i + 1);
+  }
+  TypeParam x = TypeParam::load(values);
+
+  TypeParam actual = (x + T{1}) * x - x / T{2};
+
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    T v = values[i];
+    EXPECT_FLOAT_EQ((v + 1) * v - v / 2, actual[i]);
+    EXPECT_FLOAT_EQ(-v, (-x)[i]);
+  }
+}
+
+TYPED_TEST(TestBatch, ComparisonsAreMasks) {
+  using T = typename TypeParam::value_type;
+  T values[TypeParam::lanes];
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    values[i] = static_cast<T>(i);
+  }
+  TypeParam x = TypeParam::load(values);
+
+  auto mask = x < TypeParam{T{2}};
+
+  EXPECT_TRUE((std::is_same_v<typename TypeParam::Mask, decltype(mask)>));
+  EXPECT_TRUE(mask[0]);
+  EXPECT_TRUE(mask[1]);
+  EXPECT_TRUE(mask.any());
+  EXPECT_EQ(TypeParam::lanes == 2, mask.all());
+  EXPECT_TRUE((x == x).all());
+  EXPECT_TRUE((x != x).none());
+  EXPECT_TRUE((!(x >= TypeParam{T{2}})).bits() == mask.bits());
+  EXPECT_TRUE(((x <= x) & (x > x - T{1})).all());
+  EXPECT_TRUE(((x < T{0}) | (x >= T{0})).all());
+}
+
+TYPED_TEST(TestBatch, SelectAndHorizontalReductions) {
+  using T = typename TypeParam::value_type;
+  T values[TypeParam::lanes];
+  T expectedSum = 0;
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    values[i] = static_cast<T>(i) - T{1};
+    expectedSum += values[i];
+  }
+  TypeParam x = TypeParam::load(values);
+
+  TypeParam clamped = select(x < T{0}, TypeParam{T{0}}, x);
+
+  EXPECT_FLOAT_EQ(expectedSum, x.sum());
+  EXPECT_EQ(T{-1}, x.min());
+  EXPECT_EQ(static_cast<T>(TypeParam::lanes) - T{2}, x.max());
+  EXPECT_EQ(T{0}, clamped.min());
+  EXPECT_EQ(T{1}, abs(x)[0]);
+  EXPECT_FLOAT_EQ(T{1}, max(x, TypeParam{T{1}})[0]);
+}
+
+TYPED_TEST(TestBatch, LdexpFrexpRoundTrip) {
+  using T = typename TypeParam::value_type;
+  T values[TypeParam::lanes];
+  T powers[TypeParam::lanes];
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    values[i] = static_cast<T>(i % 2 == 0 ? 1.5 : -0.375) * static_cast<T>(i + 1);
+    powers[i] = static_cast<T>(static_cast<int>(i) - 3);
+  }
+  const TypeParam x = TypeParam::load(values);
+
+  TypeParam exponent;
+  const TypeParam mantissa = frexp(x, &exponent);
+  const TypeParam scaled = ldexp(x, TypeParam::load(powers));
+
+  for (std::size_t i = 0; i < TypeParam::lanes; ++i) {
+    int expected = 0;
+    EXPECT_EQ(std::frexp(values[i], &expected), mantissa[i]);
+    EXPECT_EQ(static_cast<T>(expected), exponent[i]);
+    EXPECT_EQ(std::ldexp(values[i], static_cast<int>(powers[i])), scaled[i]);
+  }
+}
+
+TEST(TestBatchScalarSupport, QuantityArithmeticKeepsUnits) {
+  using Batch = poids::Batch<double, 4>;
+  auto length = Batch{2.0} * meter;
+  auto time = Batch{4.0} * second;
+
+  auto actual = length / time;
+
+  EXPECT_TRUE((std::is_same_v<si::VelocityOf<Batch>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(0.5, actual[3].as(meter / second));
+  EXPECT_TRUE((std::is_same_v<si::Velocity, decltype(actual[3])>));
+}
+
+TEST(TestBatchScalarSupport, QuantityComparisonsAreMasks) {
+  using Batch = poids::Batch<double, 2>;
+  const double values[] = {1.0, 3.0};
+  auto length = si::LengthOf<Batch>::makeFromBaseUnitValue(Batch::load(values));
+  si::LengthOf<Batch> limit = Batch{2.0} * meter;
+
+  auto mask = length < limit;
+
+  EXPECT_TRUE((std::is_same_v<Batch::Mask, decltype(mask)>));
+  EXPECT_TRUE(mask[0]);
+  EXPECT_FALSE(mask[1]);
+
+  auto clamped = poids::select(mask, length, limit);
+  EXPECT_DOUBLE_EQ(1.0, clamped[0].as(meter));
+  EXPECT_DOUBLE_EQ(2.0, clamped[1].as(meter));
+}
+
+TEST(TestBatchScalarSupport, LoadStoreQuantityArrays) {
+  using Batch = poids::NativeBatch<double>;
+  poids::ArrayOf<si::Current> current(2 * Batch::lanes);
+  poids::ArrayOf<si::Voltage> voltage(2 * Batch::lanes);
+  for (std::size_t i = 0; i < current.size(); ++i) {
+    current[i] = static_cast<double>(i) * ampere;
+  }
+  si::ResistanceOf<Batch> resistance = Batch{10.0} * ohm;
+
+  for (std::size_t i = 0; i < current.size(); i += Batch::lanes) {
+    auto lanes = si::CurrentOf<Batch>::load(current, i);
+    (lanes * resistance).store(voltage, i);
+  }
+
+  for (std::size_t i = 0; i < voltage.size(); ++i) {
+    EXPECT_DOUBLE_EQ(10.0 * static_cast<double>(i), voltage[i].as(volt));
+  }
+}
+
+TEST(TestBatchScalarSupport, QuantityReductions) {
+  using Batch = poids::Batch<double, 4>;
+  const double values[] = {3.0, -1.0, 4.0, 1.5};
+  auto energy = si::EnergyOf<Batch>::makeFromBaseUnitValue(Batch::load(values));
+
+  EXPECT_DOUBLE_EQ(7.5, energy.sum().as(joule));
+  EXPECT_DOUBLE_EQ(-1.0, energy.min().as(joule));
+  EXPECT_DOUBLE_EQ(4.0, energy.max().as(joule));
+  EXPECT_DOUBLE_EQ(4.0, poids::sqrt(energy * energy)[2].as(joule));
+}
+
+TEST(TestBatchScalarSupport, QuantityPow) {
+  using Batch = poids::Batch<double, 4>;
+  const double values[] = {1.0, 8.0, 27.0, 64.0};
+  auto volume = si::VolumeOf<Batch>::makeFromBaseUnitValue(Batch::load(values));
+
+  auto side = poids::pow<1, 3>(volume);
+  auto inverse = poids::pow<-1, 1>(volume);
+
+  EXPECT_TRUE((std::is_same_v<si::LengthOf<Batch>, decltype(side)>));
+  EXPECT_DOUBLE_EQ(3.0, side[2].as(meter));
+  EXPECT_DOUBLE_EQ(0.125, inverse[1].base());
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <type_traits>
+
+#include "poids/scalar_support/complex_array.hpp"
+#include "poids/si.hpp"
+
+using namespace std::complex_literals;
+using namespace si::units;
+using CpxDbl = std::complex<double>;
+
+TEST(TestComplexArray, ConstructWithSizeIsZeroed) {
+  poids::ComplexArrayOf<si::Voltage> actual(3);
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_EQ(CpxDbl{}, actual[2].base());
+}
+
+TEST(TestComplexArray, AliasAcceptsRealOrComplexQuantities) {
+  EXPECT_TRUE((std::is_same_v<poids::ComplexArrayOf<si::Voltage>,
+                              poids::ComplexArrayOf<si::VoltageOf<CpxDbl>>>));
+}
+
+TEST(TestComplexArray, StoresPartsInSeparateLanes) {
+  poids::ComplexArrayOf<si::Current> actual{(1.0 + 2.0i) * ampere, (3.0 - 4.0i) * ampere};
+
+  EXPECT_DOUBLE_EQ(1.0, actual.real().data()[0]);
+  EXPECT_DOUBLE_EQ(3.0, actual.real().data()[1]);
+  EXPECT_DOUBLE_EQ(2.0, actual.imag().data()[0]);
+  EXPECT_DOUBLE_EQ(-4.0, actual.imag().data()[1]);
+}
+
+TEST(TestComplexArray, RealAndImagViewsKeepUnits) {
+  poids::ComplexArrayOf<si::Current> actual(2);
+
+  actual.real()[0] = 5.0 * ampere;
+  actual.imag()[1] = -2.0 * ampere;
+
+  EXPECT_TRUE((std::is_same_v<poids::SpanOf<si::Current>, decltype(actual.real())>));
+  EXPECT_EQ(5.0 + 0.0i, actual[0].base());
+  EXPECT_EQ(0.0 - 2.0i, actual[1].base());
+}
+
+TEST(TestComplexArray, SetElement) {
+  poids::ComplexArrayOf<si::Length> actual(2);
+
+  actual.set(1, (1.5 + 0.5i) * meter);
+
+  EXPECT_EQ(1.5 + 0.5i, actual[1].base());
+}
+
+TEST(TestComplexArray, Abs) {
+  poids::ComplexArrayOf<si::Voltage> value{(3.0 + 4.0i) * volt, (-5.0 + 12.0i) * volt};
+
+  auto actual = value.abs();
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Voltage>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(5.0, actual[0].as(volt));
+  EXPECT_DOUBLE_EQ(13.0, actual[1].as(volt));
+}
+
+TEST(TestComplexArray, Norm) {
+  poids::ComplexArrayOf<si::Length> value{(3.0 + 4.0i) * meter};
+
+  auto actual = value.norm();
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Area>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(25.0, actual[0].as(meter2));
+}
+
+TEST(TestComplexArray, Conjugate) {
+  poids::ComplexArrayOf<si::Voltage> value{(3.0 + 4.0i) * volt};
+
+  auto actual = value.conj();
+
+  EXPECT_EQ(3.0 - 4.0i, actual[0].base());
+}
+
+TEST(TestComplexArrayArithmetic, MultiplyMatchesScalarComplex) {
+  CpxDbl v0 = 230.0 + 10.0i;
+  CpxDbl v1 = -5.0 + 2.5i;
+  CpxDbl i0 = 4.0 - 1.0i;
+  CpxDbl i1 = 0.5 + 3.0i;
+  poids::ComplexArrayOf<si::Voltage> voltage{v0 * volt, v1 * volt};
+  poids::ComplexArrayOf<si::Current> current{i0 * ampere, i1 * ampere};
+
+  auto actual = voltage * current;
+
+  EXPECT_TRUE((std::is_same_v<poids::ComplexArrayOf<si::Power>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ((v0 * i0).real(), actual[0].realBase());
+  EXPECT_DOUBLE_EQ((v0 * i0).imag(), actual[0].imagBase());
+  EXPECT_DOUBLE_EQ((v1 * i1).real(), actual[1].realBase());
+  EXPECT_DOUBLE_EQ((v1 * i1).imag(), actual[1].imagBase());
+}
+
+TEST(TestComplexArrayArithmetic, MultiplyConjugate) {
+  CpxDbl v = 230.0 + 10.0i;
+  CpxDbl i = 4.0 - 1.0i;
+  poids::ComplexArrayOf<si::Voltage> voltage{v * volt};
+  poids::ComplexArrayOf<si::Current> current{i * ampere};
+
+  auto actual = voltage.multiplyConjugate(current);
+
+  EXPECT_TRUE((std::is_same_v<poids::ComplexArrayOf<si::Power>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ((v * std::conj(i)).real(), actual[0].real().as(watt));
+  EXPECT_DOUBLE_EQ((v * std::conj(i)).imag(), actual[0].imag().as(watt));
+}
+
+TEST(TestComplexArrayArithmetic, AddSubtractNegate) {
+  poids::ComplexArrayOf<si::Length> a{(1.0 + 1.0i) * meter};
+  poids::ComplexArrayOf<si::Length> b{(0.5 - 2.0i) * meter};
+
+  EXPECT_EQ(1.5 - 1.0i, (a + b)[0].base());
+  EXPECT_EQ(0.5 + 3.0i, (a - b)[0].base());
+  EXPECT_EQ(-1.0 - 1.0i, (-a)[0].base());
+}
+
+TEST(TestComplexArrayArithmetic, Scale) {
+  poids::ComplexArrayOf<si::Current> current{(1.0 + 2.0i) * ampere};
+
+  auto doubled = 2.0 * current;
+  auto voltage = current * (10.0 * ohm);
+  auto rotated = current * (1.0i * si::Unitless::BaseType{1.0});
+
+  EXPECT_EQ(2.0 + 4.0i, doubled[0].base());
+  EXPECT_TRUE((std::is_same_v<poids::ComplexArrayOf<si::Voltage>, decltype(voltage)>));
+  EXPECT_EQ(10.0 + 20.0i, voltage[0].base());
+  EXPECT_EQ(-2.0 + 1.0i, rotated[0].base());
+}
@@ -395,3 +395,19 @@ TEST(TestComplexArithmeticSupport, DivideDoubleComplexQuantity) {
   EXPECT_NEAR(expected.realBase(), actual.realBase(), 1e-6);
   EXPECT_NEAR(expected.imagBase(), actual.imagBase(), 1e-6);
 }
+
+TEST(TestComplexSupport, Pow) {
+  auto a = si::LengthOf<CpxDbl>::makeFromBaseUnitValue(1.0 + 1.0i);
+
+  auto square = poids::pow<2, 1>(a);
+  auto root = poids::sqrt(poids::pow<2, 1>(a));
+  auto cubeRoot = poids::pow<1, 3>(poids::pow<3, 1>(a));
+
+  EXPECT_TRUE((std::is_same_v<si::AreaOf<CpxDbl>, decltype(square)>));
+  EXPECT_DOUBLE_EQ(0.0, square.realBase());
+  EXPECT_DOUBLE_EQ(2.0, square.imagBase());
+  EXPECT_DOUBLE_EQ(1.0, root.realBase());
+  EXPECT_DOUBLE_EQ(1.0, root.imagBase());
+  EXPECT_NEAR(1.0, cubeRoot.realBase(), 1e-12);
+  EXPECT_NEAR(1.0, cubeRoot.imagBase(), 1e-12);
+}
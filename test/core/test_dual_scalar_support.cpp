@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <type_traits>
+
+#include "poids/math/transcendental.hpp"
+#include "poids/scalar_support/dual.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  using Dual2 = poids::Dual<double, 2>;
+
+  /** Darcy-Weisbach pressure drop of a pipe */
+  template <typename Scalar>
+  si::PressureOf<Scalar> pressureDrop(si::LengthOf<Scalar> length, si::VelocityOf<Scalar> velocity) {
+    const double friction = 0.02;
+    const si::Length diameter = 0.1 * meter;
+    const si::Density density = 1000.0 * kilogram / poids::pow<3, 1>(meter);
+    return friction * length / diameter * density * velocity * velocity / 2.0;
+  }
+}  // namespace
+
+static_assert(std::is_same_v<Dual2, poids::detail::MultiplyResult_t<double, Dual2>>);
+static_assert(std::is_same_v<Dual2, poids::detail::DivideResult_t<Dual2, double>>);
+
+TEST(TestDualSupport, ArithmeticAppliesTheChainRule) {
+  const Dual2 x = Dual2::variable(3.0, 0);
+  const Dual2 y = Dual2::variable(2.0, 1);
+
+  const Dual2 f = x * x * y - x / y + 4.0;
+
+  EXPECT_DOUBLE_EQ(3.0 * 3.0 * 2.0 - 1.5 + 4.0, f.value());
+  EXPECT_DOUBLE_EQ(2.0 * 3.0 * 2.0 - 1.0 / 2.0, f.derivative(0));
+  EXPECT_DOUBLE_EQ(3.0 * 3.0 + 3.0 / 4.0, f.derivative(1));
+  EXPECT_TRUE(x > y);
+}
+
+TEST(TestDualSupport, Functions) {
+  const Dual2 x = Dual2::variable(0.5, 0);
+
+  EXPECT_DOUBLE_EQ(1.0 / (2.0 * std::sqrt(0.5)), sqrt(x).derivative(0));
+  EXPECT_DOUBLE_EQ(std::exp(0.5), exp(x).derivative(0));
+  EXPECT_DOUBLE_EQ(2.0, log(x).derivative(0));
+  EXPECT_DOUBLE_EQ(std::cos(0.5), sin(x).derivative(0));
+  EXPECT_DOUBLE_EQ(-std::sin(0.5), cos(x).derivative(0));
+  EXPECT_DOUBLE_EQ(1.5 * std::sqrt(0.5), pow(x, 1.5).derivative(0));
+  EXPECT_DOUBLE_EQ(-1.0, abs(x - 1.0).derivative(0));
+  EXPECT_DOUBLE_EQ(0.0, sqrt(x).derivative(1));
+}
+
+TEST(TestDualSupport, DerivativesHaveUnits) {
+  const auto length = poids::makeVariable<2>(si::Length{250.0 * meter}, 0);
+  const auto velocity = poids::makeVariable<2>(si::Velocity{1.5 * meter / second}, 1);
+
+  const auto drop = pressureDrop(length, velocity);
+
+  const auto byLength = drop.derivative<si::Length>(0);
+  const auto byVelocity = drop.derivative<si::Velocity>(1);
+
+  EXPECT_TRUE((std::is_same_v<si::PressureOf<Dual2>, std::remove_const_t<decltype(drop)>>));
+  EXPECT_TRUE((std::is_same_v<decltype(si::Pressure{} / si::Length{}), std::remove_const_t<decltype(byLength)>>));
+  EXPECT_TRUE((std::is_same_v<decltype(si::Pressure{} / si::Velocity{}), std::remove_const_t<decltype(byVelocity)>>));
+  EXPECT_DOUBLE_EQ(pressureDrop<double>(250.0 * meter, 1.5 * meter / second).as(pascal), drop.primal().as(pascal));
+  EXPECT_DOUBLE_EQ(0.02 / 0.1 * 1000.0 * 1.5 * 1.5 / 2.0, byLength.as(pascal / meter));
+  EXPECT_DOUBLE_EQ(0.02 * 250.0 / 0.1 * 1000.0 * 1.5, byVelocity.as(pascal * second / meter));
+}
+
+TEST(TestDualSupport, PowersAndUnitlessFunctions) {
+  const auto area = poids::makeVariable<1>(si::Area{4.0 * meter * meter}, 0);
+  const auto ratio = poids::makeVariable<1>(si::Unitless{0.25}, 0);
+
+  const auto side = poids::sqrt(area);
+  const auto growth = poids::exp(ratio);
+
+  EXPECT_DOUBLE_EQ(2.0, side.primal().as(meter));
+  EXPECT_DOUBLE_EQ(0.25, side.derivative<si::Area>(0).as(meter / (meter * meter)));
+  EXPECT_DOUBLE_EQ(std::exp(0.25), growth.derivative<si::Unitless>(0).base());
+}
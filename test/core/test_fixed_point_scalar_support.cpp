@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/scalar_support/fixed_point.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  using Q16 = poids::Fixed32<16>;
+  using WrappingQ16 = poids::Fixed32<16, poids::Wrap>;
+}  // namespace
+
+static_assert(std::is_same_v<Q16, poids::detail::MultiplyResult_t<Q16, Q16>>);
+static_assert(std::is_same_v<Q16, poids::detail::DivideResult_t<Q16, int>>);
+static_assert(std::is_same_v<Q16, poids::detail::MultiplyResult_t<double, Q16>>);
+static_assert(Q16{1.5}.raw() == 3 << 15);
+static_assert(poids::IsLayoutCompatible_v<si::LengthOf<Q16>>);
+
+TEST(TestFixedPointSupport, ConvertsToAndFromDouble) {
+  EXPECT_EQ(1 << 16, Q16{1}.raw());
+  EXPECT_EQ(-(1 << 15), Q16{-0.5}.raw());
+  EXPECT_EQ(1, Q16{1.0 / 65536.0 * 0.75}.raw());
+  EXPECT_DOUBLE_EQ(-2.25, static_cast<double>(Q16{-2.25}));
+  EXPECT_EQ(std::numeric_limits<std::int32_t>::max(), Q16{1.0e9}.raw());
+  EXPECT_EQ(0, Q16{std::numeric_limits<double>::quiet_NaN()}.raw());
+}
+
+TEST(TestFixedPointSupport, ArithmeticIsExactOrRounded) {
+  EXPECT_EQ(Q16{3.75}, Q16{1.5} + Q16{2.25});
+  EXPECT_EQ(Q16{-0.75}, Q16{1.5} - Q16{2.25});
+  EXPECT_EQ(Q16{3.375}, Q16{1.5} * Q16{2.25});
+  EXPECT_EQ(Q16{0.75}, Q16{1.5} / 2);
+  EXPECT_EQ(Q16::fromRaw(1), Q16::fromRaw(1) * Q16{0.5});
+  EXPECT_EQ(Q16::fromRaw(21845), Q16{1} / Q16{3});
+  EXPECT_EQ(Q16{-3}, Q16{-1.5} * 2);
+}
+
+TEST(TestFixedPointSupport, IntegersBeyondRangeAreExact) {
+  EXPECT_NEAR(100.7, static_cast<double>(Q16{0.001} * 100000), 0.01);
+  EXPECT_NEAR(100.7, static_cast<double>(100000 * Q16{0.001}), 0.01);
+  EXPECT_EQ(Q16::fromRaw(655), Q16{1000} / 100000);
+  EXPECT_EQ(Q16::fromRaw(-655), Q16{-1000} / 100000);
+  EXPECT_EQ(Q16{}, Q16{1000} / (std::uint64_t{1} << 63));
+  EXPECT_EQ(Q16::fromRaw(std::numeric_limits<std::int32_t>::max()), Q16{1} * (std::uint64_t{1} << 63));
+  EXPECT_EQ(Q16::fromRaw(std::numeric_limits<std::int32_t>::lowest()), Q16{-1} * 100000);
+  EXPECT_EQ(Q16::fromRaw(std::numeric_limits<std::int32_t>::lowest()), Q16::fromRaw(-1) * (std::int64_t{1} << 40));
+  EXPECT_EQ(Q16::fromRaw(std::numeric_limits<std::int32_t>::max()), Q16::fromRaw(-1) * -(std::int64_t{1} << 40));
+  EXPECT_EQ(Q16::fromRaw(std::numeric_limits<std::int32_t>::lowest()), Q16::fromRaw(-1) * (std::uint64_t{1} << 63));
+  EXPECT_EQ(Q16{}, Q16{} * (std::int64_t{1} << 40));
+  EXPECT_EQ(WrappingQ16::fromRaw(15), WrappingQ16::fromRaw(3) * ((std::int64_t{1} << 32) + 5));
+}
+
+TEST(TestFixedPointSupport, SaturatesOnOverflow) {
+  const Q16 large{30000};
+  const Q16 highest = Q16::fromRaw(std::numeric_limits<std::int32_t>::max());
+  const Q16 lowest = Q16::fromRaw(std::numeric_limits<std::int32_t>::lowest());
+
+  EXPECT_EQ(highest, large + large);
+  EXPECT_EQ(lowest, -large - large);
+  EXPECT_EQ(highest, large * large);
+  EXPECT_EQ(highest, -lowest);
+  EXPECT_EQ(highest, Q16{std::uint64_t{1} << 40});
+}
+
+TEST(TestFixedPointSupport, WrapsOnOverflow) {
+  const WrappingQ16 large{30000};
+
+  EXPECT_EQ(WrappingQ16{60000 - 65536}, large + large);
+  EXPECT_EQ(WrappingQ16{-32768}, -WrappingQ16{-32768});
+}
+
+TEST(TestFixedPointSupport, QuantityArithmetic) {
+  const si::LengthOf<Q16> length = meter * Q16{2.5};
+  const si::TimeOf<Q16> time = second * Q16{0.5};
+
+  auto velocity = length / time;
+
+  EXPECT_TRUE((std::is_same_v<si::VelocityOf<Q16>, decltype(velocity)>));
+  EXPECT_EQ(5 << 16, velocity.rawBase());
+  EXPECT_DOUBLE_EQ(2500.0, static_cast<double>(length.as(milli(meter))));
+  EXPECT_DOUBLE_EQ(5.0, velocity.toDouble().as(meter / second));
+  EXPECT_TRUE(length > si::LengthOf<Q16>::makeFromBaseUnitValue(Q16{2}));
+}
+
+TEST(TestFixedPointSupport, Arrays) {
+  poids::ArrayOf<si::CurrentOf<Q16>> current(4, ampere * Q16{1.5});
+  poids::ArrayOf<si::VoltageOf<Q16>> voltage(4, volt * Q16{-2});
+
+  poids::ArrayOf<si::PowerOf<Q16>> power = current * voltage;
+
+  for (std::size_t i = 0; i < power.size(); ++i) {
+    EXPECT_EQ(Q16{-3}, power[i].base());
+  }
+}
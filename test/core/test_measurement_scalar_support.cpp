@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <type_traits>
+
+#include "poids/scalar_support/measurement.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  using Measured = poids::Measurement<double>;
+}  // namespace
+
+static_assert(std::is_same_v<Measured, poids::detail::MultiplyResult_t<double, Measured>>);
+static_assert(std::is_same_v<Measured, poids::detail::AddResult_t<Measured, Measured>>);
+
+TEST(TestMeasurementSupport, IndependentUncertaintiesAddInQuadrature) {
+  const Measured x{10.0, 0.3};
+  const Measured y{4.0, 0.4};
+
+  EXPECT_DOUBLE_EQ(0.5, (x + y).uncertainty());
+  EXPECT_DOUBLE_EQ(0.5, (x - y).uncertainty());
+  EXPECT_DOUBLE_EQ(std::hypot(0.3 * 4.0, 0.4 * 10.0), (x * y).uncertainty());
+  EXPECT_DOUBLE_EQ(2.5 * std::hypot(0.3 / 10.0, 0.4 / 4.0), (x / y).uncertainty());
+  EXPECT_DOUBLE_EQ(0.6, (2.0 * x).uncertainty());
+  EXPECT_DOUBLE_EQ(0.0, covariance(x, y));
+  EXPECT_DOUBLE_EQ(0.0, Measured{3.0}.uncertainty());
+}
+
+TEST(TestMeasurementSupport, CorrelationsArePropagated) {
+  const Measured x{10.0, 0.3};
+  const Measured y{4.0, 0.4};
+  const Measured sum = x + y;
+
+  EXPECT_DOUBLE_EQ(0.0, (x - x).uncertainty());
+  EXPECT_DOUBLE_EQ(0.6, (x + x).uncertainty());
+  EXPECT_DOUBLE_EQ(0.0, (x / x).uncertainty());
+  EXPECT_DOUBLE_EQ(0.4, (sum - x).uncertainty());
+  EXPECT_DOUBLE_EQ(0.09, covariance(sum, x));
+  EXPECT_DOUBLE_EQ(0.6, correlation(sum, x));
+}
+
+TEST(TestMeasurementSupport, Functions) {
+  const Measured x{4.0, 0.2};
+
+  EXPECT_DOUBLE_EQ(2.0, sqrt(x).value());
+  EXPECT_DOUBLE_EQ(0.05, sqrt(x).uncertainty());
+  EXPECT_DOUBLE_EQ(0.05, log(x).uncertainty());
+  EXPECT_DOUBLE_EQ(std::exp(4.0) * 0.2, exp(x).uncertainty());
+  EXPECT_DOUBLE_EQ(1.5 * 2.0 * 0.2, pow(x, 1.5).uncertainty());
+}
+
+TEST(TestMeasurementSupport, UncertaintyHasTheUnitOfTheQuantity) {
+  const auto voltage = poids::makeMeasurement(si::Voltage{12.0 * volt}, si::Voltage{50.0 * milli(volt)});
+  const auto resistance = poids::makeMeasurement(si::Resistance{100.0 * ohm}, si::Resistance{1.0 * ohm});
+
+  const auto power = voltage * voltage / resistance;
+  const auto current = poids::sqrt(power / resistance);
+
+  EXPECT_TRUE((std::is_same_v<si::PowerOf<Measured>, std::remove_const_t<decltype(power)>>));
+  EXPECT_TRUE((std::is_same_v<si::Power, decltype(power.uncertainty())>));
+  EXPECT_DOUBLE_EQ(1.44, power.nominal().as(watt));
+  EXPECT_NEAR(1.44 * std::hypot(2.0 * 0.05 / 12.0, 0.01), power.uncertainty().as(watt), 1e-15);
+  EXPECT_NEAR(0.12 * std::hypot(0.05 / 12.0, 0.01), current.uncertainty().as(ampere), 1e-15);
+  EXPECT_NEAR(std::hypot(0.05 / 12.0, 0.01), current.relativeUncertainty(), 1e-15);
+}
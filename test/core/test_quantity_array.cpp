@@ -0,0 +1,287 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+TEST(TestQuantityArray, DefaultConstructEmpty) {
+  poids::ArrayOf<si::Length> actual;
+
+  EXPECT_TRUE(actual.empty());
+  EXPECT_EQ(0u, actual.size());
+}
+
+TEST(TestQuantityArray, ConstructWithSizeIsZeroed) {
+  poids::ArrayOf<si::Mass> actual(4);
+
+  ASSERT_EQ(4u, actual.size());
+  for (si::Mass value : actual) {
+    EXPECT_DOUBLE_EQ(0.0, value.as(kilogram));
+  }
+}
+
+TEST(TestQuantityArray, ConstructWithValue) {
+  si::Time expected = 2.5 * second;
+
+  poids::ArrayOf<si::Time> actual(3, expected);
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_EQ(expected, actual[0]);
+  EXPECT_EQ(expected, actual[1]);
+  EXPECT_EQ(expected, actual[2]);
+}
+
+TEST(TestQuantityArray, ConstructFromInitializerList) {
+  poids::ArrayOf<si::Length> actual{1.0 * meter, 2.0 * milli(meter), 3.0 * kilo(meter)};
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_DOUBLE_EQ(1.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(2.0, actual[1].as(milli(meter)));
+  EXPECT_DOUBLE_EQ(3.0, actual[2].as(kilo(meter)));
+}
+
+TEST(TestQuantityArray, ConstructFromQuantityRange) {
+  std::vector<si::Current> expected{1.0 * ampere, 2.0 * ampere, 4.0 * ampere};
+
+  poids::ArrayOf<si::Current> actual(expected.begin(), expected.end());
+
+  ASSERT_EQ(expected.size(), actual.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i], actual[i]);
+  }
+}
+
+TEST(TestQuantityArray, StoresBaseUnitValuesContiguously) {
+  auto actual = poids::ArrayOf<si::Length>::makeFromBaseUnitValues({1.0, 2.0, 3.0});
+
+  EXPECT_DOUBLE_EQ(1.0, actual.data()[0]);
+  EXPECT_DOUBLE_EQ(2.0, actual.data()[1]);
+  EXPECT_DOUBLE_EQ(3.0, actual.data()[2]);
+  EXPECT_EQ(actual.data() + 1, &actual[1].base());
+}
+
+TEST(TestQuantityArray, ExchangesStandardVectors) {
+  const std::vector<double> meters{1.0, 2.5};
+  const auto actual = poids::ArrayOf<si::Length>::makeFromBaseUnitValues(meters);
+
+  const std::vector<double> millimeters = actual.as(milli(meter));
+
+  EXPECT_DOUBLE_EQ(1000.0, millimeters[0]);
+  EXPECT_DOUBLE_EQ(2500.0, millimeters[1]);
+}
+
+TEST(TestQuantityArray, TakesOverBuffers) {
+  poids::ArrayOf<si::Length>::Buffer meters(3);
+  meters[0] = 1.0;
+  meters[1] = 2.0;
+  meters[2] = 3.0;
+  const double* values = meters.data();
+
+  const auto actual = poids::ArrayOf<si::Length>::makeFromBaseUnitValues(std::move(meters));
+
+  EXPECT_EQ(values, actual.data());
+  EXPECT_DOUBLE_EQ(2.0, actual[1].as(meter));
+}
+
+TEST(TestQuantityArray, IndexModifiesInPlace) {
+  poids::ArrayOf<si::Velocity> actual(2);
+
+  actual[1] = 3.0 * meter / second;
+
+  EXPECT_DOUBLE_EQ(0.0, actual[0].as(meter / second));
+  EXPECT_DOUBLE_EQ(3.0, actual[1].as(meter / second));
+}
+
+TEST(TestQuantityArray, IterateModifiesInPlace) {
+  poids::ArrayOf<si::Force> actual(3);
+
+  for (auto element : actual) {
+    element = 7.0 * newton;
+  }
+
+  for (si::Force value : actual) {
+    EXPECT_DOUBLE_EQ(7.0, value.as(newton));
+  }
+}
+
+TEST(TestQuantityArray, IteratorsAreRandomAccess) {
+  const poids::ArrayOf<si::Length> actual{1.0 * meter, 2.0 * meter, 3.0 * meter, 4.0 * meter};
+
+  auto first = actual.begin();
+  auto last = actual.end();
+
+  EXPECT_EQ(4, last - first);
+  EXPECT_DOUBLE_EQ(3.0, (*(first + 2)).as(meter));
+  EXPECT_DOUBLE_EQ(4.0, first[3].as(meter));
+  EXPECT_TRUE(first < last);
+}
+
+TEST(TestQuantityArray, Fill) {
+  poids::ArrayOf<si::Pressure> actual(5);
+
+  actual.fill(101.325 * kilo(pascal));
+
+  for (si::Pressure value : actual) {
+    EXPECT_DOUBLE_EQ(101325.0, value.as(pascal));
+  }
+}
+
+TEST(TestQuantityArrayArithmetic, Add) {
+  poids::ArrayOf<si::Length> lhs{1.0 * meter, 2.0 * meter, 3.0 * meter};
+  poids::ArrayOf<si::Length> rhs{10.0 * meter, 20.0 * meter, 30.0 * meter};
+
+  poids::QuantityArray actual = lhs + rhs;
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Length>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(11.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(22.0, actual[1].as(meter));
+  EXPECT_DOUBLE_EQ(33.0, actual[2].as(meter));
+}
+
+TEST(TestQuantityArrayArithmetic, Subtract) {
+  poids::ArrayOf<si::Time> lhs{5.0 * second, 6.0 * second};
+  poids::ArrayOf<si::Time> rhs{1.0 * second, 8.0 * second};
+
+  auto actual = lhs - rhs;
+
+  EXPECT_DOUBLE_EQ(4.0, actual[0].as(second));
+  EXPECT_DOUBLE_EQ(-2.0, actual[1].as(second));
+}
+
+TEST(TestQuantityArrayArithmetic, Negate) {
+  poids::ArrayOf<si::Energy> value{5.0 * joule, -6.0 * joule};
+
+  auto actual = -value;
+
+  EXPECT_DOUBLE_EQ(-5.0, actual[0].as(joule));
+  EXPECT_DOUBLE_EQ(6.0, actual[1].as(joule));
+}
+
+TEST(TestQuantityArrayArithmetic, ScalarMultiply) {
+  poids::ArrayOf<si::Mass> value{1.0 * kilogram, 2.0 * kilogram};
+
+  poids::QuantityArray actual1 = value * 3.0;
+  poids::QuantityArray actual2 = 3.0 * value;
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Mass>, decltype(actual1)>));
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Mass>, decltype(actual2)>));
+  EXPECT_DOUBLE_EQ(6.0, actual1[1].as(kilogram));
+  EXPECT_DOUBLE_EQ(6.0, actual2[1].as(kilogram));
+}
+
+TEST(TestQuantityArrayArithmetic, ScalarDivide) {
+  poids::ArrayOf<si::Mass> value{1.0 * kilogram, 2.0 * kilogram};
+
+  auto actual = value / 4.0;
+
+  EXPECT_DOUBLE_EQ(0.25, actual[0].as(kilogram));
+  EXPECT_DOUBLE_EQ(0.5, actual[1].as(kilogram));
+}
+
+TEST(TestQuantityArrayArithmetic, MultiplyArraysProducesNewUnit) {
+  poids::ArrayOf<si::Voltage> voltage{2.0 * volt, 3.0 * volt};
+  poids::ArrayOf<si::Current> current{4.0 * ampere, 5.0 * ampere};
+
+  poids::QuantityArray actual = voltage * current;
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Power>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(8.0, actual[0].as(watt));
+  EXPECT_DOUBLE_EQ(15.0, actual[1].as(watt));
+}
+
+TEST(TestQuantityArrayArithmetic, DivideArraysProducesNewUnit) {
+  poids::ArrayOf<si::Length> length{10.0 * meter, 9.0 * meter};
+  poids::ArrayOf<si::Time> time{2.0 * second, 3.0 * second};
+
+  poids::QuantityArray actual = length / time;
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Velocity>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(5.0, actual[0].as(meter / second));
+  EXPECT_DOUBLE_EQ(3.0, actual[1].as(meter / second));
+}
+
+TEST(TestQuantityArrayArithmetic, MultiplyByQuantity) {
+  poids::ArrayOf<si::Mass> mass{1.0 * kilogram, 2.0 * kilogram};
+  si::Acceleration g = 9.81 * meter / square(second);
+
+  poids::QuantityArray actual1 = mass * g;
+  poids::QuantityArray actual2 = g * mass;
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Force>, decltype(actual1)>));
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Force>, decltype(actual2)>));
+  EXPECT_DOUBLE_EQ(19.62, actual1[1].as(newton));
+  EXPECT_DOUBLE_EQ(19.62, actual2[1].as(newton));
+}
+
+TEST(TestQuantityArrayArithmetic, DivideByQuantity) {
+  poids::ArrayOf<si::Length> length{10.0 * meter, 20.0 * meter};
+  si::Time time = 5.0 * second;
+
+  poids::QuantityArray actual1 = length / time;
+  poids::QuantityArray actual2 = time / length;
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Velocity>, decltype(actual1)>));
+  EXPECT_DOUBLE_EQ(4.0, actual1[1].as(meter / second));
+  EXPECT_DOUBLE_EQ(0.25, actual2[1].as(second / meter));
+}
+
+TEST(TestQuantityArrayArithmetic, CompoundAssignment) {
+  poids::ArrayOf<si::Length> actual{1.0 * meter, 2.0 * meter};
+  poids::ArrayOf<si::Length> other{0.5 * meter, 0.5 * meter};
+
+  actual += other;
+  EXPECT_DOUBLE_EQ(2.5, actual[1].as(meter));
+
+  actual -= other;
+  EXPECT_DOUBLE_EQ(2.0, actual[1].as(meter));
+
+  actual *= 4.0;
+  EXPECT_DOUBLE_EQ(8.0, actual[1].as(meter));
+
+  actual /= 2.0;
+  EXPECT_DOUBLE_EQ(4.0, actual[1].as(meter));
+}
+
+TEST(TestQuantityArrayConversion, AsDesiredUnits) {
+  poids::ArrayOf<si::Length> length{1.0 * meter, 2.5 * meter, -0.25 * meter};
+
+  auto actual = length.as(milli(meter));
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_DOUBLE_EQ(1000.0, actual[0]);
+  EXPECT_DOUBLE_EQ(2500.0, actual[1]);
+  EXPECT_DOUBLE_EQ(-250.0, actual[2]);
+}
+
+TEST(TestQuantityArrayConversion, AsIntoBuffer) {
+  poids::ArrayOf<si::Force> force{1500.0 * newton, 20.0 * newton};
+  double actual[2] = {};
+
+  force.as(kilo(newton), actual);
+
+  EXPECT_DOUBLE_EQ(1.5, actual[0]);
+  EXPECT_DOUBLE_EQ(0.02, actual[1]);
+}
+
+TEST(TestQuantityArrayConversion, FromUnits) {
+  const double values[] = {101.325, 2.0};
+
+  auto actual = poids::ArrayOf<si::Pressure>::from(values, 2, kilo(pascal));
+
+  ASSERT_EQ(2u, actual.size());
+  EXPECT_DOUBLE_EQ(101325.0, actual[0].as(pascal));
+  EXPECT_DOUBLE_EQ(2000.0, actual[1].as(pascal));
+}
+
+TEST(TestQuantityArrayConversion, FloatArrayWithDoubleUnits) {
+  poids::ArrayOf<si::LengthOf<float>> length{poids::makeBase<si::LengthOf<float>>(1.5f)};
+
+  auto actual = length.as(milli(meter));
+
+  EXPECT_FLOAT_EQ(1500.0f, actual[0]);
+}
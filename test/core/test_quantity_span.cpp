@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <iterator>
+#include <vector>
+
+#include "poids/core/quantity_span.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+static_assert(poids::IsLayoutCompatible_v<si::Length>);
+static_assert(poids::IsLayoutCompatible_v<si::Length::BaseType>);
+static_assert(poids::IsLayoutCompatible_v<si::LengthOf<float>>);
+static_assert(poids::IsLayoutCompatible_v<si::PowerOf<std::complex<double>>>);
+
+TEST(TestQuantitySpan, ViewRawBuffer) {
+  double buffer[] = {1.0, 2.0, 3.0};
+
+  auto actual = poids::SpanOf<si::Length>::makeFromBaseUnitValues(buffer, 3);
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_DOUBLE_EQ(1.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(2000.0, actual[1].as(milli(meter)));
+  EXPECT_DOUBLE_EQ(3.0, actual[2].as(meter));
+}
+
+TEST(TestQuantitySpan, ModifiesRawBuffer) {
+  float buffer[] = {0.0f, 0.0f};
+
+  auto actual = poids::SpanOf<si::TimeOf<float>>::makeFromBaseUnitValues(buffer, 2);
+  actual[1] = si::TimeOf<float>::makeFromBaseUnitValue(4.0f);
+
+  EXPECT_FLOAT_EQ(0.0f, buffer[0]);
+  EXPECT_FLOAT_EQ(4.0f, buffer[1]);
+}
+
+TEST(TestQuantitySpan, StridedView) {
+  double interleaved[] = {1.0, -1.0, 2.0, -2.0, 3.0, -3.0};
+
+  auto actual = poids::ConstSpanOf<si::Current>::makeFromBaseUnitValues(interleaved + 1, 3, 2);
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_FALSE(actual.isContiguous());
+  EXPECT_DOUBLE_EQ(-1.0, actual[0].as(ampere));
+  EXPECT_DOUBLE_EQ(-2.0, actual[1].as(ampere));
+  EXPECT_DOUBLE_EQ(-3.0, actual[2].as(ampere));
+}
+
+TEST(TestQuantitySpan, IterateStrided) {
+  double interleaved[] = {1.0, -1.0, 2.0, -2.0, 3.0, -3.0};
+  auto span = poids::SpanOf<si::Mass>::makeFromBaseUnitValues(interleaved, 3, 2);
+
+  for (auto element : span) {
+    element = 10.0 * kilogram;
+  }
+
+  EXPECT_EQ(3, span.end() - span.begin());
+  EXPECT_DOUBLE_EQ(10.0, interleaved[0]);
+  EXPECT_DOUBLE_EQ(-1.0, interleaved[1]);
+  EXPECT_DOUBLE_EQ(10.0, interleaved[2]);
+  EXPECT_DOUBLE_EQ(-2.0, interleaved[3]);
+  EXPECT_DOUBLE_EQ(10.0, interleaved[4]);
+  EXPECT_DOUBLE_EQ(-3.0, interleaved[5]);
+}
+
+TEST(TestQuantitySpan, IterateLastComponentOfFrames) {
+  const double interleaved[] = {1.0, -1.0, 2.0, -2.0, 3.0, -3.0};
+  const auto span = poids::ConstSpanOf<si::Current>::makeFromBaseUnitValues(interleaved + 1, 3, 2);
+
+  double sum = 0.0;
+  for (auto it = span.end(); it != span.begin();) {
+    --it;
+    sum += (*it).as(ampere);
+  }
+
+  EXPECT_EQ(3, std::distance(span.begin(), span.end()));
+  EXPECT_DOUBLE_EQ(-3.0, (*(span.end() - 1)).as(ampere));
+  EXPECT_DOUBLE_EQ(-6.0, sum);
+  EXPECT_TRUE(span.subspan(3, 0).empty());
+}
+
+TEST(TestQuantitySpan, ViewQuantityArray) {
+  poids::ArrayOf<si::Energy> array{1.0 * joule, 2.0 * joule};
+
+  poids::QuantitySpan actual = array;
+  actual[0] = 5.0 * joule;
+
+  EXPECT_TRUE((std::is_same_v<poids::SpanOf<si::Energy>, decltype(actual)>));
+  EXPECT_EQ(array.data(), actual.data());
+  EXPECT_DOUBLE_EQ(5.0, array[0].as(joule));
+}
+
+TEST(TestQuantitySpan, ViewConstQuantityArray) {
+  const poids::ArrayOf<si::Energy> array{1.0 * joule, 2.0 * joule};
+
+  poids::QuantitySpan actual = array;
+
+  EXPECT_TRUE((std::is_same_v<poids::ConstSpanOf<si::Energy>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(2.0, actual[1].as(joule));
+}
+
+TEST(TestQuantitySpan, ConvertMutableToConst) {
+  double buffer[] = {1.0, 2.0};
+  auto mutableSpan = poids::SpanOf<si::Area>::makeFromBaseUnitValues(buffer, 2);
+
+  poids::ConstSpanOf<si::Area> actual = mutableSpan;
+
+  EXPECT_EQ(buffer, actual.data());
+  EXPECT_EQ(2u, actual.size());
+}
+
+TEST(TestQuantitySpan, ViewVectorOfQuantitiesWithoutCopy) {
+  std::vector<si::Velocity> quantities{1.0 * meter / second, 2.0 * meter / second};
+
+  auto actual = poids::makeSpan(quantities);
+  actual[1] = 4.0 * meter / second;
+
+  EXPECT_EQ(&quantities[0].data(), actual.data());
+  EXPECT_DOUBLE_EQ(1.0, actual.data()[0]);
+  EXPECT_DOUBLE_EQ(4.0, quantities[1].as(meter / second));
+}
+
+TEST(TestQuantitySpan, Subspan) {
+  double buffer[] = {1.0, 2.0, 3.0, 4.0, 5.0};
+  auto span = poids::SpanOf<si::Length>::makeFromBaseUnitValues(buffer, 5);
+
+  auto actual = span.subspan(1, 3);
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_DOUBLE_EQ(2.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(4.0, actual[2].as(meter));
+}
+
+TEST(TestQuantitySpanConversion, StridedAsIntoBuffer) {
+  const double interleaved[] = {1.0, 2.0, 3.0, 4.0};
+  auto span = poids::ConstSpanOf<si::Length>::makeFromBaseUnitValues(interleaved + 1, 2, 2);
+  double actual[2] = {};
+
+  span.as(milli(meter), actual);
+
+  EXPECT_DOUBLE_EQ(2000.0, actual[0]);
+  EXPECT_DOUBLE_EQ(4000.0, actual[1]);
+}
+
+TEST(TestQuantitySpanConversion, AssignFromUnits) {
+  poids::ArrayOf<si::Length> length(2);
+  const double millimeters[] = {5.0, 250.0};
+
+  poids::SpanOf<si::Length>{length}.assign(millimeters, milli(meter));
+
+  EXPECT_DOUBLE_EQ(0.005, length[0].as(meter));
+  EXPECT_DOUBLE_EQ(0.25, length[1].as(meter));
+}
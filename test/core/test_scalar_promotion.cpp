@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/si.hpp"
+
+// Only this test uses long double, so narrowing it cannot affect other tests
+template <>
+struct poids::scalar::PromotionPolicy<float, long double> {
+  using type = poids::scalar::KeepNarrow;
+};
+
+template <>
+struct poids::scalar::PromotionPolicy<long double, float> {
+  using type = poids::scalar::KeepNarrow;
+};
+
+using namespace si::units;
+using namespace si::prefix;
+
+TEST(TestScalarPromotion, PromotesByDefault) {
+  const si::LengthOf<float> length = 2.0f * si::float_units::meter;
+
+  auto actual = length * 1.5;
+
+  EXPECT_TRUE((std::is_same_v<si::Length, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(3.0, actual.as(meter));
+}
+
+TEST(TestScalarPromotion, KeepNarrowComputesInFloat) {
+  const si::LengthOf<float> length = 2.0f * si::float_units::meter;
+  const si::TimeOf<long double> time = si::TimeOf<long double>::makeFromBaseUnitValue(4.0L);
+
+  auto scaled = length * 1.5L;
+  auto velocity = length / time;
+  auto sum = length + si::LengthOf<long double>::makeFromBaseUnitValue(1.0L);
+
+  EXPECT_TRUE((std::is_same_v<si::LengthOf<float>, decltype(scaled)>));
+  EXPECT_TRUE((std::is_same_v<si::VelocityOf<float>, decltype(velocity)>));
+  EXPECT_TRUE((std::is_same_v<si::LengthOf<float>, decltype(sum)>));
+  EXPECT_FLOAT_EQ(3.0f, scaled.base());
+  EXPECT_FLOAT_EQ(0.5f, velocity.base());
+  EXPECT_FLOAT_EQ(3.0f, sum.base());
+}
+
+TEST(TestScalarPromotion, KeepNarrowArrays) {
+  poids::ArrayOf<si::LengthOf<float>> length(5, 2.0f * si::float_units::meter);
+
+  poids::ArrayOf<si::LengthOf<float>> actual = length * 0.25L + length;
+
+  EXPECT_TRUE((std::is_same_v<float, poids::ScalarOf_t<decltype(length * 0.25L)>>));
+  EXPECT_FLOAT_EQ(2.5f, actual[4].base());
+}
+
+TEST(TestScalarPromotion, FloatUnitsAndPrefixes) {
+  auto energy = 1.5f * si::float_units::newton * si::float_units::meter;
+  auto length = 250.0f * milli(si::float_units::meter);
+
+  EXPECT_TRUE((std::is_same_v<si::EnergyOf<float>, decltype(energy)>));
+  EXPECT_TRUE((std::is_same_v<si::LengthOf<float>, decltype(length)>));
+  EXPECT_FLOAT_EQ(1.5f, energy.as(si::float_units::joule));
+  EXPECT_FLOAT_EQ(0.25f, length.as(si::float_units::meter));
+  EXPECT_FLOAT_EQ(250.0f, length.as(milli(si::float_units::meter)));
+}
+
+TEST(TestScalarPromotion, ScalarCastStoresNarrow) {
+  poids::ArrayOf<si::Length> wide(3, 0.5 * meter);
+
+  poids::ArrayOf<si::LengthOf<float>> narrow = poids::scalarCast<float>(wide * 3.0);
+
+  EXPECT_FLOAT_EQ(1.5f, narrow[2].base());
+}
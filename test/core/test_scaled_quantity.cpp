@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <ratio>
+#include <type_traits>
+
+#include "poids/core/scaled_quantity.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  using Millimeters = poids::Scaled<si::Length, std::milli>;
+  using Micrometers = poids::Scaled<si::Length, std::micro>;
+  using Kilometers = poids::Scaled<si::Length, std::kilo>;
+  using Milliseconds = poids::Scaled<si::Time, std::milli>;
+}  // namespace
+
+static_assert(poids::IsLayoutCompatible_v<Millimeters>);
+static_assert(poids::IsQuantity_v<Millimeters>);
+static_assert(Millimeters::makeFromScaledValue(1500.0).base() == 1.5);
+
+TEST(TestScaledQuantity, StoresNativeValue) {
+  auto actual = Millimeters::makeFromScaledValue(1500.0);
+
+  EXPECT_DOUBLE_EQ(1500.0, actual.value());
+  EXPECT_DOUBLE_EQ(1.5, actual.base());
+  EXPECT_DOUBLE_EQ(1500.0, actual.as(milli(meter)));
+  EXPECT_DOUBLE_EQ(1.5e-3, actual.as(kilo(meter)));
+}
+
+TEST(TestScaledQuantity, ConvertsBetweenScales) {
+  Millimeters length = 2.5 * meter;
+  Micrometers fine = length;
+  Kilometers coarse = length;
+  si::Length plain = fine;
+
+  EXPECT_DOUBLE_EQ(2500.0, length.value());
+  EXPECT_DOUBLE_EQ(2.5e6, fine.value());
+  EXPECT_DOUBLE_EQ(2.5e-3, coarse.value());
+  EXPECT_DOUBLE_EQ(2.5, plain.as(meter));
+}
+
+TEST(TestScaledQuantity, ViewsDeviceBuffer) {
+  const double raw[] = {1.0, 250.0, 1000.0};
+  Millimeters samples[3];
+  std::memcpy(samples, raw, sizeof(raw));
+
+  EXPECT_DOUBLE_EQ(250.0, samples[1].value());
+  EXPECT_TRUE(samples[2] == 1.0 * meter);
+}
+
+TEST(TestScaledQuantity, AdditionUsesCommonScale) {
+  auto sameScale = Millimeters::makeFromScaledValue(1.0) + Millimeters::makeFromScaledValue(2.0);
+  auto mixed = Millimeters::makeFromScaledValue(1.0) + Micrometers::makeFromScaledValue(500.0);
+  auto withBase = Kilometers::makeFromScaledValue(1.0) - 1.0 * meter;
+
+  EXPECT_TRUE((std::is_same_v<Millimeters, decltype(sameScale)>));
+  EXPECT_TRUE((std::is_same_v<Micrometers, decltype(mixed)>));
+  EXPECT_TRUE((std::is_same_v<poids::Scaled<si::Length, std::ratio<1>>, decltype(withBase)>));
+  EXPECT_DOUBLE_EQ(3.0, sameScale.value());
+  EXPECT_DOUBLE_EQ(1500.0, mixed.value());
+  EXPECT_DOUBLE_EQ(999.0, withBase.value());
+}
+
+TEST(TestScaledQuantity, ProductsCombineScales) {
+  auto area = Millimeters::makeFromScaledValue(3.0) * Millimeters::makeFromScaledValue(4.0);
+  auto speed = Millimeters::makeFromScaledValue(6.0) / Milliseconds::makeFromScaledValue(2.0);
+  auto force = Millimeters::makeFromScaledValue(2.0) * (3.0 * newton);
+
+  EXPECT_TRUE((std::is_same_v<poids::Scaled<si::Area, std::micro>, decltype(area)>));
+  EXPECT_TRUE((std::is_same_v<poids::Scaled<si::Velocity, std::ratio<1>>, decltype(speed)>));
+  EXPECT_TRUE((std::is_same_v<poids::Scaled<si::Energy, std::milli>, decltype(force)>));
+  EXPECT_DOUBLE_EQ(12.0, area.value());
+  EXPECT_DOUBLE_EQ(3.0, speed.value());
+  EXPECT_DOUBLE_EQ(6.0e-3, force.as(joule));
+  EXPECT_DOUBLE_EQ(4.0, (Millimeters::makeFromScaledValue(2.0) * 2.0).value());
+}
+
+TEST(TestScaledQuantity, ComparesAcrossScales) {
+  auto length = Millimeters::makeFromScaledValue(1500.0);
+
+  EXPECT_TRUE(length == Micrometers::makeFromScaledValue(1.5e6));
+  EXPECT_TRUE(length < Kilometers::makeFromScaledValue(1.0));
+  EXPECT_TRUE(length > 1.0 * meter);
+  EXPECT_TRUE(length != 1.0 * meter);
+}
+
+TEST(TestScaledQuantity, IntegralScalars) {
+  using Counts = poids::ScaledQuantity<std::int32_t, si::Length::Unit, std::micro>;
+
+  auto actual = poids::ScaledQuantity<std::int32_t, si::Length::Unit, std::milli>{Counts::makeFromScaledValue(2500)};
+
+  EXPECT_EQ(2, actual.value());
+  EXPECT_EQ(2000, Counts{actual}.value());
+}
+
+TEST(TestScaledQuantity, LossyConversionsAreExplicit) {
+  using MillimeterCounts = poids::ScaledQuantity<std::int32_t, si::Length::Unit, std::milli>;
+  using MeterCounts = poids::ScaledQuantity<std::int32_t, si::Length::Unit, std::ratio<1>>;
+
+  EXPECT_TRUE((std::is_convertible_v<MeterCounts, MillimeterCounts>));
+  EXPECT_FALSE((std::is_convertible_v<MillimeterCounts, MeterCounts>));
+  EXPECT_TRUE((std::is_constructible_v<MeterCounts, MillimeterCounts>));
+  EXPECT_TRUE((std::is_convertible_v<Kilometers, Millimeters>));
+  EXPECT_TRUE((std::is_convertible_v<Millimeters, Kilometers>));
+  EXPECT_TRUE((std::is_convertible_v<Millimeters, si::Length>));
+}
+
+TEST(TestScaledQuantity, IntegralRescaleDoesNotOverflow) {
+  using ThirdCounts = poids::ScaledQuantity<std::int32_t, si::Length::Unit, std::ratio<1, 3>>;
+  using MillimeterCounts = poids::ScaledQuantity<std::int32_t, si::Length::Unit, std::milli>;
+
+  auto actual = MillimeterCounts{ThirdCounts::makeFromScaledValue(3000001)};
+  auto negative = MillimeterCounts{ThirdCounts::makeFromScaledValue(-3000001)};
+
+  EXPECT_EQ(1000000333, actual.value());
+  EXPECT_EQ(-1000000333, negative.value());
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/core/uninitialized.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+TEST(TestUninitialized, DefaultConstructionStillZeroes) {
+  si::Energy actual;
+
+  EXPECT_DOUBLE_EQ(0.0, actual.as(joule));
+}
+
+TEST(TestUninitialized, ConstructQuantityUninitialized) {
+  si::Energy actual{poids::uninitialized};
+
+  actual = 4.0 * joule;
+
+  EXPECT_DOUBLE_EQ(4.0, actual.as(joule));
+}
+
+TEST(TestUninitialized, TagIsNotImplicitlyConstructible) {
+  EXPECT_FALSE((std::is_convertible_v<poids::Uninitialized, si::Energy>));
+  EXPECT_FALSE((std::is_convertible_v<decltype(poids::uninitialized), si::Energy>));
+}
+
+TEST(TestUninitialized, VectorWithDefaultInitAllocator) {
+  std::vector<si::Energy, poids::DefaultInitAllocator<si::Energy>> actual(16);
+
+  for (auto& value : actual) {
+    value = 2.0 * joule;
+  }
+
+  ASSERT_EQ(16u, actual.size());
+  EXPECT_DOUBLE_EQ(2.0, actual[15].as(joule));
+}
+
+TEST(TestUninitialized, DefaultInitAllocatorKeepsExplicitValues) {
+  std::vector<si::Length, poids::DefaultInitAllocator<si::Length>> actual(3, 5.0 * meter);
+
+  actual.resize(4, 1.0 * meter);
+
+  EXPECT_DOUBLE_EQ(5.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(1.0, actual[3].as(meter));
+}
+
+TEST(TestUninitialized, ConstructQuantityArrayUninitialized) {
+  poids::ArrayOf<si::Power> actual(8, poids::uninitialized);
+
+  actual.fill(3.0 * watt);
+
+  ASSERT_EQ(8u, actual.size());
+  EXPECT_DOUBLE_EQ(3.0, actual[7].as(watt));
+}
+
+TEST(TestUninitialized, ResizeQuantityArrayUninitializedKeepsValues) {
+  poids::ArrayOf<si::Power> actual{1.0 * watt, 2.0 * watt};
+
+  actual.resize(3, poids::uninitialized);
+  actual[2] = 3.0 * watt;
+
+  ASSERT_EQ(3u, actual.size());
+  EXPECT_DOUBLE_EQ(1.0, actual[0].as(watt));
+  EXPECT_DOUBLE_EQ(2.0, actual[1].as(watt));
+  EXPECT_DOUBLE_EQ(3.0, actual[2].as(watt));
+}
+
+TEST(TestUninitialized, ResizeQuantityArrayZeroesByDefault) {
+  poids::ArrayOf<si::Power> actual{1.0 * watt};
+
+  actual.resize(2);
+
+  EXPECT_DOUBLE_EQ(0.0, actual[1].as(watt));
+}
@@ -0,0 +1,112 @@
+#include <type_traits>
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+
+#include "poids/scalar_support/eigen_matrix.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  using LengthUnit = si::Length::Unit;
+  using VelocityUnit = si::Velocity::Unit;
+  using AngleUnit = si::Angle::Unit;
+  using TimeUnit = si::Time::Unit;
+
+  using State = poids::QuantityColumn<LengthUnit, VelocityUnit>;
+  using StateCovariance = poids::CovarianceMatrix<LengthUnit, VelocityUnit>;
+  using Transition = poids::QuantityMatrix<State::RowUnits, State::RowUnits>;
+}  // namespace
+
+TEST(TestQuantityMatrix, ElementsCarryRowAndColumnUnits) {
+  poids::QuantityMatrix<poids::UnitList<LengthUnit, AngleUnit>, poids::UnitList<TimeUnit, VelocityUnit>> actual;
+
+  actual.set<0, 0>(2.0 * meter / second);
+  actual.set<1, 1>(4.0 * second / meter);
+
+  EXPECT_TRUE((std::is_same_v<si::Velocity, decltype(actual.get<0, 0>())>));
+  EXPECT_TRUE((std::is_same_v<si::Time, decltype(actual.get<0, 1>())>));
+  EXPECT_TRUE((std::is_same_v<si::Frequency, decltype(actual.get<1, 0>())>));
+  EXPECT_DOUBLE_EQ(2.0, (actual.get<0, 0>().as(meter / second)));
+  EXPECT_DOUBLE_EQ(4.0, (actual.get<1, 1>().base()));
+  EXPECT_DOUBLE_EQ(0.0, (actual.get<1, 0>().base()));
+}
+
+TEST(TestQuantityMatrix, ColumnFromQuantities) {
+  State actual{3.0 * meter, -1.5 * meter / second};
+
+  EXPECT_TRUE((std::is_same_v<si::Length, decltype(actual.get<0>())>));
+  EXPECT_TRUE((std::is_same_v<si::Velocity, decltype(actual.get<1>())>));
+  EXPECT_DOUBLE_EQ(3.0, actual.get<0>().as(meter));
+  EXPECT_DOUBLE_EQ(-1.5, actual.get<1>().as(meter / second));
+}
+
+TEST(TestQuantityMatrix, ProductMapsColumnUnitsToRowUnits) {
+  poids::QuantityMatrix<poids::UnitList<si::Power::Unit>, State::RowUnits> gain;
+  gain.set<0, 0>(2.0 * watt / meter);
+  gain.set<0, 1>(3.0 * watt / (meter / second));
+  State state{1.0 * meter, 2.0 * meter / second};
+
+  auto actual = gain * state;
+
+  EXPECT_TRUE((std::is_same_v<poids::QuantityColumn<si::Power::Unit>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(8.0, actual.get<0>().as(watt));
+}
+
+TEST(TestQuantityMatrix, KalmanPredictAndUpdateAreConsistent) {
+  const si::Time dt = 0.1 * second;
+  Transition transition = Transition::identity();
+  transition.set<0, 1>(dt);
+
+  StateCovariance covariance;
+  covariance.set<0, 0>(4.0 * meter * meter);
+  covariance.set<1, 1>(1.0 * meter * meter / (second * second));
+  State state{0.0 * meter, 10.0 * meter / second};
+
+  State predicted = transition * state;
+  StateCovariance predictedCovariance = transition * covariance * transition.transpose();
+
+  EXPECT_DOUBLE_EQ(1.0, predicted.get<0>().as(meter));
+  EXPECT_NEAR(4.01, (predictedCovariance.get<0, 0>().base()), 1e-12);
+  EXPECT_NEAR(0.1, (predictedCovariance.get<0, 1>().base()), 1e-12);
+
+  using Measurement = poids::QuantityColumn<LengthUnit>;
+  poids::QuantityMatrix<Measurement::RowUnits, State::RowUnits> observation;
+  observation.set<0, 0>(poids::makeBase<si::Unitless>(1.0));
+  poids::CovarianceMatrix<LengthUnit> noise;
+  noise.set<0, 0>(1.0 * meter * meter);
+
+  auto innovationCovariance = observation * predictedCovariance * observation.transpose() + noise;
+  auto gain = predictedCovariance * observation.transpose() * innovationCovariance.inverse();
+  State updated = predicted + gain * (Measurement{2.0 * meter} - observation * predicted);
+  StateCovariance updatedCovariance = (Transition::identity() - gain * observation) * predictedCovariance;
+
+  EXPECT_TRUE((std::is_same_v<poids::QuantityMatrix<State::RowUnits, Measurement::RowUnits>, decltype(gain)>));
+  EXPECT_NEAR(1.0 + 4.01 / 5.01, updated.get<0>().as(meter), 1e-12);
+  EXPECT_LT((updatedCovariance.get<0, 0>().base()), (predictedCovariance.get<0, 0>().base()));
+}
+
+TEST(TestQuantityMatrix, InverseSwapsUnits) {
+  poids::QuantityMatrix<poids::UnitList<LengthUnit, AngleUnit>, poids::UnitList<TimeUnit, VelocityUnit>> matrix;
+  matrix.data() << 2.0, 1.0, 0.5, 3.0;
+
+  auto inverse = matrix.inverse();
+
+  EXPECT_TRUE((std::is_same_v<poids::QuantityMatrix<poids::UnitList<TimeUnit, VelocityUnit>,
+                                                    poids::UnitList<LengthUnit, AngleUnit>>,
+                              decltype(inverse)>));
+  EXPECT_TRUE((inverse * matrix).isApprox(decltype(inverse * matrix)::identity()));
+  EXPECT_TRUE((std::is_same_v<decltype(matrix), std::decay_t<decltype(inverse.inverse())>>));
+}
+
+TEST(TestQuantityMatrix, ScaleByQuantity) {
+  State state{1.0 * meter, 2.0 * meter / second};
+
+  auto actual = 3.0 * kilogram * state;
+
+  EXPECT_TRUE((std::is_same_v<si::Momentum, decltype(actual.get<1>())>));
+  EXPECT_DOUBLE_EQ(6.0, actual.get<1>().base());
+  EXPECT_DOUBLE_EQ(-1.0, (-state).get<0>().as(meter));
+  EXPECT_DOUBLE_EQ(2.0, (state * 2.0).get<0>().as(meter));
+}
@@ -116,3 +116,16 @@ TEST(TestVectorArithmetic, DivideEqual) {
 
   EXPECT_TRUE(expected.isApprox(actual, milli(second)));
 }
+
+TEST(TestVectorArithmetic, PowIsCoefficientWise) {
+  poids::Vector<si::Length, 3> a{Vector3d{1.0, 4.0, 9.0} * meter};
+
+  auto cube = poids::pow<3, 1>(a);
+  auto root = poids::pow<1, 2>(a);
+  auto inverse = poids::pow<-1, 1>(a);
+
+  EXPECT_TRUE((std::is_same_v<poids::Vector<si::Volume, 3>, decltype(cube)>));
+  EXPECT_TRUE(cube.isApprox(poids::Vector<si::Volume, 3>{Vector3d{1.0, 64.0, 729.0} * meter3}));
+  EXPECT_TRUE(root.base().isApprox(Vector3d{1.0, 2.0, 3.0}));
+  EXPECT_TRUE(inverse.base().isApprox(Vector3d{1.0, 0.25, 1.0 / 9.0}));
+}
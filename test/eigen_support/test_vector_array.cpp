@@ -0,0 +1,216 @@
+#include <cmath>
+#include <cstddef>
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+
+#include "poids/si.hpp"
+#include "poids/scalar_support/eigen_vector_array.hpp"
+
+using Eigen::Vector3d;
+using poids::square;
+
+using namespace si::units;
+using namespace si::prefix;
+
+TEST(TestVectorArray, ConstructWithSizeIsZeroed) {
+  poids::VectorArray<si::Length, 3> actual(4);
+
+  ASSERT_EQ(4u, actual.size());
+  EXPECT_TRUE(actual.data().isZero());
+}
+
+TEST(TestVectorArray, StoresComponentsInSeparateLanes) {
+  poids::VectorArray<si::Length, 3> actual{poids::Vector<si::Length, 3>{Vector3d{1.0, 2.0, 3.0} * meter},
+                                           poids::Vector<si::Length, 3>{Vector3d{4.0, 5.0, 6.0} * meter}};
+
+  const double* x = actual.x().data();
+  const double* y = actual.y().data();
+
+  EXPECT_DOUBLE_EQ(1.0, x[0]);
+  EXPECT_DOUBLE_EQ(4.0, x[1]);
+  EXPECT_DOUBLE_EQ(2.0, y[0]);
+  EXPECT_DOUBLE_EQ(5.0, y[1]);
+  EXPECT_EQ(x + 2, y);
+}
+
+TEST(TestVectorArray, IndexGathersVector) {
+  poids::Vector<si::Force, 3> expected{Vector3d{4.0, 5.0, 6.0} * newton};
+
+  poids::VectorArray<si::Force, 3> actual(2);
+  actual.set(1, expected);
+
+  EXPECT_EQ(expected, actual[1]);
+  EXPECT_TRUE(actual[0].base().isZero());
+}
+
+TEST(TestVectorArray, ComponentViewModifiesInPlace) {
+  poids::VectorArray<si::Velocity, 2> actual(3);
+
+  actual.y()[2] = 7.0 * meter / second;
+
+  EXPECT_DOUBLE_EQ(0.0, actual[2].x().as(meter / second));
+  EXPECT_DOUBLE_EQ(7.0, actual[2].y().as(meter / second));
+}
+
+TEST(TestVectorArray, Norm) {
+  poids::VectorArray<si::Energy, 3> value{poids::Vector<si::Energy, 3>{Vector3d{12.0, 15.0, 16.0} * kilo(joule)},
+                                          poids::Vector<si::Energy, 3>{Vector3d{3.0, 0.0, 4.0} * joule}};
+
+  poids::ArrayOf<si::Energy> actual = value.norm();
+
+  EXPECT_NEAR(25'000.0, actual[0].as(joule), 1e-6);
+  EXPECT_NEAR(5.0, actual[1].as(joule), 1e-6);
+}
+
+TEST(TestVectorArray, Normalized) {
+  poids::VectorArray<si::Energy, 3> value{poids::Vector<si::Energy, 3>{Vector3d{12.0, 15.0, 16.0} * joule},
+                                          poids::Vector<si::Energy, 3>{Vector3d{2.0, 10.0, 11.0} * joule}};
+
+  poids::VectorArray<si::Energy, 3> actual = value.normalized();
+
+  EXPECT_TRUE(actual[0].isApprox(poids::Vector<si::Energy, 3>{Vector3d{0.48, 0.6, 0.64} * joule}, 1e-6 * joule));
+  EXPECT_TRUE(actual[1].isApprox(poids::Vector<si::Energy, 3>{Vector3d{0.133'333'333, 0.666'666'667, 0.733'333'333} * joule}, 1e-6 * joule));
+}
+
+TEST(TestVectorArray, NormalizedLeavesZeroVectors) {
+  poids::VectorArray<si::Energy, 3> actual{poids::Vector<si::Energy, 3>{Vector3d{0.0, 0.0, 0.0} * joule},
+                                           poids::Vector<si::Energy, 3>{Vector3d{3.0, 0.0, 4.0} * joule}};
+
+  actual.normalize();
+
+  EXPECT_EQ(0.0, actual[0].norm().as(joule));
+  EXPECT_TRUE(actual[1].isApprox(poids::Vector<si::Energy, 3>{Vector3d{0.6, 0.0, 0.8} * joule}, 1e-6 * joule));
+}
+
+TEST(TestVectorArray, DotMatchesSingleVector) {
+  poids::Vector<si::Acceleration, 3> a0{Vector3d{8.2, 9.34, 0.654} * meter / square(second)};
+  poids::Vector<si::Acceleration, 3> a1{Vector3d{-1.0, 2.0, 3.0} * meter / square(second)};
+  poids::Vector<si::Mass, 3> b0{Vector3d{-12.3, 100, 6.258} * kilogram};
+  poids::Vector<si::Mass, 3> b1{Vector3d{4.0, 5.0, -6.0} * kilogram};
+
+  poids::VectorArray<si::Acceleration, 3> a{a0, a1};
+  poids::VectorArray<si::Mass, 3> b{b0, b1};
+
+  auto actual = a.dot(b);
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Force>, decltype(actual)>));
+  EXPECT_NEAR(a0.dot(b0).as(newton), actual[0].as(newton), 1e-9);
+  EXPECT_NEAR(a1.dot(b1).as(newton), actual[1].as(newton), 1e-9);
+}
+
+TEST(TestVectorArray, CrossMatchesSingleVector) {
+  poids::Vector<si::Length, 3> a0{Vector3d{2.5, 27.356, -46.87} * meter};
+  poids::Vector<si::Length, 3> a1{Vector3d{1.0, 0.0, 0.0} * meter};
+  poids::Vector<si::Force, 3> b0{Vector3d{56.12, 0.12, -10.0} * newton};
+  poids::Vector<si::Force, 3> b1{Vector3d{0.0, 1.0, 0.0} * newton};
+
+  poids::VectorArray<si::Length, 3> a{a0, a1};
+  poids::VectorArray<si::Force, 3> b{b0, b1};
+
+  auto actual = a.cross(b);
+
+  EXPECT_TRUE((std::is_same_v<poids::VectorArray<si::Energy, 3>, decltype(actual)>));
+  EXPECT_TRUE(actual[0].isApprox(poids::Vector<si::Energy, 3>{a0.cross(b0)}, micro(joule)));
+  EXPECT_TRUE(actual[1].isApprox(poids::Vector<si::Energy, 3>{Vector3d{0.0, 0.0, 1.0} * joule}, micro(joule)));
+}
+
+TEST(TestVectorArray, RotatedMatchesSingleVector) {
+  poids::Vector<si::Length, 3> a0{Vector3d{2.5, 27.356, -46.87} * meter};
+  poids::Vector<si::Length, 3> a1{Vector3d{1.0, 0.0, 0.0} * meter};
+  const Eigen::Matrix3d rotation = Eigen::AngleAxisd(0.3, Vector3d{1.0, 2.0, 3.0}.normalized()).toRotationMatrix();
+
+  poids::VectorArray<si::Length, 3> a{a0, a1};
+  auto actual = a.rotated(rotation);
+  a.rotate(rotation);
+
+  EXPECT_TRUE((std::is_same_v<poids::VectorArray<si::Length, 3>, decltype(actual)>));
+  for (std::size_t i = 0; i < 2; ++i) {
+    const Vector3d expected = rotation * (i == 0 ? a0 : a1).base();
+    EXPECT_TRUE(actual[i].base().isApprox(expected, 1e-12));
+    EXPECT_TRUE(a[i].base().isApprox(expected, 1e-12));
+  }
+  EXPECT_NEAR(a0.norm().as(meter), actual.norm()[0].as(meter), 1e-9);
+}
+
+TEST(TestVectorArray, TransformedRotatesThenTranslates) {
+  poids::VectorArray<si::Length, 3> points{poids::Vector<si::Length, 3>{Vector3d{1.0, 0.0, 0.0} * meter},
+                                           poids::Vector<si::Length, 3>{Vector3d{0.0, 2.0, 0.0} * meter}};
+  const Eigen::Matrix3d quarterTurn = Eigen::AngleAxisd(M_PI / 2.0, Vector3d::UnitZ()).toRotationMatrix();
+  poids::Vector<si::Length, 3> offset{Vector3d{0.0, 0.0, 5.0} * meter};
+
+  auto actual = points.transformed(quarterTurn, offset);
+  points.transform(quarterTurn, offset);
+
+  EXPECT_TRUE(actual[0].isApprox(poids::Vector<si::Length, 3>{Vector3d{0.0, 1.0, 5.0} * meter}));
+  EXPECT_TRUE(actual[1].isApprox(poids::Vector<si::Length, 3>{Vector3d{-2.0, 0.0, 5.0} * meter}));
+  EXPECT_TRUE(points[1].isApprox(actual[1]));
+}
+
+TEST(TestVectorArray, Distance) {
+  poids::VectorArray<si::Length, 2> a{poids::Vector<si::Length, 2>{Eigen::Vector2d{0.0, 0.0} * meter},
+                                      poids::Vector<si::Length, 2>{Eigen::Vector2d{1.0, 1.0} * meter}};
+  poids::VectorArray<si::Length, 2> b{poids::Vector<si::Length, 2>{Eigen::Vector2d{3.0, 4.0} * meter},
+                                      poids::Vector<si::Length, 2>{Eigen::Vector2d{1.0, 1.0} * meter}};
+
+  auto actual = a.distance(b);
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Length>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(5.0, actual[0].as(meter));
+  EXPECT_DOUBLE_EQ(0.0, actual[1].as(meter));
+}
+
+TEST(TestVectorArray, PairwiseDistancesSpanSeveralBlocks) {
+  const std::size_t rows = 3;
+  const std::size_t columns = 2 * poids::detail::DistanceBlock + 5;
+  poids::VectorArray<si::Length, 3> a(rows, poids::uninitialized);
+  poids::VectorArray<si::Length, 3> b(columns, poids::uninitialized);
+  for (std::size_t i = 0; i < rows; ++i) {
+    a.set(i, poids::Vector<si::Length, 3>{Vector3d{1.0 * i, -2.0, 0.5} * meter});
+  }
+  for (std::size_t j = 0; j < columns; ++j) {
+    b.set(j, poids::Vector<si::Length, 3>{Vector3d{0.25 * j, 1.0, -1.0 * j} * meter});
+  }
+
+  auto actual = poids::pairwiseDistances(a, b);
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Length>, decltype(actual)>));
+  ASSERT_EQ(rows * columns, actual.size());
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < columns; ++j) {
+      EXPECT_NEAR((a[i].base() - b[j].base()).norm(), actual[i * columns + j].as(meter), 1e-12);
+    }
+  }
+}
+
+TEST(TestVectorArrayArithmetic, AddSubtract) {
+  poids::VectorArray<si::Length, 2> a(2, poids::Vector<si::Length, 2>{Eigen::Vector2d{1.0, 2.0} * meter});
+  poids::VectorArray<si::Length, 2> b(2, poids::Vector<si::Length, 2>{Eigen::Vector2d{0.5, 0.5} * meter});
+
+  auto sum = a + b;
+  auto difference = a - b;
+
+  EXPECT_DOUBLE_EQ(2.5, sum[1].y().as(meter));
+  EXPECT_DOUBLE_EQ(0.5, difference[1].x().as(meter));
+}
+
+TEST(TestVectorArrayArithmetic, ScaleByScalarAndQuantity) {
+  poids::VectorArray<si::Velocity, 3> velocity(2, poids::Vector<si::Velocity, 3>{Vector3d{1.0, 2.0, 3.0} * meter / second});
+
+  auto doubled = velocity * 2.0;
+  auto momentum = (3.0 * kilogram) * velocity;
+
+  EXPECT_TRUE((std::is_same_v<poids::VectorArray<si::Momentum, 3>, decltype(momentum)>));
+  EXPECT_DOUBLE_EQ(6.0, doubled[0].z().as(meter / second));
+  EXPECT_DOUBLE_EQ(9.0, momentum[1].z().base());
+}
+
+TEST(TestVectorArrayArithmetic, ScaleByQuantityArray) {
+  poids::VectorArray<si::Acceleration, 3> acceleration(2, poids::Vector<si::Acceleration, 3>{Vector3d{0.0, 0.0, -9.81} * meter / square(second)});
+  poids::ArrayOf<si::Mass> mass{1.0 * kilogram, 2.0 * kilogram};
+
+  auto actual = mass * acceleration;
+
+  EXPECT_TRUE((std::is_same_v<poids::VectorArray<si::Force, 3>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(-9.81, actual[0].z().as(newton));
+  EXPECT_DOUBLE_EQ(-19.62, actual[1].z().as(newton));
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/breakpoint_table.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  /** A thermocouple calibration: voltage against temperature at irregular points */
+  poids::ArrayOf<si::Temperature> makeTemperatures() {
+    poids::ArrayOf<si::Temperature> temperatures(7);
+    const double kelvins[] = {273.15, 283.0, 300.0, 350.0, 400.0, 410.5, 500.0};
+    for (std::size_t i = 0; i < 7; ++i) {
+      temperatures[i] = kelvins[i] * kelvin;
+    }
+    return temperatures;
+  }
+
+  poids::ArrayOf<si::Voltage> makeVoltages() {
+    poids::ArrayOf<si::Voltage> voltages(7);
+    const double millivolts[] = {0.0, 0.4, 1.1, 3.2, 5.0, 5.1, 9.5};
+    for (std::size_t i = 0; i < 7; ++i) {
+      voltages[i] = millivolts[i] * milli(volt);
+    }
+    return voltages;
+  }
+
+  const auto calibration = poids::makeBreakpointTable(makeTemperatures(), makeVoltages());
+}  // namespace
+
+TEST(TestBreakpointTable, LocatesKeysLikeLowerBound) {
+  const poids::ArrayOf<si::Temperature> temperatures = makeTemperatures();
+
+  EXPECT_TRUE((std::is_same_v<poids::BreakpointTable<si::Voltage, si::Temperature>, std::remove_const_t<decltype(calibration)>>));
+  EXPECT_EQ(7u, calibration.size());
+  for (std::size_t i = 0; i + 1 < temperatures.size(); ++i) {
+    const si::Temperature middle = 0.5 * (temperatures[i] + temperatures[i + 1]);
+    const auto cell = calibration.locate(middle);
+    EXPECT_EQ(i, cell.index);
+    EXPECT_NEAR(0.5, cell.fraction, 1e-12);
+  }
+  EXPECT_EQ(0u, calibration.locate(200.0 * kelvin).index);
+  EXPECT_EQ(0.0, calibration.locate(200.0 * kelvin).fraction);
+  EXPECT_EQ(5u, calibration.locate(600.0 * kelvin).index);
+  EXPECT_EQ(1.0, calibration.locate(600.0 * kelvin).fraction);
+}
+
+TEST(TestBreakpointTable, LinearPassesThroughBreakpoints) {
+  for (std::size_t i = 0; i < calibration.size(); ++i) {
+    EXPECT_NEAR(calibration.value(i).as(milli(volt)), calibration(calibration.key(i)).as(milli(volt)), 1e-12);
+    EXPECT_NEAR(calibration.value(i).as(milli(volt)),
+                calibration.interpolate(poids::monotoneCubicInterpolation, calibration.key(i)).as(milli(volt)), 1e-12);
+  }
+  EXPECT_NEAR(0.75, calibration(291.5 * kelvin).as(milli(volt)), 1e-12);
+  EXPECT_DOUBLE_EQ(9.5, calibration(1000.0 * kelvin).as(milli(volt)));
+}
+
+TEST(TestBreakpointTable, MonotoneCubicDoesNotOvershoot) {
+  poids::ArrayOf<si::Length> positions(5);
+  poids::ArrayOf<si::Pressure> pressures(5);
+  const double meters[] = {0.0, 1.0, 1.5, 4.0, 4.2};
+  const double bars[] = {1.0, 1.0, 2.0, 2.0, 7.0};
+  for (std::size_t i = 0; i < 5; ++i) {
+    positions[i] = meters[i] * meter;
+    pressures[i] = bars[i] * 100.0 * kilo(pascal);
+  }
+  const auto table = poids::makeBreakpointTable(positions, pressures);
+
+  double previous = 0.0;
+  for (std::size_t i = 0; i <= 420; ++i) {
+    const double p = table.interpolate(poids::monotoneCubicInterpolation, 0.01 * static_cast<double>(i) * meter)
+                         .as(kilo(pascal));
+    EXPECT_GE(p, previous - 1e-9);
+    EXPECT_LE(p, 700.0 + 1e-9);
+    previous = p;
+  }
+  EXPECT_DOUBLE_EQ(100.0, table.interpolate(poids::monotoneCubicInterpolation, 0.5 * meter).as(kilo(pascal)));
+  EXPECT_DOUBLE_EQ(200.0, table.interpolate(poids::monotoneCubicInterpolation, 3.0 * meter).as(kilo(pascal)));
+}
+
+TEST(TestBreakpointTable, SearchesEveryTableSize) {
+  for (std::size_t n = 2; n < 40; ++n) {
+    poids::ArrayOf<si::Time> times(n);
+    poids::ArrayOf<si::Length> lengths(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      times[i] = (static_cast<double>(i * i) + static_cast<double>(i)) * second;
+      lengths[i] = 3.0 * static_cast<double>(i) * meter;
+    }
+    const auto table = poids::makeBreakpointTable(times, lengths);
+    std::vector<double> sorted;
+    for (std::size_t i = 0; i < n; ++i) {
+      sorted.push_back(times[i].as(second));
+    }
+    const double end = static_cast<double>(n * n);
+    for (double t = -1.0; t < end; t += 0.37) {
+      const auto rank = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), t) - sorted.begin());
+      const std::size_t expected = std::min(std::max(rank, std::size_t{1}), n - 1) - 1;
+      ASSERT_EQ(expected, table.locate(t * second).index) << "n = " << n << ", t = " << t;
+    }
+  }
+}
+
+TEST(TestBreakpointTable, InterpolatesArraysOfKeys) {
+  constexpr std::size_t count = 37;
+  poids::ArrayOf<si::Temperature> unsorted(count);
+  poids::ArrayOf<si::Temperature> sorted(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    unsorted[i] = (250.0 + static_cast<double>((i * 17) % count) * 7.5) * kelvin;
+    sorted[i] = (250.0 + static_cast<double>(i) * 7.5) * kelvin;
+  }
+  poids::ArrayOf<si::Voltage> linear(count);
+  poids::ArrayOf<si::Voltage> cubic(count);
+  poids::ArrayOf<si::Voltage> sortedLinear(count);
+  poids::ArrayOf<si::Voltage> sortedCubic(count);
+
+  calibration.interpolateEach(linear, unsorted);
+  calibration.interpolateEach(poids::monotoneCubicInterpolation, cubic, unsorted);
+  calibration.interpolateSorted(sortedLinear, sorted);
+  calibration.interpolateSorted(poids::monotoneCubicInterpolation, sortedCubic, sorted);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const si::Temperature u = unsorted[i];
+    const si::Temperature s = sorted[i];
+    EXPECT_EQ(calibration(u), si::Voltage{linear[i]});
+    EXPECT_EQ(calibration.interpolate(poids::monotoneCubicInterpolation, u), si::Voltage{cubic[i]});
+    EXPECT_EQ(calibration(s), si::Voltage{sortedLinear[i]});
+    EXPECT_EQ(calibration.interpolate(poids::monotoneCubicInterpolation, s), si::Voltage{sortedCubic[i]});
+  }
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/fft.hpp"
+#include "poids/scalar_support/complex_array.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  constexpr double pi = 3.1415926535897932384626433832795;
+
+  /** A deterministic complex test signal of count samples */
+  poids::ComplexArrayOf<si::Acceleration> makeSignal(std::size_t count) {
+    poids::ComplexArrayOf<si::Acceleration> signal(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      const double x = static_cast<double>(i);
+      signal.set(i, std::complex<double>{std::sin(0.7 * x) + 0.1 * x, std::cos(1.3 * x * x)} * meter / (second * second));
+    }
+    return signal;
+  }
+
+  /** The discrete transform by its definition */
+  std::vector<std::complex<double>> naiveDft(const poids::ComplexArrayOf<si::Acceleration>& signal) {
+    const std::size_t n = signal.size();
+    std::vector<std::complex<double>> result(n);
+    for (std::size_t k = 0; k < n; ++k) {
+      for (std::size_t j = 0; j < n; ++j) {
+        const double angle = -2.0 * pi * static_cast<double>((j * k) % n) / static_cast<double>(n);
+        result[k] += signal[j].base() * std::complex<double>{std::cos(angle), std::sin(angle)};
+      }
+    }
+    return result;
+  }
+}  // namespace
+
+TEST(TestFft, MatchesTheDefinitionForEverySize) {
+  const si::Time dt = 0.5 * second;
+  for (std::size_t n : {1u, 2u, 3u, 5u, 8u, 12u, 17u, 64u, 100u, 243u}) {
+    const poids::FftPlan<double> plan(n);
+    const poids::ComplexArrayOf<si::Acceleration> signal = makeSignal(n);
+
+    const auto spectrum = poids::fourierTransform(plan, signal, dt);
+
+    const std::vector<std::complex<double>> expected = naiveDft(signal);
+    for (std::size_t k = 0; k < n; ++k) {
+      EXPECT_NEAR(0.5 * expected[k].real(), spectrum[k].real().as(meter / second), 1e-9 * static_cast<double>(n)) << n;
+      EXPECT_NEAR(0.5 * expected[k].imag(), spectrum[k].imag().as(meter / second), 1e-9 * static_cast<double>(n)) << n;
+    }
+  }
+}
+
+TEST(TestFft, SpectrumHasTheUnitOfSignalTimesTime) {
+  const poids::FftPlan<double> plan(16);
+  const auto spectrum = poids::fourierTransform(plan, makeSignal(16), 1.0 * milli(second));
+  const auto signal = poids::inverseFourierTransform(plan, spectrum, 1.0 * milli(second));
+
+  EXPECT_TRUE((std::is_same_v<poids::ComplexArrayOf<si::Velocity>, std::remove_const_t<decltype(spectrum)>>));
+  EXPECT_TRUE((std::is_same_v<poids::ComplexArrayOf<si::Acceleration>, std::remove_const_t<decltype(signal)>>));
+}
+
+TEST(TestFft, InverseRestoresTheSignal) {
+  for (std::size_t n : {8u, 30u}) {
+    const poids::FftPlan<double> plan(n);
+    const poids::ComplexArrayOf<si::Acceleration> signal = makeSignal(n);
+
+    const auto restored = poids::inverseFourierTransform(plan, poids::fourierTransform(plan, signal, 0.25 * second),
+                                                         0.25 * second);
+
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(signal[i].real().as(meter / (second * second)), restored[i].real().as(meter / (second * second)), 1e-12);
+      EXPECT_NEAR(signal[i].imag().as(meter / (second * second)), restored[i].imag().as(meter / (second * second)), 1e-12);
+    }
+  }
+}
+
+TEST(TestFft, RealTransformMatchesComplexTransform) {
+  const si::Time dt = 2.0 * milli(second);
+  for (std::size_t n : {2u, 4u, 6u, 10u, 16u, 24u, 1024u}) {
+    poids::ArrayOf<si::Acceleration> real(n);
+    poids::ComplexArrayOf<si::Acceleration> complex(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      const double x = static_cast<double>(i);
+      real[i] = (std::sin(0.3 * x) + 0.01 * x * x) * meter / (second * second);
+      complex.set(i, std::complex<double>{real[i].base(), 0.0} * meter / (second * second));
+    }
+    const poids::RealFftPlan<double> realPlan(n);
+
+    const auto half = poids::fourierTransform(realPlan, real, dt);
+    const auto full = poids::fourierTransform(poids::FftPlan<double>(n), complex, dt);
+    const auto restored = poids::inverseFourierTransform(realPlan, half, dt);
+
+    ASSERT_EQ(n / 2 + 1, half.size());
+    for (std::size_t k = 0; k < half.size(); ++k) {
+      EXPECT_NEAR(full[k].real().as(meter / second), half[k].real().as(meter / second), 1e-12 * static_cast<double>(n)) << n;
+      EXPECT_NEAR(full[k].imag().as(meter / second), half[k].imag().as(meter / second), 1e-12 * static_cast<double>(n)) << n;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(real[i].base(), restored[i].base(), 1e-12 * static_cast<double>(n)) << n;
+    }
+  }
+}
+
+TEST(TestFft, WelchIntegratesToTheMeanSquare) {
+  // A 50 Hz vibration with an amplitude of 3 m/s^2, sampled at 1 kHz
+  constexpr std::size_t count = 8192;
+  const si::Time dt = 1.0 * milli(second);
+  poids::ArrayOf<si::Acceleration> signal(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    signal[i] = 3.0 * std::sin(2.0 * pi * 50.0 * static_cast<double>(i) * 1e-3) * meter / (second * second);
+  }
+
+  const auto spectrum = poids::welch(signal, dt, 256);
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Frequency>, decltype(spectrum.frequencies)>));
+  ASSERT_EQ(129u, spectrum.density.size());
+  EXPECT_DOUBLE_EQ(500.0, si::Frequency{spectrum.frequencies[128]}.as(hertz));
+  const si::Frequency df = spectrum.frequencies[1];
+  double meanSquare = 0.0;
+  std::size_t peak = 0;
+  for (std::size_t k = 0; k < spectrum.density.size(); ++k) {
+    meanSquare += (spectrum.density[k] * df).as(meter * meter / poids::pow<4, 1>(second));
+    if (spectrum.density[k] > spectrum.density[peak]) {
+      peak = k;
+    }
+  }
+  EXPECT_NEAR(4.5, meanSquare, 0.05);
+  EXPECT_NEAR(50.0, si::Frequency{spectrum.frequencies[peak]}.as(hertz), 2.0);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/lookup_table.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  /** A density which is bilinear in temperature and pressure */
+  si::Density bilinearDensity(si::Temperature t, si::Pressure p) {
+    const double kelvins = t.as(kelvin);
+    const double bars = p.as(kilo(pascal)) / 100.0;
+    return (1000.0 - 0.2 * kelvins + 0.05 * bars + 0.001 * kelvins * bars) * kilogram / (meter * meter * meter);
+  }
+
+  const poids::UniformAxis<si::Temperature> temperatures{280.0 * kelvin, 380.0 * kelvin, 11};
+  const poids::UniformAxis<si::Pressure> pressures{1.0 * mega(pascal), 5.0 * mega(pascal), 9};
+}  // namespace
+
+static_assert(std::is_same_v<poids::UniformAxis<si::Length>, decltype(poids::UniformAxis{1.0 * meter, 2.0 * meter, 2})>);
+
+TEST(TestLookupTable, UniformAxisLocatesKeys) {
+  const auto cell = temperatures.locate(315.0 * kelvin);
+
+  EXPECT_EQ(3u, cell.index);
+  EXPECT_NEAR(0.5, cell.fraction, 1e-12);
+  EXPECT_DOUBLE_EQ(10.0, temperatures.step().as(kelvin));
+  EXPECT_DOUBLE_EQ(380.0, temperatures.back().as(kelvin));
+  EXPECT_EQ(0u, temperatures.locate(200.0 * kelvin).index);
+  EXPECT_EQ(0.0, temperatures.locate(200.0 * kelvin).fraction);
+  EXPECT_EQ(9u, temperatures.locate(500.0 * kelvin).index);
+  EXPECT_EQ(1.0, temperatures.locate(500.0 * kelvin).fraction);
+}
+
+TEST(TestLookupTable, OneDimensionalLinear) {
+  const poids::UniformAxis<si::Time> times{0.0 * second, 10.0 * second, 11};
+  const auto table = poids::makeLookupTable([](si::Time t) { return si::Length{(2.0 + 3.0 * t.as(second)) * meter}; }, times);
+
+  EXPECT_TRUE((std::is_same_v<poids::UniformTable<si::Length, si::Time>, std::remove_const_t<decltype(table)>>));
+  EXPECT_DOUBLE_EQ(2.0 + 3.0 * 4.25, table(4.25 * second).as(meter));
+  EXPECT_DOUBLE_EQ(2.0, table(-1.0 * second).as(meter));
+  EXPECT_DOUBLE_EQ(32.0, table(12.0 * second).as(meter));
+}
+
+TEST(TestLookupTable, NaNKeysGiveNaN) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const poids::UniformAxis<si::Time> times{0.0 * second, 10.0 * second, 11};
+  const auto table = poids::makeLookupTable([](si::Time t) { return si::Length{t.as(second) * meter}; }, times);
+
+  EXPECT_EQ(0u, times.locate(nan * second).index);
+  EXPECT_TRUE(std::isnan(times.locate(nan * second).fraction));
+  EXPECT_TRUE(std::isnan(table(nan * second).as(meter)));
+  EXPECT_TRUE(std::isnan(table.interpolate(poids::cubicInterpolation, nan * second).as(meter)));
+}
+
+TEST(TestLookupTable, TwoDimensionalLinearIsExactForBilinearFunctions) {
+  const auto table = poids::makeLookupTable(bilinearDensity, temperatures, pressures);
+
+  for (double t : {280.0, 293.15, 333.3, 379.9}) {
+    for (double p : {1.0, 1.7, 3.25, 5.0}) {
+      const si::Temperature temperature = t * kelvin;
+      const si::Pressure pressure = p * mega(pascal);
+      EXPECT_NEAR(bilinearDensity(temperature, pressure).as(kilogram / (meter * meter * meter)),
+                  table(temperature, pressure).as(kilogram / (meter * meter * meter)), 1e-9);
+    }
+  }
+}
+
+TEST(TestLookupTable, ThreeDimensionalLinear) {
+  const poids::UniformAxis<si::Length> xs{0.0 * meter, 1.0 * meter, 5};
+  const poids::UniformAxis<si::Length> ys{0.0 * meter, 2.0 * meter, 3};
+  const poids::UniformAxis<si::Time> ts{0.0 * second, 4.0 * second, 9};
+  const auto field = [](si::Length x, si::Length y, si::Time t) {
+    return si::Temperature{(300.0 + x.as(meter) - 2.0 * y.as(meter) + 0.5 * t.as(second)) * kelvin};
+  };
+  const auto table = poids::makeLookupTable(field, xs, ys, ts);
+
+  EXPECT_EQ(5u * 3u * 9u, table.values().size());
+  EXPECT_NEAR(field(0.3 * meter, 1.1 * meter, 2.7 * second).as(kelvin),
+              table(0.3 * meter, 1.1 * meter, 2.7 * second).as(kelvin), 1e-12);
+}
+
+TEST(TestLookupTable, CubicIsExactForQuadraticsInTheInterior) {
+  const poids::UniformAxis<si::Length> xs{0.0 * meter, 10.0 * meter, 11};
+  const auto quadratic = [](si::Length x) { return si::Area{x * x - 3.0 * meter * x}; };
+  const auto table = poids::makeLookupTable(quadratic, xs);
+
+  const si::Length x = 4.3 * meter;
+  EXPECT_NEAR(quadratic(x).as(meter * meter), table.interpolate(poids::cubicInterpolation, x).as(meter * meter), 1e-12);
+  EXPECT_GT(std::abs(quadratic(x).as(meter * meter) - table(x).as(meter * meter)), 0.1);
+  EXPECT_DOUBLE_EQ(quadratic(3.0 * meter).as(meter * meter),
+                   table.interpolate(poids::cubicInterpolation, 3.0 * meter).as(meter * meter));
+}
+
+TEST(TestLookupTable, InterpolatesArraysOfKeys) {
+  const auto table = poids::makeLookupTable(bilinearDensity, temperatures, pressures);
+  constexpr std::size_t count = 23;
+  poids::ArrayOf<si::Temperature> t(count);
+  poids::ArrayOf<si::Pressure> p(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    t[i] = (275.0 + 5.0 * static_cast<double>(i)) * kelvin;
+    p[i] = (0.5 + 0.25 * static_cast<double>(i)) * mega(pascal);
+  }
+  poids::ArrayOf<si::Density> linear(count);
+  poids::ArrayOf<si::Density> cubic(count);
+
+  table.interpolateEach(linear, t, p);
+  table.interpolateEach(poids::cubicInterpolation, cubic, t, p);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(table(si::Temperature{t[i]}, si::Pressure{p[i]}), si::Density{linear[i]});
+    EXPECT_EQ(table.interpolate(poids::cubicInterpolation, si::Temperature{t[i]}, si::Pressure{p[i]}), si::Density{cubic[i]});
+  }
+}
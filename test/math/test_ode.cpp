@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/ode.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  using OscillatorState = std::tuple<si::Length, si::Velocity>;
+
+  /** An undamped oscillator with an angular frequency of 2 rad/s */
+  struct Oscillator {
+    template <typename TimeQuantity, typename State>
+    auto operator()(const TimeQuantity&, const State& y) const {
+      const si::Frequency omega = 2.0 * hertz;
+      return std::make_tuple(std::get<1>(y), -(omega * omega) * std::get<0>(y));
+    }
+  };
+
+  double oscillatorPosition(double t) { return std::cos(2.0 * t); }
+}  // namespace
+
+static_assert(std::is_same_v<si::Velocity, poids::DerivativeOf_t<si::Length, si::Time>>);
+static_assert(std::is_same_v<std::tuple<si::Velocity, si::Acceleration>, poids::DerivativeOf_t<OscillatorState, si::Time>>);
+
+TEST(TestOde, RungeKutta4IsFourthOrder) {
+  const si::Time tau = 2.0 * second;
+  const auto decay = [&](si::Time, si::Length x) -> si::Velocity { return -x / tau; };
+
+  const auto errorWithSteps = [&](int steps) {
+    const si::Time dt = (1.0 / steps) * second;
+    si::Length x = 1.0 * meter;
+    for (int i = 0; i < steps; ++i) {
+      x = poids::rungeKutta4Step(decay, si::Time{i * dt}, x, dt);
+    }
+    return std::abs(x.as(meter) - std::exp(-0.5));
+  };
+
+  EXPECT_LT(errorWithSteps(10), 1e-7);
+  EXPECT_NEAR(16.0, errorWithSteps(10) / errorWithSteps(20), 1.0);
+}
+
+TEST(TestOde, RungeKutta4WithTupleState) {
+  OscillatorState y{1.0 * meter, 0.0 * meter / second};
+  const si::Time dt = 0.01 * second;
+  for (int i = 0; i < 300; ++i) {
+    y = poids::rungeKutta4Step(Oscillator{}, si::Time{i * dt}, y, dt);
+  }
+
+  EXPECT_NEAR(oscillatorPosition(3.0), std::get<0>(y).as(meter), 1e-8);
+  EXPECT_NEAR(-2.0 * std::sin(6.0), std::get<1>(y).as(meter / second), 1e-7);
+}
+
+TEST(TestOde, DormandPrinceEstimatesItsError) {
+  const OscillatorState y{1.0 * meter, 0.0 * meter / second};
+
+  const auto step = poids::dormandPrinceStep(Oscillator{}, si::Time{}, y, si::Time{0.1 * second});
+  const double actual = std::abs(std::get<0>(step.state).as(meter) - oscillatorPosition(0.1));
+
+  EXPECT_LT(actual, 1e-7);
+  EXPECT_GT(std::abs(std::get<0>(step.error).as(meter)), actual);
+  EXPECT_LT(std::abs(std::get<0>(step.error).as(meter)), 1e-6);
+}
+
+TEST(TestOde, AdaptiveIntegrationMeetsTolerance) {
+  const OscillatorState y0{1.0 * meter, 0.0 * meter / second};
+  const poids::OdeTolerance<OscillatorState> tolerance{1e-9, OscillatorState{1e-9 * meter, 1e-9 * meter / second}};
+
+  const auto solution = poids::integrateAdaptive(Oscillator{}, si::Time{}, y0, si::Time{10.0 * second}, tolerance,
+                                                 si::Time{1e-3 * second});
+
+  EXPECT_TRUE(solution.completed);
+  EXPECT_DOUBLE_EQ(10.0, solution.time.as(second));
+  EXPECT_NEAR(oscillatorPosition(10.0), std::get<0>(solution.state).as(meter), 1e-7);
+  EXPECT_GT(solution.accepted, 10u);
+  EXPECT_LT(solution.accepted, 1000u);
+  EXPECT_GT(solution.step.as(second), 1e-3);
+}
+
+TEST(TestOde, AdaptiveIntegrationWithRelativeToleranceAtRest) {
+  const OscillatorState y0{0.0 * meter, 0.0 * meter / second};
+  const poids::OdeTolerance<OscillatorState> tolerance{1e-6, OscillatorState{}};
+
+  const auto solution = poids::integrateAdaptive(Oscillator{}, si::Time{}, y0, si::Time{10.0 * second}, tolerance,
+                                                 si::Time{1e-3 * second});
+
+  EXPECT_TRUE(solution.completed);
+  EXPECT_DOUBLE_EQ(10.0, solution.time.as(second));
+  EXPECT_EQ(0.0, std::get<0>(solution.state).as(meter));
+  EXPECT_EQ(0u, solution.rejected);
+}
+
+TEST(TestOde, AdaptiveIntegrationStopsWhenStepsFail) {
+  const auto diverging = [](si::Time, si::Length) -> si::Velocity { return std::numeric_limits<double>::quiet_NaN() * meter / second; };
+  const poids::OdeTolerance<si::Length> tolerance{1e-6, 1e-6 * meter};
+
+  const auto failed = poids::integrateAdaptive(diverging, si::Time{}, si::Length{1.0 * meter}, si::Time{1.0 * second},
+                                               tolerance, si::Time{1e-3 * second});
+  const auto limited = poids::integrateAdaptive(Oscillator{}, si::Time{}, OscillatorState{1.0 * meter, 0.0 * meter / second},
+                                                si::Time{10.0 * second}, poids::OdeTolerance<OscillatorState>{1e-6, {}},
+                                                si::Time{1e-3 * second}, 5);
+
+  EXPECT_FALSE(failed.completed);
+  EXPECT_EQ(0.0, failed.time.as(second));
+  EXPECT_EQ(0u, failed.accepted);
+  EXPECT_FALSE(limited.completed);
+  EXPECT_EQ(5u, limited.accepted + limited.rejected);
+  EXPECT_LT(limited.time.as(second), 10.0);
+}
+
+TEST(TestOde, VelocityVerletConservesEnergy) {
+  const si::Frequency omega = 2.0 * hertz;
+  const auto acceleration = [&](si::Time, si::Length x) -> si::Acceleration { return -(omega * omega) * x; };
+  const auto energy = [&](si::Length x, si::Velocity v) { return (v * v + omega * omega * x * x).as(meter * meter / (second * second)); };
+
+  si::Length x = 1.0 * meter;
+  si::Velocity v = 0.0 * meter / second;
+  const double initial = energy(x, v);
+  const si::Time dt = 0.05 * second;
+  double worst = 0.0;
+  for (int i = 0; i < 20000; ++i) {
+    poids::velocityVerletStep(acceleration, si::Time{i * dt}, x, v, dt);
+    worst = std::max(worst, std::abs(energy(x, v) - initial));
+  }
+
+  EXPECT_LT(worst, 1e-2 * initial);
+}
+
+TEST(TestOde, StepsIndependentSystemsInStructureOfArrays) {
+  constexpr std::size_t count = 37;
+  poids::ArrayOf<si::Length> position(count);
+  poids::ArrayOf<si::Velocity> velocity(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    position[i] = (1.0 + 0.1 * static_cast<double>(i)) * meter;
+    velocity[i] = (0.5 - 0.02 * static_cast<double>(i)) * meter / second;
+  }
+  const si::Time dt = 0.01 * second;
+
+  for (int i = 0; i < 10; ++i) {
+    poids::rungeKutta4StepEach(Oscillator{}, si::Time{i * dt}, std::tie(position, velocity), dt);
+  }
+
+  for (std::size_t i = 0; i < count; ++i) {
+    OscillatorState y{(1.0 + 0.1 * static_cast<double>(i)) * meter, (0.5 - 0.02 * static_cast<double>(i)) * meter / second};
+    for (int s = 0; s < 10; ++s) {
+      y = poids::rungeKutta4Step(Oscillator{}, si::Time{s * dt}, y, dt);
+    }
+    EXPECT_NEAR(std::get<0>(y).as(meter), si::Length{position[i]}.as(meter), 1e-14);
+    EXPECT_NEAR(std::get<1>(y).as(meter / second), si::Velocity{velocity[i]}.as(meter / second), 1e-14);
+  }
+}
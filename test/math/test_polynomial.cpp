@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <type_traits>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/polynomial.hpp"
+#include "poids/scalar_support/dual.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  using SpecificHeatCapacity = poids::Quantity<double, poids::UnitOf_t<decltype(joule / (kilogram * kelvin))>>;
+  using HeatCapacityFit = poids::Polynomial<SpecificHeatCapacity, si::Temperature, 3>;
+
+  /** The specific heat capacity of nitrogen gas, fitted from 300 K to 1000 K */
+  const HeatCapacityFit nitrogen{979.0 * joule / (kilogram * kelvin), 0.0418 * joule / (kilogram * kelvin * kelvin),
+                                 1.2e-4 * joule / (kilogram * poids::pow<3, 1>(kelvin)),
+                                 -5.6e-8 * joule / (kilogram * poids::pow<4, 1>(kelvin))};
+
+  double nitrogenReference(double t) { return 979.0 + 0.0418 * t + 1.2e-4 * t * t - 5.6e-8 * t * t * t; }
+}  // namespace
+
+static_assert(std::is_same_v<HeatCapacityFit::Coefficient<0>, SpecificHeatCapacity>);
+static_assert(std::is_same_v<HeatCapacityFit::CoefficientUnit<2>,
+                             poids::UnitOf_t<decltype(joule / (kilogram * kelvin * kelvin * kelvin))>>);
+
+TEST(TestPolynomial, EvaluatesWithEitherScheme) {
+  for (double t = 300.0; t <= 1000.0; t += 50.0) {
+    EXPECT_NEAR(nitrogenReference(t), nitrogen(t * kelvin).as(joule / (kilogram * kelvin)), 1e-9);
+    EXPECT_NEAR(nitrogenReference(t), nitrogen.evaluate(poids::estrin, t * kelvin).as(joule / (kilogram * kelvin)), 1e-9);
+  }
+  EXPECT_DOUBLE_EQ(1.2e-4, nitrogen.coefficient<2>().as(joule / (kilogram * kelvin * kelvin * kelvin)));
+}
+
+TEST(TestPolynomial, EstrinMatchesHornerForEveryDegree) {
+  const auto check = [](auto polynomial, const auto&... coefficients) {
+    for (double x = -2.0; x <= 2.0; x += 0.25) {
+      double expected = 0.0;
+      double power = 1.0;
+      ((expected += coefficients.as(meter) * power, power *= x), ...);
+      EXPECT_NEAR(expected, polynomial(x * second).as(meter), 1e-12);
+      EXPECT_NEAR(expected, polynomial.evaluate(poids::estrin, x * second).as(meter), 1e-12);
+    }
+  };
+  const si::Length c0 = 1.0 * meter;
+  const auto c = 1.0 * meter;
+  check(poids::Polynomial{c0, 2.0 * meter / second}, c0, 2.0 * c);
+  check(poids::Polynomial{c0, 2.0 * meter / second, -0.5 * meter / (second * second)}, c0, 2.0 * c, -0.5 * c);
+  check(poids::Polynomial{c0, 2.0 * meter / second, -0.5 * meter / (second * second),
+                          0.25 * meter / poids::pow<3, 1>(second), -1.5 * meter / poids::pow<4, 1>(second)},
+        c0, 2.0 * c, -0.5 * c, 0.25 * c, -1.5 * c);
+  check(poids::Polynomial{c0, 2.0 * meter / second, -0.5 * meter / (second * second),
+                          0.25 * meter / poids::pow<3, 1>(second), -1.5 * meter / poids::pow<4, 1>(second),
+                          0.75 * meter / poids::pow<5, 1>(second), 0.125 * meter / poids::pow<6, 1>(second)},
+        c0, 2.0 * c, -0.5 * c, 0.25 * c, -1.5 * c, 0.75 * c, 0.125 * c);
+}
+
+TEST(TestPolynomial, DeducesTheArgumentFromTheCoefficients) {
+  const poids::Polynomial fit{979.0 * joule / (kilogram * kelvin), 0.0418 * joule / (kilogram * kelvin * kelvin)};
+
+  EXPECT_TRUE((std::is_same_v<poids::Polynomial<SpecificHeatCapacity, si::Temperature, 1>, std::remove_const_t<decltype(fit)>>));
+}
+
+TEST(TestPolynomial, EvaluatesArrays) {
+  constexpr std::size_t count = 19;
+  poids::ArrayOf<si::Temperature> temperatures(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    temperatures[i] = (300.0 + 37.0 * static_cast<double>(i)) * kelvin;
+  }
+  poids::ArrayOf<SpecificHeatCapacity> horner(count);
+  poids::ArrayOf<SpecificHeatCapacity> estrin(count);
+
+  nitrogen.evaluateEach(horner, temperatures);
+  nitrogen.evaluateEach(poids::estrin, estrin, temperatures);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const si::Temperature t = temperatures[i];
+    EXPECT_EQ(nitrogen(t), SpecificHeatCapacity{horner[i]});
+    EXPECT_EQ(nitrogen.evaluate(poids::estrin, t), SpecificHeatCapacity{estrin[i]});
+  }
+}
+
+TEST(TestPolynomial, EvaluatesOtherScalars) {
+  const auto t = poids::makeVariable<1>(si::Temperature{500.0 * kelvin}, 0);
+
+  const auto cp = nitrogen(t);
+
+  EXPECT_NEAR(nitrogenReference(500.0), cp.primal().as(joule / (kilogram * kelvin)), 1e-9);
+  EXPECT_NEAR(0.0418 + 2.4e-4 * 500.0 - 3.0 * 5.6e-8 * 500.0 * 500.0,
+              cp.derivative<si::Temperature>(0).as(joule / (kilogram * kelvin * kelvin)), 1e-12);
+}
+
+TEST(TestPolynomial, EvaluatesRationalFunctions) {
+  // The dynamic viscosity of a gas as (a + b T) / (1 + c T)
+  using Viscosity = poids::Quantity<double, poids::UnitOf_t<decltype(pascal * second)>>;
+  const poids::Polynomial numerator{1.0e-6 * pascal * second, 6.0e-8 * pascal * second / kelvin};
+  const poids::Polynomial<si::Unitless, si::Temperature, 1> denominator{si::Unitless{1.0}, 1.0e-3 * poids::pow<-1, 1>(kelvin)};
+  const poids::RationalFunction viscosity{numerator, denominator};
+
+  EXPECT_TRUE((std::is_same_v<poids::RationalFunction<Viscosity, si::Temperature, 1, 1>, std::remove_const_t<decltype(viscosity)>>));
+  const auto reference = [](double t) { return (1.0e-6 + 6.0e-8 * t) / (1.0 + 1.0e-3 * t); };
+  EXPECT_NEAR(reference(400.0), viscosity(400.0 * kelvin).as(pascal * second), 1e-18);
+  EXPECT_NEAR(reference(400.0), viscosity.evaluate(poids::estrin, 400.0 * kelvin).as(pascal * second), 1e-18);
+
+  poids::ArrayOf<si::Temperature> temperatures(3, 300.0 * kelvin);
+  temperatures[1] = 600.0 * kelvin;
+  poids::ArrayOf<Viscosity> result(3);
+  viscosity.evaluateEach(result, temperatures);
+  EXPECT_NEAR(reference(600.0), Viscosity{result[1]}.as(pascal * second), 1e-18);
+}
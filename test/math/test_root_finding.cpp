@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "poids/core/quantity_array.hpp"
+#include "poids/math/root_finding.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+using namespace si::prefix;
+
+namespace {
+  /** The pressure at the bottom of a column of a fluid which is compressed by its own weight */
+  struct ColumnPressure {
+    template <typename Length>
+    auto operator()(const Length& depth) const {
+      const auto density = 1000.0 * kilogram / (meter * meter * meter);
+      const auto gravity = 9.81 * meter / (second * second);
+      const auto stiffening = 2.0 * kilogram / (meter * meter * meter * second * second);
+      return density * gravity * depth + stiffening * depth * depth;
+    }
+  };
+
+  /** The derivative of ColumnPressure with respect to depth */
+  struct ColumnPressureSlope {
+    template <typename Length>
+    auto operator()(const Length& depth) const {
+      const auto density = 1000.0 * kilogram / (meter * meter * meter);
+      const auto gravity = 9.81 * meter / (second * second);
+      const auto stiffening = 2.0 * kilogram / (meter * meter * meter * second * second);
+      return density * gravity + 2.0 * stiffening * depth;
+    }
+  };
+
+  /** The depth at which ColumnPressure is target, from the quadratic formula */
+  double exactDepth(double target) {
+    const double a = 2.0;
+    const double b = 9810.0;
+    return (-b + std::sqrt(b * b + 4.0 * a * target)) / (2.0 * a);
+  }
+
+  const si::Pressure target = 250.0 * kilo(pascal);
+  const auto residual = [](const auto& depth) { return ColumnPressure{}(depth)-target; };
+}  // namespace
+
+TEST(TestRootFinding, Bisection) {
+  const auto result = poids::bisect(residual, si::Length{0.0 * meter}, si::Length{100.0 * meter}, si::Length{1e-9 * meter});
+
+  EXPECT_TRUE(result.converged);
+  EXPECT_TRUE((std::is_same_v<si::Length, decltype(result.root)>));
+  EXPECT_NEAR(exactDepth(250e3), result.root.as(meter), 1e-9);
+}
+
+TEST(TestRootFinding, BrentConvergesFasterThanBisection) {
+  const si::Length tolerance = 1e-9 * meter;
+
+  const auto slow = poids::bisect(residual, si::Length{0.0 * meter}, si::Length{100.0 * meter}, tolerance);
+  const auto fast = poids::brent(residual, si::Length{0.0 * meter}, si::Length{100.0 * meter}, tolerance);
+
+  EXPECT_TRUE(fast.converged);
+  EXPECT_NEAR(exactDepth(250e3), fast.root.as(meter), 1e-9);
+  EXPECT_LT(fast.iterations * 3, slow.iterations);
+}
+
+TEST(TestRootFinding, NewtonWithExplicitOrAutomaticDerivatives) {
+  const si::Length guess = 10.0 * meter;
+  const si::Length tolerance = 1e-12 * meter;
+
+  const auto explicitResult = poids::newton(residual, ColumnPressureSlope{}, guess, tolerance);
+  const auto automaticResult = poids::newton(residual, poids::automaticDerivative, guess, tolerance);
+
+  EXPECT_TRUE(explicitResult.converged);
+  EXPECT_TRUE(automaticResult.converged);
+  EXPECT_NEAR(exactDepth(250e3), explicitResult.root.as(meter), 1e-10);
+  EXPECT_DOUBLE_EQ(explicitResult.root.as(meter), automaticResult.root.as(meter));
+  EXPECT_EQ(explicitResult.iterations, automaticResult.iterations);
+  EXPECT_LE(explicitResult.iterations, 6u);
+}
+
+TEST(TestRootFinding, ResidualTolerance) {
+  const poids::RootTolerance tolerance{si::Length{1e-15 * meter}, si::Pressure{1.0 * pascal}};
+
+  const auto result = poids::bisect(residual, si::Length{0.0 * meter}, si::Length{100.0 * meter}, tolerance);
+
+  EXPECT_TRUE(result.converged);
+  EXPECT_LT(result.iterations, 40u);
+  EXPECT_LE(std::abs(residual(result.root).as(pascal)), 1.0);
+}
+
+TEST(TestRootFinding, Minimization) {
+  const auto cost = [](si::Length x) { return (x - 2.0 * meter) * (x - 2.0 * meter) + 1.0 * meter * meter; };
+
+  const auto result = poids::minimize(cost, si::Length{-5.0 * meter}, si::Length{10.0 * meter}, si::Length{1e-8 * meter});
+
+  EXPECT_TRUE(result.converged);
+  EXPECT_NEAR(2.0, result.argument.as(meter), 1e-7);
+  EXPECT_NEAR(1.0, result.value.as(meter * meter), 1e-12);
+  EXPECT_LT(result.iterations, 20u);
+}
+
+TEST(TestRootFinding, SolvesIndependentProblemsInLanes) {
+  constexpr std::size_t count = 37;
+  poids::ArrayOf<si::Pressure> targets(count);
+  poids::ArrayOf<si::Length> lower(count, 0.0 * meter);
+  poids::ArrayOf<si::Length> upper(count, 1000.0 * meter);
+  poids::ArrayOf<si::Length> guesses(count, 10.0 * meter);
+  poids::ArrayOf<si::Length> bisected(count);
+  poids::ArrayOf<si::Length> newtons(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    targets[i] = (10.0 + 20.0 * static_cast<double>(i)) * kilo(pascal);
+  }
+
+  const auto shifted = [](const auto& depth, const auto& target) { return ColumnPressure{}(depth)-target; };
+  const auto slope = [](const auto& depth, const auto&) { return ColumnPressureSlope{}(depth); };
+
+  EXPECT_TRUE(poids::bisectEach(shifted, lower, upper, si::Length{1e-9 * meter}, bisected, targets));
+  EXPECT_TRUE(poids::newtonEach(shifted, slope, guesses, si::Length{1e-12 * meter}, newtons, targets));
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const double expected = exactDepth(targets[i].as(pascal));
+    EXPECT_NEAR(expected, si::Length{bisected[i]}.as(meter), 1e-9);
+    EXPECT_NEAR(expected, si::Length{newtons[i]}.as(meter), 1e-9);
+  }
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "poids/math/transcendental.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  /** The distance between actual and expected in units in the last place of expected */
+  double ulpError(double actual, long double expected) {
+    const double rounded = static_cast<double>(expected);
+    if (rounded == 0.0) {
+      return actual == 0.0 ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+    const long double ulp = std::ldexp(1.0L, std::ilogb(rounded) - 52);
+    return static_cast<double>(std::fabs((static_cast<long double>(actual) - expected) / ulp));
+  }
+
+  poids::ArrayOf<si::Angle> makeAngles(std::size_t count, double limit) {
+    std::mt19937_64 generator{42};
+    std::uniform_real_distribution<double> distribution{-limit, limit};
+    poids::ArrayOf<si::Angle> angles(count, poids::uninitialized);
+    for (std::size_t i = 0; i < count; ++i) {
+      angles[i] = distribution(generator) * radian;
+    }
+    return angles;
+  }
+}  // namespace
+
+TEST(TestTranscendental, SinOfAngle) {
+  si::Angle angle = 30.0 * degree;
+
+  auto actual = poids::sin(angle);
+
+  EXPECT_TRUE(poids::IsUnitless_v<decltype(actual)>);
+  EXPECT_DOUBLE_EQ(0.5, static_cast<double>(actual));
+}
+
+TEST(TestTranscendental, FunctionsOfUnitlessRatios) {
+  si::Length length = 2.0 * meter;
+  si::Length reference = 1.0 * meter;
+
+  EXPECT_DOUBLE_EQ(std::exp(2.0), static_cast<double>(poids::exp(length / reference)));
+  EXPECT_DOUBLE_EQ(std::log(2.0), static_cast<double>(poids::log(length / reference)));
+  EXPECT_DOUBLE_EQ(1.0, static_cast<double>(poids::log2(length / reference)));
+  EXPECT_DOUBLE_EQ(std::tanh(2.0), static_cast<double>(poids::tanh(length / reference)));
+}
+
+TEST(TestTranscendental, InverseFunctionsReturnAngles) {
+  si::Unitless half = poids::makeBase<si::Unitless>(0.5);
+
+  si::Angle actual = poids::asin(half);
+
+  EXPECT_NEAR(30.0, actual.as(degree), 1e-12);
+}
+
+TEST(TestTranscendental, SinCos) {
+  si::Angle angle = 60.0 * degree;
+
+  auto [sinAngle, cosAngle] = poids::sincos(angle);
+
+  EXPECT_DOUBLE_EQ(std::sin(angle.base()), static_cast<double>(sinAngle));
+  EXPECT_DOUBLE_EQ(std::cos(angle.base()), static_cast<double>(cosAngle));
+}
+
+TEST(TestTranscendental, Atan2ReturnsAngle) {
+  si::Length y = 1.0 * meter;
+  si::Length x = -1.0 * meter;
+
+  auto actual = poids::atan2(y, x);
+
+  EXPECT_TRUE((std::is_same_v<si::Angle, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(135.0, actual.as(degree));
+}
+
+TEST(TestTranscendental, ArraySinCosWithinThreeUlp) {
+  const auto angles = makeAngles(10000, 1.0e5);
+
+  const auto sinAngles = poids::sin(angles);
+  const auto [sinPair, cosPair] = poids::sincos(angles);
+  const auto cosAngles = poids::cos(angles);
+
+  ASSERT_EQ(angles.size(), sinAngles.size());
+  for (std::size_t i = 0; i < angles.size(); ++i) {
+    const long double x = angles.data()[i];
+    EXPECT_LE(ulpError(sinAngles.data()[i], std::sin(x)), 3.0) << angles.data()[i];
+    EXPECT_LE(ulpError(cosAngles.data()[i], std::cos(x)), 3.0) << angles.data()[i];
+    EXPECT_EQ(sinAngles.data()[i], sinPair.data()[i]);
+    EXPECT_EQ(cosAngles.data()[i], cosPair.data()[i]);
+  }
+}
+
+TEST(TestTranscendental, ArraySinNearMultiplesOfHalfPi) {
+  poids::ArrayOf<si::Angle> angles(4000, poids::uninitialized);
+  for (std::size_t i = 0; i < angles.size(); ++i) {
+    angles[i] = static_cast<double>(i * 37) * M_PI_2 * radian;
+  }
+
+  const auto sinAngles = poids::sin(angles);
+
+  for (std::size_t i = 0; i < angles.size(); ++i) {
+    EXPECT_LE(ulpError(sinAngles.data()[i], std::sin(static_cast<long double>(angles.data()[i]))), 3.0);
+  }
+}
+
+TEST(TestTranscendental, ArrayExpLogWithinTwoUlp) {
+  std::mt19937_64 generator{7};
+  std::uniform_real_distribution<double> distribution{-700.0, 700.0};
+  poids::ArrayOf<si::Unitless> exponents(10000, poids::uninitialized);
+  for (std::size_t i = 0; i < exponents.size(); ++i) {
+    exponents[i] = poids::makeBase<si::Unitless>(distribution(generator));
+  }
+
+  const auto values = poids::exp(exponents);
+  const auto logarithms = poids::log(values);
+
+  for (std::size_t i = 0; i < exponents.size(); ++i) {
+    const long double x = exponents.data()[i];
+    EXPECT_LE(ulpError(values.data()[i], std::exp(x)), 2.0);
+    EXPECT_LE(ulpError(logarithms.data()[i], std::log(static_cast<long double>(values.data()[i]))), 2.0);
+  }
+}
+
+TEST(TestTranscendental, ArraySpecialValuesFallBack) {
+  const double inputs[] = {0.0, -1.0, 1.0e6, -1.0e300, INFINITY, NAN, 800.0, -740.0};
+  auto values = poids::ConstSpanOf<si::Unitless>::makeFromBaseUnitValues(inputs, 8, 1);
+
+  const auto sinValues = poids::sin(values);
+  const auto expValues = poids::exp(values);
+  const auto logValues = poids::log(values);
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    if (std::isnan(inputs[i])) {
+      EXPECT_TRUE(std::isnan(sinValues.data()[i]));
+      EXPECT_TRUE(std::isnan(expValues.data()[i]));
+      EXPECT_TRUE(std::isnan(logValues.data()[i]));
+      continue;
+    }
+    if (std::isfinite(inputs[i])) {
+      EXPECT_DOUBLE_EQ(std::sin(inputs[i]), sinValues.data()[i]) << inputs[i];
+    }
+    EXPECT_DOUBLE_EQ(std::exp(inputs[i]), expValues.data()[i]) << inputs[i];
+    if (inputs[i] > 0.0) {
+      EXPECT_DOUBLE_EQ(std::log(inputs[i]), logValues.data()[i]) << inputs[i];
+    }
+  }
+  EXPECT_TRUE(std::isnan(logValues.data()[1]));
+  EXPECT_TRUE(std::isinf(logValues.data()[0]));
+}
+
+TEST(TestTranscendental, ArrayOfExpression) {
+  poids::ArrayOf<si::Time> time{0.0 * second, 0.25 * second, 0.5 * second};
+  si::Frequency frequency = 1.0 * hertz;
+  const double twoPi = 2.0 * M_PI;
+
+  auto actual = poids::cos(time * frequency * twoPi);
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Unitless>, decltype(actual)>));
+  EXPECT_DOUBLE_EQ(1.0, actual.data()[0]);
+  EXPECT_NEAR(0.0, actual.data()[1], 1e-15);
+  EXPECT_DOUBLE_EQ(-1.0, actual.data()[2]);
+}
+
+TEST(TestTranscendental, BatchQuantity) {
+  using Batch = poids::NativeBatch<double>;
+  auto angle = si::AngleOf<Batch>::makeFromBaseUnitValue(Batch{0.5});
+
+  auto actual = poids::sin(angle);
+
+  for (std::size_t i = 0; i < Batch::lanes; ++i) {
+    EXPECT_NEAR(std::sin(0.5), actual[i].base(), 1e-15);
+  }
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "poids/parallel/algorithm.hpp"
+#include "poids/parallel/thread_pool.hpp"
+#include "poids/si.hpp"
+
+using namespace si::units;
+
+namespace {
+  constexpr std::size_t LargeCount = 100003;
+
+  poids::ArrayOf<si::Length> makeLengths(std::size_t count) {
+    poids::ArrayOf<si::Length> length(count, poids::uninitialized);
+    for (std::size_t i = 0; i < count; ++i) {
+      length[i] = (0.1 * static_cast<double>(i % 97) + 1.0e-3 * static_cast<double>(i)) * meter;
+    }
+    return length;
+  }
+}  // namespace
+
+TEST(TestThreadPool, RunsEveryIndexExactlyOnce) {
+  poids::parallel::ThreadPool pool(3);
+  std::vector<std::atomic<int>> visits(LargeCount);
+
+  pool.forEachChunk(LargeCount, 100, [&](std::size_t first, std::size_t last) {
+    EXPECT_LE(last - first, 100u);
+    for (std::size_t i = first; i < last; ++i) {
+      visits[i].fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  for (const std::atomic<int>& count : visits) {
+    ASSERT_EQ(1, count.load());
+  }
+  EXPECT_EQ(4u, pool.concurrency());
+}
+
+TEST(TestThreadPool, NestedRangesComplete) {
+  poids::parallel::ThreadPool pool(2);
+  std::atomic<std::size_t> total{0};
+
+  pool.forEachChunk(8, 1, [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      pool.forEachChunk(1000, 10, [&](std::size_t innerFirst, std::size_t innerLast) {
+        total.fetch_add(innerLast - innerFirst, std::memory_order_relaxed);
+      });
+    }
+  });
+
+  EXPECT_EQ(8000u, total.load());
+}
+
+TEST(TestThreadPool, RethrowsExceptions) {
+  poids::parallel::ThreadPool pool(2);
+
+  EXPECT_THROW(pool.forEachChunk(1000, 10, [](std::size_t first, std::size_t) {
+                 if (first >= 500) {
+                   throw std::runtime_error("failed");
+                 }
+               }),
+               std::runtime_error);
+}
+
+TEST(TestParallel, TransformKeepsUnits) {
+  poids::parallel::ThreadPool pool(3);
+  const auto length = makeLengths(LargeCount);
+
+  auto area = poids::parallel::transform(pool, length, [](si::Length x) { return x * x; });
+
+  EXPECT_TRUE((std::is_same_v<poids::ArrayOf<si::Area>, decltype(area)>));
+  ASSERT_EQ(LargeCount, area.size());
+  for (std::size_t i = 0; i < LargeCount; i += 997) {
+    EXPECT_DOUBLE_EQ(length[i].base() * length[i].base(), area[i].as(meter2));
+  }
+}
+
+TEST(TestParallel, TransformIntoSpan) {
+  poids::parallel::ThreadPool pool(2);
+  const auto length = makeLengths(LargeCount);
+  poids::ArrayOf<si::Velocity> velocity(LargeCount, poids::uninitialized);
+  auto span = poids::SpanOf<si::Velocity>::makeFromBaseUnitValues(velocity.data(), velocity.size());
+
+  poids::parallel::transform(pool, length, span, [](si::Length x) { return x / (2.0 * second); });
+
+  for (std::size_t i = 0; i < LargeCount; i += 997) {
+    EXPECT_DOUBLE_EQ(0.5 * length[i].as(meter), velocity[i].as(meter / second));
+  }
+}
+
+TEST(TestParallel, ForEachMutatesInPlace) {
+  poids::parallel::ThreadPool pool(3);
+  poids::ArrayOf<si::Energy> energy(LargeCount, 1.0 * joule);
+
+  poids::parallel::forEach(pool, energy, [](auto element) { element = si::Energy{element} + 2.0 * joule; });
+
+  for (std::size_t i = 0; i < LargeCount; ++i) {
+    ASSERT_DOUBLE_EQ(3.0, energy[i].as(joule));
+  }
+}
+
+TEST(TestParallel, ReduceMatchesSerialSum) {
+  poids::parallel::ThreadPool pool(3);
+  const auto length = makeLengths(LargeCount);
+
+  auto actual = poids::parallel::reduce(pool, length);
+  auto expression = poids::parallel::reduce(pool, length * length);
+
+  EXPECT_TRUE((std::is_same_v<si::Length, decltype(actual)>));
+  EXPECT_TRUE((std::is_same_v<si::Area, decltype(expression)>));
+  EXPECT_NEAR(poids::sum(length, poids::kahanSummation).as(meter), actual.as(meter), 1.0e-9);
+  EXPECT_NEAR(poids::dot(length, length, poids::kahanSummation).as(meter2), expression.as(meter2), 1.0e-6);
+}
+
+TEST(TestParallel, DeterministicReductionIgnoresThreadCount) {
+  const auto length = makeLengths(LargeCount);
+  poids::parallel::ThreadPool serial(0);
+  poids::parallel::ThreadPool small(1);
+  poids::parallel::ThreadPool large(5);
+
+  const double expected = poids::parallel::reduce(serial, length, poids::parallel::deterministicReduction).base();
+
+  EXPECT_EQ(expected, poids::parallel::reduce(small, length, poids::parallel::deterministicReduction).base());
+  EXPECT_EQ(expected, poids::parallel::reduce(large, length, poids::parallel::deterministicReduction).base());
+  EXPECT_EQ(poids::parallel::reduce(small, length, si::Length{}, std::plus<>{},
+                                    poids::parallel::deterministicReduction),
+            poids::parallel::reduce(large, length, si::Length{}, std::plus<>{},
+                                    poids::parallel::deterministicReduction));
+}
+
+TEST(TestParallel, ReduceWithOperation) {
+  poids::parallel::ThreadPool pool(3);
+  const auto length = makeLengths(LargeCount);
+
+  auto longest = poids::parallel::reduce(pool, length, 0.0 * meter,
+                                         [](si::Length lhs, si::Length rhs) { return lhs < rhs ? rhs : lhs; });
+
+  EXPECT_EQ(poids::max(length), longest);
+}
+
+TEST(TestParallel, TransformReduceCombinesUnits) {
+  poids::parallel::ThreadPool pool(3);
+  poids::ArrayOf<si::Current> current(LargeCount, 2.0 * ampere);
+  poids::ArrayOf<si::Voltage> voltage(LargeCount, 3.0 * volt);
+
+  auto power = poids::parallel::transformReduce(pool, current, voltage, si::Power{}, std::plus<>{},
+                                                [](si::Current i, si::Voltage v) { return i * v; });
+  auto squares = poids::parallel::transformReduce(pool, current, 0.0 * ampere * ampere, std::plus<>{},
+                                                  [](si::Current i) { return i * i; });
+
+  EXPECT_TRUE((std::is_same_v<si::Power, decltype(power)>));
+  EXPECT_DOUBLE_EQ(6.0 * static_cast<double>(LargeCount), power.as(watt));
+  EXPECT_DOUBLE_EQ(4.0 * static_cast<double>(LargeCount), squares.base());
+}
+
+TEST(TestParallel, InclusiveAndExclusiveScan) {
+  poids::parallel::ThreadPool pool(3);
+  poids::ArrayOf<si::Length> step(LargeCount, 1.0 * meter);
+  poids::ArrayOf<si::Length> inclusive(LargeCount, poids::uninitialized);
+  poids::ArrayOf<si::Length> exclusive(LargeCount, poids::uninitialized);
+
+  poids::parallel::inclusiveScan(pool, step, inclusive);
+  poids::parallel::exclusiveScan(pool, step, exclusive, 10.0 * meter);
+
+  for (std::size_t i = 0; i < LargeCount; ++i) {
+    ASSERT_DOUBLE_EQ(static_cast<double>(i + 1), inclusive[i].as(meter));
+    ASSERT_DOUBLE_EQ(10.0 + static_cast<double>(i), exclusive[i].as(meter));
+  }
+}
+
+TEST(TestParallel, InPlaceScanMatchesSerialScan) {
+  poids::parallel::ThreadPool pool(4);
+  auto length = makeLengths(LargeCount);
+  const auto original = length;
+
+  poids::parallel::inclusiveScan(pool, length, length, std::plus<>{}, poids::parallel::deterministicReduction);
+
+  si::Length running{};
+  for (std::size_t i = 0; i < LargeCount; ++i) {
+    running = running + original[i];
+    ASSERT_NEAR(running.as(meter), length[i].as(meter), 1.0e-6);
+  }
+}
+
+TEST(TestParallel, EmptyRanges) {
+  poids::parallel::ThreadPool pool(2);
+  poids::ArrayOf<si::Length> empty;
+
+  EXPECT_EQ(0.0, poids::parallel::reduce(pool, empty).as(meter));
+  EXPECT_EQ(0u, poids::parallel::transform(pool, empty, [](si::Length x) { return x; }).size());
+  poids::parallel::inclusiveScan(pool, empty, empty);
+}